@@ -0,0 +1,127 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_AUTO_DIFF_CONSTRAINT_
+#define OMPL_BASE_AUTO_DIFF_CONSTRAINT_
+
+#include "ompl/base/Constraint.h"
+
+#include <unsupported/Eigen/AutoDiff>
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A constraint whose Jacobian is computed exactly, with
+         forward-mode automatic differentiation, instead of numerically. The
+         derived class \a Derived implements the constraint function once,
+         as a template on the scalar type:
+         \code
+         class SphereConstraint : public AutoDiffConstraint<SphereConstraint, 3, 1>
+         {
+         public:
+             SphereConstraint() : AutoDiffConstraint(3, 1)
+             {
+             }
+
+             template <typename Scalar>
+             void evaluate(const Eigen::Ref<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> &x,
+                           Eigen::Ref<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> out) const
+             {
+                 out[0] = x.norm() - 1;
+             }
+         };
+         \endcode
+         function() evaluates it with \c double. jacobian() evaluates it once
+         with dual numbers that carry the derivatives with respect to all
+         ambient coordinates, which gives the whole Jacobian in a single pass
+         (the numerical differentiation of Constraint needs six evaluations
+         per ambient dimension). When both \a AmbientDim and \a CoDim are
+         known at compile time, the dual numbers are fixed size, so no memory
+         is allocated and Eigen vectorizes the derivative arithmetic;
+         otherwise, the dual numbers are held in dynamically allocated
+         vectors. The constraint can be
+         used wherever a Constraint can, e.g., in a ConstraintIntersection or
+         any ConstrainedStateSpace. */
+        template <typename Derived, int AmbientDim = Eigen::Dynamic, int CoDim = Eigen::Dynamic>
+        class AutoDiffConstraint : public Constraint
+        {
+        public:
+            /** \brief The dual number type jacobian() evaluates the constraint function with */
+            using Dual = Eigen::AutoDiffScalar<Eigen::Matrix<double, AmbientDim, 1>>;
+
+            /** \brief Constructor. See Constraint::Constraint(). */
+            AutoDiffConstraint(const unsigned int ambientDim, const unsigned int coDim,
+                               double tolerance = magic::CONSTRAINT_PROJECTION_TOLERANCE)
+              : Constraint(ambientDim, coDim, tolerance)
+            {
+                if (AmbientDim != Eigen::Dynamic && ambientDim != (unsigned int)AmbientDim)
+                    throw ompl::Exception("ompl::base::AutoDiffConstraint(): "
+                                          "Ambient dimension does not match the template argument.");
+                if (CoDim != Eigen::Dynamic && coDim != (unsigned int)CoDim)
+                    throw ompl::Exception("ompl::base::AutoDiffConstraint(): "
+                                          "Co-dimension does not match the template argument.");
+            }
+
+            using Constraint::function;
+            using Constraint::jacobian;
+
+            void function(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> out) const override
+            {
+                static_cast<const Derived *>(this)->template evaluate<double>(x, out);
+            }
+
+            void jacobian(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::MatrixXd> out) const override
+            {
+                Eigen::Matrix<Dual, AmbientDim, 1> dx(n_);
+                Eigen::Matrix<Dual, CoDim, 1> dout(getCoDimension());
+                for (unsigned int i = 0; i < n_; ++i)
+                    dx[i] = Dual(x[i], n_, i);
+
+                static_cast<const Derived *>(this)->template evaluate<Dual>(dx, dout);
+
+                for (unsigned int i = 0; i < getCoDimension(); ++i)
+                {
+                    // outputs that do not depend on the input carry no derivatives
+                    if (dout[i].derivatives().size() == 0)
+                        out.row(i).setZero();
+                    else
+                        out.row(i) = dout[i].derivatives().transpose();
+                }
+            }
+        };
+    }
+}
+
+#endif
@@ -133,7 +133,13 @@ namespace ompl
             unsigned int getMotionStates(const State *s1, const State *s2, std::vector<State *> &states,
                                          unsigned int /*count*/, bool endpoints, bool /*alloc*/) const override
             {
-                bool success = stateSpace_->as<ConstrainedStateSpace>()->discreteGeodesic(s1, s2, true, &states);
+                // Reuse the traversal made when the motion was checked, if any.
+                auto geodesic = stateSpace_->as<ConstrainedStateSpace>()->getGeodesic(s1, s2, true);
+                states.reserve(states.size() + geodesic->states.size() + 1);
+                for (auto s : geodesic->states)
+                    states.push_back(cloneState(s));
+
+                bool success = geodesic->reached;
 
                 if (endpoints)
                 {
@@ -215,6 +221,7 @@ namespace ompl
                 s1 to \e s2 */
             bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const override
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::MOTION_CHECK);
                 auto &&atlas = stateSpace_->as<TangentBundleStateSpace>();
                 bool valid = motionValidator_->checkMotion(s1, s2, lastValid);
 
@@ -44,6 +44,8 @@
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 namespace ompl
@@ -57,6 +59,10 @@ namespace ompl
         /** \brief Maximum number of iterations in projection routine until
          * giving up. */
         static const unsigned int CONSTRAINT_PROJECTION_MAX_ITERATIONS = 50;
+
+        /** \brief Default damping factor of the damped least squares solver
+         * of the projection routine. */
+        static const double CONSTRAINT_PROJECTION_DAMPING = 1e-3;
     }  // namespace magic
 
     namespace base
@@ -75,6 +81,30 @@ namespace ompl
         class Constraint
         {
         public:
+            /** \brief The linear solvers available to compute the Newton steps
+             of the projection routine. All but DAMPED_LEAST_SQUARES compute the
+             minimum norm step when the Jacobian has full row rank. */
+            enum ProjectionSolver
+            {
+                /** \brief Singular value decomposition of the Jacobian. The
+                 most robust, and the most expensive, solver. */
+                PROJECTION_SVD,
+
+                /** \brief Householder QR decomposition of the transposed
+                 Jacobian. */
+                PROJECTION_QR,
+
+                /** \brief LDLT decomposition of \f$J J^T\f$, which is only
+                 of the size of the co-dimension. Steps for which \f$J J^T\f$
+                 is numerically singular are computed with the SVD. */
+                PROJECTION_LDLT,
+
+                /** \brief LDLT decomposition of \f$J J^T + \lambda^2 I\f$,
+                 which remains well conditioned near singularities of the
+                 constraint. */
+                PROJECTION_DAMPED_LEAST_SQUARES
+            };
+
             /** \brief Constructor. The dimension of the ambient configuration
              space as well as the dimension of the function's output need to be
              specified (the co-dimension of the constraint manifold). I.E., for
@@ -90,6 +120,9 @@ namespace ompl
               , k_(ambientDim - coDim)
               , tolerance_(tolerance)
               , maxIterations_(magic::CONSTRAINT_PROJECTION_MAX_ITERATIONS)
+              , solver_(PROJECTION_LDLT)
+              , damping_(magic::CONSTRAINT_PROJECTION_DAMPING)
+              , jacobianUpdateInterval_(1)
             {
                 if (n_ <= 0 || k_ <= 0)
                     throw ompl::Exception("ompl::base::Constraint(): "
@@ -135,7 +168,12 @@ namespace ompl
             virtual bool project(State *state) const;
 
             /** \brief Project a state \a x given the constraints. If a valid
-                projection cannot be found, this method will return false. */
+                projection cannot be found, this method will return false. The
+                projection uses Newton's method, with the linear solver chosen
+                by setProjectionSolver(), and works in memory kept for each
+                thread, so, with any of the solvers, it does not allocate
+                memory once the thread has performed its first projection,
+                except for what function() and jacobian() allocate. */
             virtual bool project(Eigen::Ref<Eigen::VectorXd> x) const;
 
             /** \brief Returns the distance of \a state to the constraint
@@ -216,9 +254,189 @@ namespace ompl
                 maxIterations_ = iterations;
             }
 
+            /** \brief Returns the solver used for the Newton steps of the
+             * projection routine. */
+            ProjectionSolver getProjectionSolver() const
+            {
+                return solver_;
+            }
+
+            /** \brief Sets the solver used for the Newton steps of the
+             * projection routine. */
+            void setProjectionSolver(ProjectionSolver solver)
+            {
+                solver_ = solver;
+            }
+
+            /** \brief Returns the damping factor of the damped least squares
+             * solver. */
+            double getProjectionDamping() const
+            {
+                return damping_;
+            }
+
+            /** \brief Sets the damping factor \f$\lambda\f$ of the damped
+             * least squares solver. */
+            void setProjectionDamping(double damping)
+            {
+                if (damping < 0)
+                    throw ompl::Exception("ompl::base::Constraint::setProjectionDamping(): "
+                                          "damping must not be negative.");
+                damping_ = damping;
+            }
+
+            /** \brief Returns the number of iterations of the projection
+             * routine between evaluations of the Jacobian. */
+            unsigned int getJacobianUpdateInterval() const
+            {
+                return jacobianUpdateInterval_;
+            }
+
+            /** \brief Sets the number of iterations of the projection routine
+             between evaluations of the Jacobian. In the iterations in between,
+             the Jacobian is approximated with Broyden's rank one update, which
+             only needs the constraint function. This is worthwhile when the
+             Jacobian is much more expensive than the function, e.g., when it is
+             computed numerically. The default is 1: the Jacobian is evaluated in
+             every iteration. */
+            void setJacobianUpdateInterval(unsigned int interval)
+            {
+                if (interval == 0)
+                    throw ompl::Exception("ompl::base::Constraint::setJacobianUpdateInterval(): "
+                                          "interval must be positive.");
+                jacobianUpdateInterval_ = interval;
+            }
+
             /** @} */
 
         protected:
+            /** \brief Memory used by the projection routine. The sizes are
+             fixed at compile time if \a AmbientDim and \a CoDim are not
+             Eigen::Dynamic, so the memory can be kept on the stack. */
+            template <int AmbientDim = Eigen::Dynamic, int CoDim = Eigen::Dynamic>
+            struct ProjectionWorkspace
+            {
+                EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+                using Vector = Eigen::Matrix<double, CoDim, 1>;
+                using Step = Eigen::Matrix<double, AmbientDim, 1>;
+                using Jacobian = Eigen::Matrix<double, CoDim, AmbientDim>;
+                using Square = Eigen::Matrix<double, CoDim, CoDim>;
+
+                /** \brief Allocate the memory for \a ambientDim and \a coDim;
+                 does nothing if the sizes did not change. */
+                void resize(unsigned int ambientDim, unsigned int coDim)
+                {
+                    f.resize(coDim);
+                    fPrevious.resize(coDim);
+                    y.resize(coDim);
+                    step.resize(ambientDim);
+                    j.resize(coDim, ambientDim);
+                    jjt.resize(coDim, coDim);
+                }
+
+                Vector f, fPrevious, y;
+                Step step;
+                Jacobian j;
+                Square jjt;
+                Eigen::LDLT<Square> ldlt;
+                Eigen::HouseholderQR<Eigen::Matrix<double, AmbientDim, CoDim>> qr;
+                Eigen::JacobiSVD<Jacobian> svd;
+            };
+
+            /** \brief Project \a x onto the constraint with Newton's method,
+             using the memory in \a ws. */
+            template <int AmbientDim, int CoDim>
+            bool projectNewton(Eigen::Ref<Eigen::VectorXd> x, ProjectionWorkspace<AmbientDim, CoDim> &ws) const
+            {
+                const unsigned int k = getCoDimension();
+                const double squaredTolerance = tolerance_ * tolerance_;
+                unsigned int iter = 0;
+                double norm = 0;
+
+                function(x, ws.f);
+                while ((norm = ws.f.squaredNorm()) > squaredTolerance && iter < maxIterations_)
+                {
+                    if (iter % jacobianUpdateInterval_ == 0)
+                        jacobian(x, ws.j);
+                    ++iter;
+
+                    // minimum norm (or damped) solution of j * step = f
+                    bool useSVD = solver_ == PROJECTION_SVD;
+                    switch (solver_)
+                    {
+                        case PROJECTION_SVD:
+                            break;
+                        case PROJECTION_QR:
+                            ws.qr.compute(ws.j.transpose());
+                            ws.y.noalias() = ws.qr.matrixQR()
+                                                 .topLeftCorner(k, k)
+                                                 .template triangularView<Eigen::Upper>()
+                                                 .transpose()
+                                                 .solve(ws.f);
+                            ws.step.setZero();
+                            ws.step.head(k) = ws.y;
+                            // step = Q * step, applying the reflectors I - tau * v * v^T
+                            // of Q in place, as householderQ() uses a temporary
+                            for (int i = k - 1; i >= 0; --i)
+                            {
+                                const auto v = ws.qr.matrixQR().col(i).tail(n_ - i - 1);
+                                auto s = ws.step.tail(n_ - i);
+                                const double d = ws.qr.hCoeffs()(i) * (s(0) + v.dot(s.tail(n_ - i - 1)));
+                                s(0) -= d;
+                                s.tail(n_ - i - 1) -= d * v;
+                            }
+                            break;
+                        case PROJECTION_LDLT:
+                        case PROJECTION_DAMPED_LEAST_SQUARES:
+                            ws.jjt.noalias() = ws.j * ws.j.transpose();
+                            if (solver_ == PROJECTION_DAMPED_LEAST_SQUARES)
+                                ws.jjt.diagonal().array() += damping_ * damping_;
+                            ws.ldlt.compute(ws.jjt);
+                            // j * j^T has the squared condition number of j, so close to a singularity
+                            // of the constraint the undamped step is computed with the SVD instead
+                            if (solver_ == PROJECTION_LDLT &&
+                                (ws.ldlt.info() != Eigen::Success ||
+                                 ws.ldlt.rcond() < std::numeric_limits<double>::epsilon()))
+                            {
+                                useSVD = true;
+                                break;
+                            }
+                            ws.y = ws.ldlt.solve(ws.f);
+                            ws.step.noalias() = ws.j.transpose() * ws.y;
+                            break;
+                    }
+                    if (useSVD)
+                    {
+                        ws.svd.compute(ws.j, AmbientDim == Eigen::Dynamic ? Eigen::ComputeThinU | Eigen::ComputeThinV :
+                                                                            Eigen::ComputeFullU | Eigen::ComputeFullV);
+                        // the solution of svd.solve(), computed in ws
+                        // rather than in a temporary of its own
+                        const Eigen::Index rank = ws.svd.rank();
+                        ws.y.head(rank).noalias() = ws.svd.matrixU().leftCols(rank).transpose() * ws.f;
+                        ws.y.head(rank).array() /= ws.svd.singularValues().head(rank).array();
+                        ws.step.noalias() = ws.svd.matrixV().leftCols(rank) * ws.y.head(rank);
+                    }
+
+                    x -= ws.step;
+                    if (jacobianUpdateInterval_ > 1)
+                        ws.fPrevious = ws.f;
+                    function(x, ws.f);
+
+                    // Broyden's update of the Jacobian for the iterations it is not evaluated in; the
+                    // step taken was -step, so j += (df + j * step) * (-step)^T / |step|^2
+                    const double stepNorm = ws.step.squaredNorm();
+                    if (iter % jacobianUpdateInterval_ != 0 && stepNorm > 0)
+                    {
+                        ws.y = ws.f - ws.fPrevious;
+                        ws.y.noalias() += ws.j * ws.step;
+                        ws.j.noalias() -= (ws.y / stepNorm) * ws.step.transpose();
+                    }
+                }
+
+                return norm < squaredTolerance;
+            }
+
             /** \brief Ambient space dimension. */
             const unsigned int n_;
 
@@ -232,6 +450,57 @@ namespace ompl
             /** \brief Maximum number of iterations for Newton method used in
              * projection onto manifold. */
             unsigned int maxIterations_;
+
+            /** \brief Solver for the Newton steps of the projection. */
+            ProjectionSolver solver_;
+
+            /** \brief Damping factor of the damped least squares solver. */
+            double damping_;
+
+            /** \brief Number of iterations of the projection between
+             * evaluations of the Jacobian. */
+            unsigned int jacobianUpdateInterval_;
+        };
+
+        /** \brief A constraint whose ambient dimension \a AmbientDim and
+         co-dimension \a CoDim are known at compile time. The projection
+         routine then works on fixed size matrices on the stack, which avoids
+         memory allocation and lets Eigen unroll the small matrix operations.
+         Derived classes implement function() and, preferably, jacobian() as
+         for Constraint. */
+        template <int AmbientDim, int CoDim>
+        class FixedSizeConstraint : public Constraint
+        {
+        public:
+            /** \brief Constructor. */
+            FixedSizeConstraint(double tolerance = magic::CONSTRAINT_PROJECTION_TOLERANCE)
+              : Constraint(AmbientDim, CoDim, tolerance)
+            {
+            }
+
+            using Constraint::project;
+            using Constraint::distance;
+            using Constraint::isSatisfied;
+
+            bool project(Eigen::Ref<Eigen::VectorXd> x) const override
+            {
+                ProjectionWorkspace<AmbientDim, CoDim> ws;
+                return projectNewton(x, ws);
+            }
+
+            double distance(const Eigen::Ref<const Eigen::VectorXd> &x) const override
+            {
+                Eigen::Matrix<double, CoDim, 1> f;
+                function(x, f);
+                return f.norm();
+            }
+
+            bool isSatisfied(const Eigen::Ref<const Eigen::VectorXd> &x) const override
+            {
+                Eigen::Matrix<double, CoDim, 1> f;
+                function(x, f);
+                return f.allFinite() && f.squaredNorm() <= tolerance_ * tolerance_;
+            }
         };
 
         /// @cond IGNORE
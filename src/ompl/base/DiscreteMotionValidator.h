@@ -39,6 +39,8 @@
 
 #include "ompl/base/MotionValidator.h"
 #include "ompl/base/SpaceInformation.h"
+#include <queue>
+#include <utility>
 
 namespace ompl
 {
@@ -67,6 +69,116 @@ namespace ompl
 
             bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const override;
 
+        protected:
+            /** \brief Check the motion from \e s1 to \e s2 by repeatedly checking the middle of the parts of
+                the segment that are left to check. The intermediate states are computed by \e space, which
+                provides validSegmentCount() and interpolate() as StateSpace does, and are checked by \e isValid.
+                This is the algorithm of checkMotion(); it is a template so TypedDiscreteMotionValidator can
+                run it without virtual calls. */
+            template <typename Space, typename IsValid>
+            bool checkMotion(const Space &space, const IsValid &isValid, const State *s1, const State *s2) const
+            {
+                /* assume motion starts in a valid configuration so s1 is valid */
+                if (!isValid(s2))
+                {
+                    invalid_++;
+                    return false;
+                }
+
+                bool result = true;
+                int nd = space.validSegmentCount(s1, s2);
+
+                /* initialize the queue of test positions */
+                std::queue<std::pair<int, int>> pos;
+                if (nd >= 2)
+                {
+                    pos.emplace(1, nd - 1);
+
+                    /* temporary storage for the checked state */
+                    State *test = si_->allocState();
+
+                    /* repeatedly subdivide the path segment in the middle (and check the middle) */
+                    while (!pos.empty())
+                    {
+                        std::pair<int, int> x = pos.front();
+
+                        int mid = (x.first + x.second) / 2;
+                        space.interpolate(s1, s2, (double)mid / (double)nd, test);
+
+                        if (!isValid(test))
+                        {
+                            result = false;
+                            break;
+                        }
+
+                        pos.pop();
+
+                        if (x.first < mid)
+                            pos.emplace(x.first, mid - 1);
+                        if (x.second > mid)
+                            pos.emplace(mid + 1, x.second);
+                    }
+
+                    si_->freeState(test);
+                }
+
+                if (result)
+                    valid_++;
+                else
+                    invalid_++;
+
+                return result;
+            }
+
+            /** \brief Check the motion from \e s1 to \e s2 by checking the intermediate states in order, and
+                report the last valid state in \e lastValid. The states are computed by \e space and checked by
+                \e isValid, as for the function above. */
+            template <typename Space, typename IsValid>
+            bool checkMotion(const Space &space, const IsValid &isValid, const State *s1, const State *s2,
+                             std::pair<State *, double> &lastValid) const
+            {
+                /* assume motion starts in a valid configuration so s1 is valid */
+
+                bool result = true;
+                int nd = space.validSegmentCount(s1, s2);
+
+                if (nd > 1)
+                {
+                    /* temporary storage for the checked state */
+                    State *test = si_->allocState();
+
+                    for (int j = 1; j < nd; ++j)
+                    {
+                        space.interpolate(s1, s2, (double)j / (double)nd, test);
+                        if (!isValid(test))
+                        {
+                            lastValid.second = (double)(j - 1) / (double)nd;
+                            if (lastValid.first != nullptr)
+                                space.interpolate(s1, s2, lastValid.second, lastValid.first);
+                            result = false;
+                            break;
+                        }
+                    }
+                    si_->freeState(test);
+                }
+
+                if (result)
+                    if (!isValid(s2))
+                    {
+                        lastValid.second = (double)(nd - 1) / (double)nd;
+                        if (lastValid.first != nullptr)
+                            space.interpolate(s1, s2, lastValid.second, lastValid.first);
+                        result = false;
+                    }
+
+                if (result)
+                    valid_++;
+                else
+                    invalid_++;
+
+                return result;
+            }
+
         private:
             StateSpace *stateSpace_;
 
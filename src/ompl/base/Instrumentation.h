@@ -0,0 +1,165 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_INSTRUMENTATION_
+#define OMPL_BASE_INSTRUMENTATION_
+
+#include "ompl/util/ClassForward.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace ompl
+{
+    namespace base
+    {
+        /// @cond IGNORE
+        /** \brief Forward declaration of ompl::base::Instrumentation */
+        OMPL_CLASS_FORWARD(Instrumentation);
+        /// @endcond
+
+        /** \class ompl::base::InstrumentationPtr
+            \brief A shared pointer wrapper for ompl::base::Instrumentation */
+
+        /** \brief Counts and times the operations planners spend most of their time in. An instance is attached to
+            a SpaceInformation (SpaceInformation::setInstrumentation()); the operations performed through that
+            instance are then recorded, for any planner. When no instance is attached, the only cost is a null
+            pointer check per operation. All members are thread safe. */
+        class Instrumentation
+        {
+        public:
+            /** \brief The recorded operations */
+            enum Event
+            {
+                /** \brief SpaceInformation::isValid() */
+                VALIDITY_CHECK = 0,
+                /** \brief SpaceInformation::checkMotion(); the time includes the validity checks performed by the
+                    motion validator */
+                MOTION_CHECK,
+                /** \brief A state sampled by a sampler allocated by SpaceInformation::allocStateSampler(); this
+                    includes the samples drawn by the valid state samplers */
+                STATE_SAMPLE,
+                /** \brief NearestNeighbors::nearest(), nearestK() and nearestR() on the datastructures allocated by
+                    tools::SelfConfig::getDefaultNearestNeighbors() */
+                NEAREST_NEIGHBOR_QUERY,
+                /** \brief An element added to the datastructures allocated by
+                    tools::SelfConfig::getDefaultNearestNeighbors() */
+                NEAREST_NEIGHBOR_INSERTION,
+                /** \brief SpaceInformation::allocState() */
+                STATE_ALLOCATION,
+                /** \brief SpaceInformation::freeState() */
+                STATE_DEALLOCATION,
+                /** \brief The number of recorded operations */
+                EVENT_COUNT
+            };
+
+            /** \brief Records the time spent in an operation between construction and destruction. Nothing is
+                recorded if the instrumentation is null. */
+            class Scope
+            {
+            public:
+                Scope(Instrumentation *instrumentation, Event event) : instrumentation_(instrumentation), event_(event)
+                {
+                    if (instrumentation_)
+                        start_ = std::chrono::steady_clock::now();
+                }
+
+                ~Scope()
+                {
+                    if (instrumentation_)
+                        instrumentation_->record(event_, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                             std::chrono::steady_clock::now() - start_)
+                                                             .count());
+                }
+
+                Scope(const Scope &) = delete;
+                Scope &operator=(const Scope &) = delete;
+
+            private:
+                Instrumentation *instrumentation_;
+                Event event_;
+                std::chrono::steady_clock::time_point start_;
+            };
+
+            Instrumentation();
+
+            // non-copyable
+            Instrumentation(const Instrumentation &) = delete;
+            Instrumentation &operator=(const Instrumentation &) = delete;
+
+            /** \brief Record \e count occurrences of \e event that took \e nanoseconds in total */
+            void record(Event event, std::uint64_t nanoseconds, std::uint64_t count = 1)
+            {
+                counters_[event].count.fetch_add(count, std::memory_order_relaxed);
+                counters_[event].nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+            }
+
+            /** \brief Get the number of times \e event was recorded */
+            std::uint64_t getCount(Event event) const
+            {
+                return counters_[event].count.load(std::memory_order_relaxed);
+            }
+
+            /** \brief Get the total time spent in \e event (seconds) */
+            double getTime(Event event) const
+            {
+                return (double)counters_[event].nanoseconds.load(std::memory_order_relaxed) * 1e-9;
+            }
+
+            /** \brief Reset all counts and times to zero */
+            void clear();
+
+            /** \brief Get a readable name for \e event, e.g., "validity check" */
+            static const char *getEventName(Event event);
+
+            /** \brief Get the plural of the name of \e event, e.g., "validity checks" */
+            static const char *getEventPluralName(Event event);
+
+            /** \brief Print the counts and times of all operations */
+            void print(std::ostream &out) const;
+
+        private:
+            struct Counter
+            {
+                std::atomic<std::uint64_t> count;
+                std::atomic<std::uint64_t> nanoseconds;
+            };
+
+            Counter counters_[EVENT_COUNT];
+        };
+    }
+}
+
+#endif
@@ -255,6 +255,17 @@ namespace ompl
             /** \brief Get the space information this planner is using */
             const SpaceInformationPtr &getSpaceInformation() const;
 
+            /** \brief Count and time the state validity checks, motion checks, samples, state allocations and
+                nearest neighbor operations of this planner, without changes to the planner. This sets \e
+                instrumentation on the space information of the planner (SpaceInformation::setInstrumentation()), so
+                the operations of other planners using the same space information are recorded as well. The
+                samplers and nearest neighbors datastructures allocated before this call are not instrumented, so it
+                should be called before setup(). */
+            void setInstrumentation(const InstrumentationPtr &instrumentation);
+
+            /** \brief Get the instrumentation recording the operations of this planner; null if none was set */
+            const InstrumentationPtr &getInstrumentation() const;
+
             /** \brief Get the problem definition the planner is trying to solve */
             const ProblemDefinitionPtr &getProblemDefinition() const;
 
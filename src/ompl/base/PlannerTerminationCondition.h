@@ -69,10 +69,16 @@ namespace ompl
             PlannerTerminationCondition(const PlannerTerminationConditionFn &fn);
 
             /** \brief Construct a termination condition that is evaluated every \e period seconds. The evaluation of
-                the condition consists of calling \e fn() in a separate thread. Calls to eval() will always return the
-                last value computed by the call to \e fn(). */
+                the condition consists of calling \e fn() in a separate thread, which is shared by all termination
+                conditions with a period and evaluates them one at a time. \e fn() should therefore return quickly;
+                a warning is issued if it takes longer than \e period. Calls to eval() will always return the last
+                value computed by the call to \e fn(). */
             PlannerTerminationCondition(const PlannerTerminationConditionFn &fn, double period);
 
+            /** \brief Construct a termination condition that becomes true at \e deadline (wall-time). The deadline
+                is signaled by a thread shared by all deadlines; once it has, eval() only reads a flag. */
+            explicit PlannerTerminationCondition(time::point deadline);
+
             ~PlannerTerminationCondition() = default;
 
             /** \brief Return true if the planner should stop its computation */
@@ -123,8 +129,9 @@ namespace ompl
         /** \brief Return a termination condition that will become true \e duration in the future (wall-time) */
         PlannerTerminationCondition timedPlannerTerminationCondition(time::duration duration);
 
-        /** \brief Return a termination condition that will become true \e duration seconds in the future (wall-time),
-         * but is checked in a separate thread, every \e interval seconds; \e interval must be less than \e duration */
+        /** \brief Return a termination condition that will become true \e duration seconds in the future (wall-time).
+         * \deprecated The deadline is signaled exactly, so \e interval is ignored. Use
+         * timedPlannerTerminationCondition(double) instead; this overload will be removed in the future. */
         PlannerTerminationCondition timedPlannerTerminationCondition(double duration, double interval);
 
         /** \brief Return a termination condition that will become true as soon as the problem definition has an exact
@@ -231,6 +231,11 @@ namespace ompl
             void computeCoordinates(const Eigen::Ref<Eigen::VectorXd> &projection,
                                     Eigen::Ref<Eigen::VectorXi> coord) const;
 
+            /** \brief Compute the range of integer coordinates (inclusive) of the grid cells that cover the
+                bounds of this projection. Returns false if no bounds are known or if the cell sizes have not been
+                set. */
+            bool computeCoordinateBounds(Eigen::VectorXi &low, Eigen::VectorXi &high) const;
+
             /** \brief Compute integer coordinates for a state */
             void computeCoordinates(const State *state, Eigen::Ref<Eigen::VectorXi> coord) const
             {
@@ -40,6 +40,7 @@
 #include "ompl/base/State.h"
 #include "ompl/base/StateValidityChecker.h"
 #include "ompl/base/MotionValidator.h"
+#include "ompl/base/Instrumentation.h"
 #include "ompl/base/StateSpace.h"
 #include "ompl/base/ValidStateSampler.h"
 
@@ -93,6 +94,7 @@ namespace ompl
             /** \brief Check if a given state is valid or not */
             bool isValid(const State *state) const
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::VALIDITY_CHECK);
                 return stateValidityChecker_->isValid(state);
             }
 
@@ -183,6 +185,22 @@ namespace ompl
                 return motionValidator_;
             }
 
+            /** \brief Set the instrumentation that records the state validity checks, motion checks, samples,
+                state allocations and nearest neighbor operations performed through this instance (see
+                Instrumentation::Event). Planners allocate their samplers and nearest neighbors datastructures in
+                setup() or in their first call to solve(), so the instrumentation needs to be set before that for
+                these to be recorded. Passing a null pointer disables the instrumentation. */
+            void setInstrumentation(const InstrumentationPtr &instrumentation)
+            {
+                instrumentation_ = instrumentation;
+            }
+
+            /** \brief Get the instrumentation set for this instance; null if none was set */
+            const InstrumentationPtr &getInstrumentation() const
+            {
+                return instrumentation_;
+            }
+
             /** \brief Set the resolution at which state validity
                 needs to be verified in order for a motion between two
                 states to be considered valid. This value is specified
@@ -224,6 +242,7 @@ namespace ompl
             /** \brief Allocate memory for a state */
             State *allocState() const
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::STATE_ALLOCATION);
                 return stateSpace_->allocState();
             }
 
@@ -231,12 +250,13 @@ namespace ompl
             void allocStates(std::vector<State *> &states) const
             {
                 for (auto &state : states)
-                    state = stateSpace_->allocState();
+                    state = allocState();
             }
 
             /** \brief Free the memory of a state */
             void freeState(State *state) const
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::STATE_DEALLOCATION);
                 stateSpace_->freeState(state);
             }
 
@@ -244,7 +264,7 @@ namespace ompl
             void freeStates(std::vector<State *> &states) const
             {
                 for (auto &state : states)
-                    stateSpace_->freeState(state);
+                    freeState(state);
             }
 
             /** \brief Copy a state to another */
@@ -264,11 +284,9 @@ namespace ompl
             /** @name Sampling of valid states
                 @{ */
 
-            /** \brief Allocate a uniform state sampler for the state space */
-            StateSamplerPtr allocStateSampler() const
-            {
-                return stateSpace_->allocStateSampler();
-            }
+            /** \brief Allocate a uniform state sampler for the state space. If an instrumentation is set, the
+                sampler records its samples in it. */
+            StateSamplerPtr allocStateSampler() const;
 
             /** \brief Allocate an instance of a valid state sampler for this space. If setValidStateSamplerAllocator()
                was previously called,
@@ -344,6 +362,7 @@ namespace ompl
                s1 to \e s2 */
             virtual bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::MOTION_CHECK);
                 return motionValidator_->checkMotion(s1, s2, lastValid);
             }
 
@@ -351,6 +370,7 @@ namespace ompl
              * This function assumes \e s1 is valid. */
             virtual bool checkMotion(const State *s1, const State *s2) const
             {
+                Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::MOTION_CHECK);
                 return motionValidator_->checkMotion(s1, s2);
             }
 
@@ -444,6 +464,9 @@ namespace ompl
              * planning process */
             MotionValidatorPtr motionValidator_;
 
+            /** \brief The optional instrumentation recording the operations performed through this instance */
+            InstrumentationPtr instrumentation_;
+
             /** \brief Flag indicating whether setup() has been called on this instance */
             bool setup_;
 
@@ -78,6 +78,12 @@ namespace ompl
             /** \brief Sample a state */
             virtual void sampleUniform(State *state) = 0;
 
+            /** \brief Sample \e count states, as if sampleUniform() were called for each of them. The default
+                implementation does exactly that; samplers can override it to amortize the virtual calls and to
+                generate the random numbers for all states at once. The sequence of samples need not match the one
+                produced by repeated calls to sampleUniform(). */
+            virtual void sampleUniformBatch(State **states, std::size_t count);
+
             /** \brief Sample a state near another, within a neighborhood controlled by a distance parameter.
 
             Typically, StateSampler-derived classes will return in `state` a
@@ -129,6 +135,9 @@ namespace ompl
 
             void sampleUniform(State *state) override;
 
+            /** \brief Call sampleUniformBatch for each subspace, on the corresponding components of \e states */
+            void sampleUniformBatch(State **states, std::size_t count) override;
+
             /** \brief Call sampleUniformNear for each of the subspace states
                 with distance scaled by the corresponding subspace weight. */
             void sampleUniformNear(State *state, const State *near, double distance) override;
@@ -147,6 +156,9 @@ namespace ompl
         private:
             /** \brief The number of samplers that are composed */
             unsigned int samplerCount_;
+
+            /** \brief Temporary storage for the components passed to the samplers in sampleUniformBatch() */
+            std::vector<State *> components_;
         };
 
         /** \brief Construct a sampler that samples only within a subspace of the space */
@@ -45,7 +45,9 @@
 #include "ompl/util/Console.h"
 #include "ompl/util/ClassForward.h"
 #include <boost/concept_check.hpp>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <string>
 #include <map>
@@ -332,6 +334,32 @@ namespace ompl
                 @e from or @e to. */
             virtual void interpolate(const State *from, const State *to, double t, State *state) const = 0;
 
+            /** \brief Compute the distances from @e state to each of the @e count states in @e others, as if
+                distance() were called for each, and store them in @e distances. The default implementation does
+                exactly that; spaces can override it to amortize the virtual calls and vectorize the computation,
+                in which case they document how far the results may deviate from distance(). */
+            virtual void distanceBatch(const State *state, const State *const *others, std::size_t count,
+                                       double *distances) const;
+
+            /** \brief Compute the states at times @e t[0], ..., @e t[count - 1] on the segment that connects
+                @e from to @e to, as if interpolate() were called for each, and store them in @e states. The default
+                implementation does exactly that; spaces can override it to compute the quantities shared by all
+                times only once. Unlike for interpolate(), @e from and @e to must not be among @e states. */
+            virtual void interpolateBatch(const State *from, const State *to, const double *t, std::size_t count,
+                                          State **states) const;
+
+            /** \brief Per-thread memory of the steering problems a space solved.
+
+                Spaces whose interpolate() has to compute a local path first
+                (e.g., a Dubins or Reeds-Shepp curve) derive from this to keep
+                the last path along with the states it connects, and store it
+                with setMotionContext(). */
+            class MotionContext
+            {
+            public:
+                virtual ~MotionContext() = default;
+            };
+
             /** \brief Allocate an instance of the default uniform state sampler for this space */
             virtual StateSamplerPtr allocDefaultStateSampler() const = 0;
 
@@ -564,9 +592,33 @@ namespace ompl
             /** \brief All the known substat locations, by name. */
             std::map<std::string, SubstateLocation> substateLocationsByName_;
 
+            /** \brief Get the motion context the calling thread stored for
+                this space with setMotionContext(), or nullptr if there is none.
+
+                validSegmentCount(), interpolate() and the motion validators
+                usually process one motion after another, so remembering the
+                last steering solution per thread and space lets them share it
+                without locking. A context is only ever seen by the thread that
+                stored it, and it is up to the space to check whether the
+                context describes the motion at hand. The context is kept per
+                instance, so a space and the spaces derived from it share it:
+                its type has to be checked (e.g., with dynamic_cast) before it
+                is used. */
+            MotionContext *getMotionContext() const;
+
+            /** \brief Store \e context as the calling thread's motion context
+                for this space, replacing any previous one, and return it. A
+                thread keeps the contexts of the few spaces that stored one
+                most recently. */
+            MotionContext *setMotionContext(std::unique_ptr<MotionContext> context) const;
+
         private:
             /** \brief State space name */
             std::string name_;
+
+            /** \brief An identifier unique to this instance, never reused, to
+                key the motion contexts */
+            std::uint64_t instanceId_;
         };
 
         /** \brief A space to allow the composition of state spaces */
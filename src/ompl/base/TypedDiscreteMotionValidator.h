@@ -0,0 +1,162 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_TYPED_DISCRETE_MOTION_VALIDATOR_
+#define OMPL_BASE_TYPED_DISCRETE_MOTION_VALIDATOR_
+
+#include "ompl/base/DiscreteMotionValidator.h"
+#include "ompl/base/StateValidityChecker.h"
+#include "ompl/util/Exception.h"
+#include <typeinfo>
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A DiscreteMotionValidator for a state space of type \e SpaceType
+            and a state validity checker of type \e CheckerType.
+
+            Motions are checked by the same algorithm as DiscreteMotionValidator
+            uses, but the state space and validity checker are called through their
+            concrete types, so the compiler can inline validSegmentCount(),
+            interpolate() and isValid() instead of dispatching virtually for
+            every intermediate state. The state space of the space information
+            must be exactly a \e SpaceType; the constructor throws otherwise,
+            since a derived type could override the functions called here.
+            If the validity checker is not exactly a \e CheckerType, for
+            instance because it was replaced after the validator was created,
+            states are checked through SpaceInformation::isValid() as usual. */
+        template <typename SpaceType, typename CheckerType>
+        class TypedDiscreteMotionValidator : public DiscreteMotionValidator
+        {
+        public:
+            /** \brief Constructor */
+            TypedDiscreteMotionValidator(SpaceInformation *si) : DiscreteMotionValidator(si)
+            {
+                defaultSettings();
+            }
+
+            /** \brief Constructor */
+            TypedDiscreteMotionValidator(const SpaceInformationPtr &si) : DiscreteMotionValidator(si)
+            {
+                defaultSettings();
+            }
+
+            ~TypedDiscreteMotionValidator() override = default;
+
+            bool checkMotion(const State *s1, const State *s2) const override
+            {
+                const CheckerType *checker = getChecker();
+                return DiscreteMotionValidator::checkMotion(
+                    Space{stateSpace_}, [this, checker](const State *state) { return isValid(checker, state); }, s1,
+                    s2);
+            }
+
+            bool checkMotion(const State *s1, const State *s2, std::pair<State *, double> &lastValid) const override
+            {
+                const CheckerType *checker = getChecker();
+                return DiscreteMotionValidator::checkMotion(
+                    Space{stateSpace_}, [this, checker](const State *state) { return isValid(checker, state); }, s1,
+                    s2, lastValid);
+            }
+
+        private:
+            /** \brief The functions of the state space used to check motions, called without virtual dispatch */
+            struct Space
+            {
+                const SpaceType *space;
+
+                unsigned int validSegmentCount(const State *s1, const State *s2) const
+                {
+                    return space->SpaceType::validSegmentCount(s1, s2);
+                }
+
+                void interpolate(const State *from, const State *to, double t, State *state) const
+                {
+                    space->SpaceType::interpolate(from, to, t, state);
+                }
+            };
+
+            /** \brief The state space, of its concrete type */
+            const SpaceType *stateSpace_;
+
+            void defaultSettings()
+            {
+                const StateSpace *space = si_->getStateSpace().get();
+                if (typeid(*space) != typeid(SpaceType))
+                    throw Exception("The state space of the typed motion validator is not of the expected type");
+                stateSpace_ = static_cast<const SpaceType *>(space);
+            }
+
+            /** \brief Get the validity checker of the space information as a
+                \e CheckerType, or nullptr if it is of some other type (including
+                types derived from \e CheckerType). The checker can be replaced
+                at any time, so this is looked up once per motion rather than
+                once per state. */
+            const CheckerType *getChecker() const
+            {
+                const StateValidityChecker *checker = si_->getStateValidityChecker().get();
+                if (checker == nullptr || typeid(*checker) != typeid(CheckerType))
+                    return nullptr;
+                return static_cast<const CheckerType *>(checker);
+            }
+
+            /** \brief Check a state the way SpaceInformation::isValid() does,
+                calling \e checker directly if it is available */
+            bool isValid(const CheckerType *checker, const State *state) const
+            {
+                if (checker == nullptr)
+                    return si_->isValid(state);
+                Instrumentation::Scope scope(si_->getInstrumentation().get(), Instrumentation::VALIDITY_CHECK);
+                return checker->CheckerType::isValid(state);
+            }
+        };
+
+        /** \brief If \e si uses the default DiscreteMotionValidator, allocate a
+            TypedDiscreteMotionValidator for \e SpaceType and \e CheckerType that
+            checks motions the same way. Otherwise, for instance if the motion
+            validator was set by the user, return nullptr. The space information
+            itself is not changed. */
+        template <typename SpaceType, typename CheckerType>
+        MotionValidatorPtr allocTypedDiscreteMotionValidator(const SpaceInformationPtr &si)
+        {
+            const MotionValidatorPtr &mv = si->getMotionValidator();
+            if (!mv || typeid(*mv) != typeid(DiscreteMotionValidator))
+                return nullptr;
+            return std::make_shared<TypedDiscreteMotionValidator<SpaceType, CheckerType>>(si);
+        }
+    }
+}
+
+#endif
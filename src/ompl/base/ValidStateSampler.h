@@ -40,6 +40,7 @@
 #include "ompl/base/State.h"
 #include "ompl/util/ClassForward.h"
 #include "ompl/base/GenericParam.h"
+#include <cstddef>
 #include <string>
 
 namespace ompl
@@ -90,6 +91,12 @@ namespace ompl
                 \note The memory for \e near must be disjoint from the memory for \e state */
             virtual bool sampleNear(State *state, const State *near, double distance) = 0;
 
+            /** \brief Sample \e count states. Each state gets as many attempts as sample() would make. The pointers
+                in \e states are reordered so that the valid samples come first; their number is returned and the
+                remaining states have unspecified contents. The default implementation calls sample() for each
+                state. */
+            virtual std::size_t sampleBatch(State **states, std::size_t count);
+
             /** \brief Finding a valid sample usually requires
                 performing multiple attempts. This call allows setting
                 the number of such attempts. */
@@ -0,0 +1,72 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_SAMPLERS_INSTRUMENTED_STATE_SAMPLER_
+#define OMPL_BASE_SAMPLERS_INSTRUMENTED_STATE_SAMPLER_
+
+#include "ompl/base/StateSampler.h"
+#include "ompl/base/Instrumentation.h"
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A state sampler that forwards all calls to another sampler and records the samples in an
+            Instrumentation instance. SpaceInformation::allocStateSampler() returns samplers of this type when an
+            instrumentation is set. */
+        class InstrumentedStateSampler : public StateSampler
+        {
+        public:
+            /** \brief Constructor */
+            InstrumentedStateSampler(const StateSpace *space, StateSamplerPtr sampler,
+                                     InstrumentationPtr instrumentation);
+
+            ~InstrumentedStateSampler() override = default;
+
+            void sampleUniform(State *state) override;
+            void sampleUniformBatch(State **states, std::size_t count) override;
+            void sampleUniformNear(State *state, const State *near, double distance) override;
+            void sampleGaussian(State *state, const State *mean, double stdDev) override;
+
+        protected:
+            /** \brief The sampler the calls are forwarded to */
+            StateSamplerPtr sampler_;
+
+            /** \brief The instrumentation the samples are recorded in */
+            InstrumentationPtr instrumentation_;
+        };
+    }
+}
+
+#endif
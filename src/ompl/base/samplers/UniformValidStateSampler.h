@@ -56,6 +56,11 @@ namespace ompl
             bool sample(State *state) override;
             bool sampleNear(State *state, const State *near, double distance) override;
 
+            /** \brief Sample all states that are still invalid with one call to
+                StateSampler::sampleUniformBatch(), check them, and repeat for the remaining ones until the
+                number of attempts is exhausted. */
+            std::size_t sampleBatch(State **states, std::size_t count) override;
+
         protected:
             /** \brief The sampler to build upon */
             StateSamplerPtr sampler_;
@@ -0,0 +1,70 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/base/samplers/InstrumentedStateSampler.h"
+#include <utility>
+
+ompl::base::InstrumentedStateSampler::InstrumentedStateSampler(const StateSpace *space, StateSamplerPtr sampler,
+                                                               InstrumentationPtr instrumentation)
+  : StateSampler(space), sampler_(std::move(sampler)), instrumentation_(std::move(instrumentation))
+{
+}
+
+void ompl::base::InstrumentedStateSampler::sampleUniform(State *state)
+{
+    Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::STATE_SAMPLE);
+    sampler_->sampleUniform(state);
+}
+
+void ompl::base::InstrumentedStateSampler::sampleUniformBatch(State **states, std::size_t count)
+{
+    auto start = std::chrono::steady_clock::now();
+    sampler_->sampleUniformBatch(states, count);
+    instrumentation_->record(
+        Instrumentation::STATE_SAMPLE,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+        count);
+}
+
+void ompl::base::InstrumentedStateSampler::sampleUniformNear(State *state, const State *near, double distance)
+{
+    Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::STATE_SAMPLE);
+    sampler_->sampleUniformNear(state, near, distance);
+}
+
+void ompl::base::InstrumentedStateSampler::sampleGaussian(State *state, const State *mean, double stdDev)
+{
+    Instrumentation::Scope scope(instrumentation_.get(), Instrumentation::STATE_SAMPLE);
+    sampler_->sampleGaussian(state, mean, stdDev);
+}
@@ -36,6 +36,7 @@
 
 #include "ompl/base/samplers/UniformValidStateSampler.h"
 #include "ompl/base/SpaceInformation.h"
+#include <utility>
 
 ompl::base::UniformValidStateSampler::UniformValidStateSampler(const SpaceInformation *si)
   : ValidStateSampler(si), sampler_(si->allocStateSampler())
@@ -68,3 +69,17 @@ bool ompl::base::UniformValidStateSampler::sampleNear(State *state, const State
     } while (!valid && attempts < attempts_);
     return valid;
 }
+
+std::size_t ompl::base::UniformValidStateSampler::sampleBatch(State **states, std::size_t count)
+{
+    // states[0, valid) have been found valid, states[valid, count) still need to be sampled
+    std::size_t valid = 0;
+    for (unsigned int attempts = 0; attempts < attempts_ && valid < count; ++attempts)
+    {
+        sampler_->sampleUniformBatch(states + valid, count - valid);
+        for (std::size_t i = valid; i < count; ++i)
+            if (si_->isValid(states[i]))
+                std::swap(states[valid++], states[i]);
+    }
+    return valid;
+}
@@ -0,0 +1,147 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_SPACES_DISTANCE_LOOKUP_TABLE_
+#define OMPL_BASE_SPACES_DISTANCE_LOOKUP_TABLE_
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A precomputed table of a distance function over a 3D box,
+            evaluated by trilinear interpolation.
+
+            This is used by state spaces whose distance depends only on the
+            relative pose of two states but is expensive to compute exactly
+            (e.g., ompl::base::DubinsStateSpace and
+            ompl::base::ReedsSheppStateSpace). The exact function is
+            evaluated at the grid nodes and, to validate each cell, also at the
+            midpoints of its edges and faces and at its center. A cell whose
+            trilinear estimate deviates from any of these samples by more than
+            the requested tolerance is marked unsafe: lookups that fall into
+            it, or outside the box, report failure so that the caller computes
+            the exact value instead. This keeps the table accurate near the
+            discontinuities of the distance function, where no interpolation
+            would be. Once built, the table is immutable and may be shared by
+            any number of threads. */
+        class DistanceLookupTable
+        {
+        public:
+            /** \brief The function to tabulate */
+            using Function = std::function<double(double, double, double)>;
+
+            /** \brief Tabulate \e fn over the box [\e lower, \e upper] with
+                \e resolution cells along each axis. */
+            DistanceLookupTable(const Function &fn, const std::array<double, 3> &lower,
+                                const std::array<double, 3> &upper, unsigned int resolution, double tolerance);
+
+            /** \brief Estimate the function at (\e x, \e y, \e z). Return
+                false if the point is outside the table or in a cell that is not
+                safe to interpolate, true otherwise. */
+            bool lookup(double x, double y, double z, double &value) const
+            {
+                const double u = (x - lower_[0]) * scale_[0];
+                const double v = (y - lower_[1]) * scale_[1];
+                const double w = (z - lower_[2]) * scale_[2];
+                // the negated comparisons also reject NaN
+                if (!(u >= 0. && v >= 0. && w >= 0. && u <= res_ && v <= res_ && w <= res_))
+                    return false;
+                const unsigned int i = std::min(static_cast<unsigned int>(u), resolution_ - 1);
+                const unsigned int j = std::min(static_cast<unsigned int>(v), resolution_ - 1);
+                const unsigned int k = std::min(static_cast<unsigned int>(w), resolution_ - 1);
+                if (!safe_[(static_cast<std::size_t>(i) * resolution_ + j) * resolution_ + k])
+                    return false;
+                const double *f = &nodes_[(static_cast<std::size_t>(i) * nodeStride_ + j) * nodeStride_ + k];
+                const std::size_t sj = nodeStride_, si = sj * nodeStride_;
+                const double corners[8] = {f[0],      f[1],      f[sj],      f[sj + 1],
+                                           f[si],     f[si + 1], f[si + sj], f[si + sj + 1]};
+                value = interpolate(corners, u - i, v - j, w - k);
+                return true;
+            }
+
+            /** \brief The number of cells along each axis */
+            unsigned int getResolution() const
+            {
+                return resolution_;
+            }
+
+            /** \brief The fraction of cells that can be interpolated */
+            double getSafeFraction() const;
+
+        private:
+            /** \brief Trilinear interpolation of the corner values \e f of a
+                cell, ordered by x, then y, then z, at local coordinates
+                (\e u, \e v, \e w) in [0,1]^3. */
+            static double interpolate(const double *f, double u, double v, double w)
+            {
+                const double f00 = f[0] + (f[1] - f[0]) * w;
+                const double f01 = f[2] + (f[3] - f[2]) * w;
+                const double f10 = f[4] + (f[5] - f[4]) * w;
+                const double f11 = f[6] + (f[7] - f[6]) * w;
+                const double f0 = f00 + (f01 - f00) * v;
+                const double f1 = f10 + (f11 - f10) * v;
+                return f0 + (f1 - f0) * u;
+            }
+
+            /** \brief The lower corner of the box */
+            std::array<double, 3> lower_;
+
+            /** \brief Cells per unit length along each axis */
+            std::array<double, 3> scale_;
+
+            /** \brief The number of cells along each axis */
+            unsigned int resolution_;
+
+            /** \brief The resolution as a double, for range checks */
+            double res_;
+
+            /** \brief The number of nodes along each axis */
+            std::size_t nodeStride_;
+
+            /** \brief The function values at the grid nodes */
+            std::vector<double> nodes_;
+
+            /** \brief Whether each cell can be interpolated */
+            std::vector<std::uint8_t> safe_;
+        };
+    }
+}
+
+#endif
@@ -39,7 +39,9 @@
 
 #include "ompl/base/spaces/SE2StateSpace.h"
 #include "ompl/base/MotionValidator.h"
+#include "ompl/base/spaces/DistanceLookupTable.h"
 #include <boost/math/constants/constants.hpp>
+#include <memory>
 
 namespace ompl
 {
@@ -60,6 +62,13 @@ namespace ompl
 
             The classification scheme described there is not actually used,
             since it only applies to “long” paths.
+
+            Evaluating all six path families is the main cost of distance().
+            setLookupTable() trades memory for speed by tabulating the
+            distance. Independently of that, the last path computed by each
+            thread is remembered, so that an interpolate() following a
+            distance() between the same pair of states does not compute it
+            again.
             */
         class DubinsStateSpace : public SE2StateSpace
         {
@@ -141,9 +150,43 @@ namespace ompl
             /** \brief Return the shortest Dubins path from SE(2) state state1 to SE(2) state state2 */
             DubinsPath dubins(const State *state1, const State *state2) const;
 
+            /** \brief Answer distance() from a precomputed table where possible.
+
+                The distance is tabulated over \e resolution cells along each
+                of the coordinates (d, α, β) of the Shkel-Lumelsky
+                parametrization, for states at most \e extent turning radii
+                apart. Each cell is validated against the exact distance at
+                build time, and cells that trilinear interpolation cannot
+                approximate to within \e tolerance turning radii, mostly those
+                crossed by a discontinuity of the Dubins distance, fall back to
+                the exact computation, as do states farther apart. A
+                resolution of 0 removes the table. Building the table takes
+                (2 * resolution + 1)^3 exact distance computations and about
+                9 * resolution^3 bytes, so it should be done before planning
+                starts; the table may then be used by any number of threads. */
+            void setLookupTable(unsigned int resolution = 48, double extent = 8., double tolerance = 1e-2);
+
+            /** \brief Check whether distance() uses a lookup table */
+            bool hasLookupTable() const
+            {
+                return lookupTable_ != nullptr;
+            }
+
+            /** \brief Get the lookup table used by distance(), if any */
+            const std::shared_ptr<const DistanceLookupTable> &getLookupTable() const
+            {
+                return lookupTable_;
+            }
+
         protected:
             virtual void interpolate(const State *from, const DubinsPath &path, double t, State *state) const;
 
+            /** \brief Return the path interpolate() follows from state1 to
+                state2: the shortest Dubins path or, for a symmetric space, the
+                reverse of the one from state2 to state1 if that is shorter.
+                The last path computed by the calling thread is reused. */
+            DubinsPath shortestPath(const State *state1, const State *state2) const;
+
             /** \brief Turning radius */
             double rho_;
 
@@ -155,6 +198,9 @@ namespace ompl
                 isSymmetric_ is true, then the distance no longer satisfies the
                 triangle inequality. */
             bool isSymmetric_;
+
+            /** \brief The distance table, if one was built */
+            std::shared_ptr<const DistanceLookupTable> lookupTable_;
         };
 
         /** \brief A Dubins motion validator that only uses the state validity checker.
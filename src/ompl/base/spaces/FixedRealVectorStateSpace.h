@@ -0,0 +1,179 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_SPACES_FIXED_REAL_VECTOR_STATE_SPACE_
+#define OMPL_BASE_SPACES_FIXED_REAL_VECTOR_STATE_SPACE_
+
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/util/Exception.h"
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A state space representing R<sup>N</sup>, with the
+            dimension N fixed at compile time.
+
+            This is a RealVectorStateSpace in every respect and can be used
+            wherever one is expected, but its states keep their values inline
+            instead of in a separately allocated array, and the operations
+            that planners call most often loop over a constant number of
+            elements, which the compiler unrolls. Dimensions cannot be added
+            to this space. */
+        template <unsigned int N>
+        class FixedRealVectorStateSpace : public RealVectorStateSpace
+        {
+        public:
+            static_assert(N > 0, "The dimension of FixedRealVectorStateSpace must be positive");
+
+            /** \brief The definition of a state in R<sup>N</sup>. The values
+                are stored in the state itself; RealVectorStateSpace::StateType::values
+                points to them. */
+            class StateType : public RealVectorStateSpace::StateType
+            {
+            public:
+                StateType()
+                {
+                    values = storage;
+                }
+
+                /** \brief A copy would point into the storage of the original. Use StateSpace::copyState() */
+                StateType(const StateType &) = delete;
+                StateType &operator=(const StateType &) = delete;
+
+                /** \brief The storage for the values of the state */
+                double storage[N];
+            };
+
+            /** \brief Constructor */
+            FixedRealVectorStateSpace() : RealVectorStateSpace(N)
+            {
+                setName("Fixed" + getName());
+            }
+
+            ~FixedRealVectorStateSpace() override = default;
+
+            void setup() override
+            {
+                if (dimension_ != N)
+                    throw Exception(getName(), "Dimensions cannot be added to a FixedRealVectorStateSpace");
+                RealVectorStateSpace::setup();
+            }
+
+            void enforceBounds(State *state) const final
+            {
+                double *v = static_cast<StateType *>(state)->storage;
+                for (unsigned int i = 0; i < N; ++i)
+                {
+                    if (v[i] > bounds_.high[i])
+                        v[i] = bounds_.high[i];
+                    else if (v[i] < bounds_.low[i])
+                        v[i] = bounds_.low[i];
+                }
+            }
+
+            bool satisfiesBounds(const State *state) const final
+            {
+                const double *v = static_cast<const StateType *>(state)->storage;
+                for (unsigned int i = 0; i < N; ++i)
+                    if (v[i] - std::numeric_limits<double>::epsilon() > bounds_.high[i] ||
+                        v[i] + std::numeric_limits<double>::epsilon() < bounds_.low[i])
+                        return false;
+                return true;
+            }
+
+            void copyState(State *destination, const State *source) const final
+            {
+                double *d = static_cast<StateType *>(destination)->storage;
+                const double *s = static_cast<const StateType *>(source)->storage;
+                for (unsigned int i = 0; i < N; ++i)
+                    d[i] = s[i];
+            }
+
+            double distance(const State *state1, const State *state2) const final
+            {
+                const double *s1 = static_cast<const StateType *>(state1)->storage;
+                const double *s2 = static_cast<const StateType *>(state2)->storage;
+                double dist = 0.0;
+                for (unsigned int i = 0; i < N; ++i)
+                {
+                    double diff = s1[i] - s2[i];
+                    dist += diff * diff;
+                }
+                return std::sqrt(dist);
+            }
+
+            bool equalStates(const State *state1, const State *state2) const final
+            {
+                const double *s1 = static_cast<const StateType *>(state1)->storage;
+                const double *s2 = static_cast<const StateType *>(state2)->storage;
+                for (unsigned int i = 0; i < N; ++i)
+                    if (std::fabs(s1[i] - s2[i]) > std::numeric_limits<double>::epsilon() * 2.0)
+                        return false;
+                return true;
+            }
+
+            void interpolate(const State *from, const State *to, double t, State *state) const final
+            {
+                const double *f = static_cast<const StateType *>(from)->storage;
+                const double *g = static_cast<const StateType *>(to)->storage;
+                double *s = static_cast<StateType *>(state)->storage;
+                for (unsigned int i = 0; i < N; ++i)
+                    s[i] = f[i] + (g[i] - f[i]) * t;
+            }
+
+            void distanceBatch(const State *state, const State *const *others, std::size_t count,
+                               double *distances) const final
+            {
+                for (std::size_t j = 0; j < count; ++j)
+                    distances[j] = distance(state, others[j]);
+            }
+
+            State *allocState() const final
+            {
+                return new StateType();
+            }
+
+            void freeState(State *state) const final
+            {
+                delete static_cast<StateType *>(state);
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,153 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_SPACES_FIXED_SE2_STATE_SPACE_
+#define OMPL_BASE_SPACES_FIXED_SE2_STATE_SPACE_
+
+#include "ompl/base/spaces/SE2StateSpace.h"
+#include "ompl/base/spaces/FixedRealVectorStateSpace.h"
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A state space representing SE(2) whose states are
+            allocated as a single block.
+
+            This is an SE2StateSpace and can be used wherever one is expected.
+            Its states, however, hold their position and rotation components
+            inline, so allocating one takes a single allocation instead of
+            four, and distance(), interpolate(), copyState() and
+            equalStates() work on the components directly instead of
+            dispatching to the subspaces. The components of its states must
+            not be freed on their own. */
+        class FixedSE2StateSpace : public SE2StateSpace
+        {
+        public:
+            /** \brief A state in SE(2): (x, y, yaw), stored inline */
+            class StateType : public SE2StateSpace::StateType
+            {
+            public:
+                StateType()
+                {
+                    componentStates_[0] = &position;
+                    componentStates_[1] = &rotation;
+                    components = componentStates_;
+                }
+
+                /** \brief The components of a copy would be those of the original. Use StateSpace::copyState() */
+                StateType(const StateType &) = delete;
+                StateType &operator=(const StateType &) = delete;
+
+                /** \brief Get the X component of the state */
+                double getX() const
+                {
+                    return position.storage[0];
+                }
+
+                /** \brief Get the Y component of the state */
+                double getY() const
+                {
+                    return position.storage[1];
+                }
+
+                /** \brief Get the yaw component of the state */
+                double getYaw() const
+                {
+                    return rotation.value;
+                }
+
+                /** \brief Set the X component of the state */
+                void setX(double x)
+                {
+                    position.storage[0] = x;
+                }
+
+                /** \brief Set the Y component of the state */
+                void setY(double y)
+                {
+                    position.storage[1] = y;
+                }
+
+                /** \brief Set the X and Y components of the state */
+                void setXY(double x, double y)
+                {
+                    position.storage[0] = x;
+                    position.storage[1] = y;
+                }
+
+                /** \brief Set the yaw component of the state */
+                void setYaw(double yaw)
+                {
+                    rotation.value = yaw;
+                }
+
+                /** \brief The position component */
+                FixedRealVectorStateSpace<2>::StateType position;
+
+                /** \brief The rotation component */
+                SO2StateSpace::StateType rotation;
+
+            private:
+                /** \brief The component array the compound state points to */
+                State *componentStates_[2];
+            };
+
+            FixedSE2StateSpace();
+
+            ~FixedSE2StateSpace() override = default;
+
+            double distance(const State *state1, const State *state2) const override;
+
+            bool equalStates(const State *state1, const State *state2) const override;
+
+            void interpolate(const State *from, const State *to, double t, State *state) const override;
+
+            void copyState(State *destination, const State *source) const override;
+
+            State *allocState() const override;
+
+            void freeState(State *state) const override;
+
+        private:
+            /** \brief The position subspace */
+            const FixedRealVectorStateSpace<2> *position_;
+
+            /** \brief The rotation subspace */
+            const SO2StateSpace *rotation_;
+        };
+    }
+}
+
+#endif
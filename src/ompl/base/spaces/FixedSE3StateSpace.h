@@ -0,0 +1,165 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_BASE_SPACES_FIXED_SE3_STATE_SPACE_
+#define OMPL_BASE_SPACES_FIXED_SE3_STATE_SPACE_
+
+#include "ompl/base/spaces/SE3StateSpace.h"
+#include "ompl/base/spaces/FixedRealVectorStateSpace.h"
+
+namespace ompl
+{
+    namespace base
+    {
+        /** \brief A state space representing SE(3) whose states are
+            allocated as a single block.
+
+            This is an SE3StateSpace and can be used wherever one is expected.
+            Its states hold their position and rotation components inline, so
+            allocating one takes a single allocation instead of four, and
+            distance(), interpolate(), copyState() and equalStates() work on
+            the components directly instead of dispatching to the subspaces.
+            The components of its states must not be freed on their own. */
+        class FixedSE3StateSpace : public SE3StateSpace
+        {
+        public:
+            /** \brief A state in SE(3): position = (x, y, z), quaternion = (x, y, z, w), stored inline */
+            class StateType : public SE3StateSpace::StateType
+            {
+            public:
+                StateType()
+                {
+                    componentStates_[0] = &position;
+                    componentStates_[1] = &orientation;
+                    components = componentStates_;
+                }
+
+                /** \brief The components of a copy would be those of the original. Use StateSpace::copyState() */
+                StateType(const StateType &) = delete;
+                StateType &operator=(const StateType &) = delete;
+
+                /** \brief Get the X component of the state */
+                double getX() const
+                {
+                    return position.storage[0];
+                }
+
+                /** \brief Get the Y component of the state */
+                double getY() const
+                {
+                    return position.storage[1];
+                }
+
+                /** \brief Get the Z component of the state */
+                double getZ() const
+                {
+                    return position.storage[2];
+                }
+
+                /** \brief Get the rotation component of the state */
+                const SO3StateSpace::StateType &rotation() const
+                {
+                    return orientation;
+                }
+
+                /** \brief Get the rotation component of the state and allow changing it as well */
+                SO3StateSpace::StateType &rotation()
+                {
+                    return orientation;
+                }
+
+                /** \brief Set the X component of the state */
+                void setX(double x)
+                {
+                    position.storage[0] = x;
+                }
+
+                /** \brief Set the Y component of the state */
+                void setY(double y)
+                {
+                    position.storage[1] = y;
+                }
+
+                /** \brief Set the Z component of the state */
+                void setZ(double z)
+                {
+                    position.storage[2] = z;
+                }
+
+                /** \brief Set the X, Y and Z components of the state */
+                void setXYZ(double x, double y, double z)
+                {
+                    position.storage[0] = x;
+                    position.storage[1] = y;
+                    position.storage[2] = z;
+                }
+
+                /** \brief The position component */
+                FixedRealVectorStateSpace<3>::StateType position;
+
+                /** \brief The rotation component */
+                SO3StateSpace::StateType orientation;
+
+            private:
+                /** \brief The component array the compound state points to */
+                State *componentStates_[2];
+            };
+
+            FixedSE3StateSpace();
+
+            ~FixedSE3StateSpace() override = default;
+
+            double distance(const State *state1, const State *state2) const override;
+
+            bool equalStates(const State *state1, const State *state2) const override;
+
+            void interpolate(const State *from, const State *to, double t, State *state) const override;
+
+            void copyState(State *destination, const State *source) const override;
+
+            State *allocState() const override;
+
+            void freeState(State *state) const override;
+
+        private:
+            /** \brief The position subspace */
+            const FixedRealVectorStateSpace<3> *position_;
+
+            /** \brief The rotation subspace */
+            const SO3StateSpace *rotation_;
+        };
+    }
+}
+
+#endif
@@ -57,6 +57,9 @@ namespace ompl
             }
 
             void sampleUniform(State *state) override;
+            /** \brief Sample \e count states, drawing all the random numbers with one call to
+                RNG::uniform01() */
+            void sampleUniformBatch(State **states, std::size_t count) override;
             /** \brief Sample a state such that each component state[i] is
                 uniformly sampled from [near[i]-distance, near[i]+distance].
                 If this interval exceeds the state space bounds, the
@@ -67,6 +70,10 @@ namespace ompl
                 deviation stdDev. If the sampled value exceeds the state
                 space boundary, it is thresholded to the nearest boundary. */
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
+
+        private:
+            /** \brief Buffer for the random numbers used by sampleUniformBatch() */
+            std::vector<double> values_;
         };
 
         /** \brief A state space representing R<sup>n</sup>. The distance function is the L2 norm. */
@@ -39,7 +39,9 @@
 
 #include "ompl/base/spaces/SE2StateSpace.h"
 #include "ompl/base/MotionValidator.h"
+#include "ompl/base/spaces/DistanceLookupTable.h"
 #include <boost/math/constants/constants.hpp>
+#include <memory>
 
 namespace ompl
 {
@@ -59,6 +61,11 @@ namespace ompl
             P. Souères and J.-P. Laumond, “Shortest paths synthesis for a
             car-like robot,” IEEE Trans. on Automatic Control, 41(5):672–688,
             May 1996.
+
+            Alternatively, setLookupTable() tabulates the distance over relative
+            poses. The last path computed by each thread is also remembered, so
+            that an interpolate() following a distance() between the same pair
+            of states does not compute it again.
             */
         class ReedsSheppStateSpace : public SE2StateSpace
         {
@@ -114,11 +121,57 @@ namespace ompl
             /** \brief Return the shortest Reeds-Shepp path from SE(2) state state1 to SE(2) state state2 */
             ReedsSheppPath reedsShepp(const State *state1, const State *state2) const;
 
+            /** \brief The Reeds-Shepp distance is a metric, but the distance
+                approximated with a lookup table is not */
+            bool isMetricSpace() const override
+            {
+                return lookupTable_ == nullptr;
+            }
+
+            /** \brief Answer distance() from a precomputed table where possible.
+
+                The distance is tabulated over \e resolution cells along each
+                coordinate of the pose (x, y, θ) of state2 relative to state1,
+                for |x|, |y| up to \e extent turning radii. Each cell is
+                validated against the exact distance at build time; cells that
+                trilinear interpolation cannot approximate to within
+                \e tolerance turning radii fall back to the exact computation,
+                as do poses outside the table. A resolution of 0 removes the
+                table. Building the table takes (2 * resolution + 1)^3 exact
+                distance computations (a few seconds at the default resolution)
+                and about 9 * resolution^3 bytes, so it should be done before
+                planning starts; the table may then be used by any number of
+                threads. The approximated distance is neither exactly symmetric
+                nor guaranteed to satisfy the triangle inequality, so the space
+                is not a metric space while it has a table (see isMetricSpace()).
+                Planners choose their nearest neighbors datastructure based on
+                this when they are set up. */
+            void setLookupTable(unsigned int resolution = 48, double extent = 8., double tolerance = 1e-2);
+
+            /** \brief Check whether distance() uses a lookup table */
+            bool hasLookupTable() const
+            {
+                return lookupTable_ != nullptr;
+            }
+
+            /** \brief Get the lookup table used by distance(), if any */
+            const std::shared_ptr<const DistanceLookupTable> &getLookupTable() const
+            {
+                return lookupTable_;
+            }
+
         protected:
             virtual void interpolate(const State *from, const ReedsSheppPath &path, double t, State *state) const;
 
+            /** \brief Same as reedsShepp(), but reuses the last path computed
+                by the calling thread if it connects the same states */
+            ReedsSheppPath shortestPath(const State *state1, const State *state2) const;
+
             /** \brief Turning radius */
             double rho_;
+
+            /** \brief The distance table, if one was built */
+            std::shared_ptr<const DistanceLookupTable> lookupTable_;
         };
 
         /** \brief A Reeds-Shepp motion validator that only uses the state validity checker.
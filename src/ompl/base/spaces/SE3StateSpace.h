@@ -135,6 +135,16 @@ namespace ompl
                 return as<RealVectorStateSpace>(0)->getBounds();
             }
 
+            /** \brief Compute the translation distances directly and the rotation distances with
+                SO3StateSpace::distanceBatch(). Spaces derived from this one use the default implementation. */
+            void distanceBatch(const State *state, const State *const *others, std::size_t count,
+                               double *distances) const override;
+
+            /** \brief Interpolate the translations directly and the rotations with
+                SO3StateSpace::interpolateBatch(). Spaces derived from this one use the default implementation. */
+            void interpolateBatch(const State *from, const State *to, const double *t, std::size_t count,
+                                  State **states) const override;
+
             State *allocState() const override;
             void freeState(State *state) const override;
 
@@ -53,6 +53,9 @@ namespace ompl
             }
 
             void sampleUniform(State *state) override;
+            /** \brief Sample \e count unit quaternions with the same method as RNG::quaternion(), drawing all
+                the random numbers with one call to RNG::uniform01() */
+            void sampleUniformBatch(State **states, std::size_t count) override;
             /** \brief To sample unit quaternions uniformly within some given
                 distance, we sample a 3-vector from the R^3 tangent space.
                 This vector is drawn uniformly random from a 3D ball centered at
@@ -73,6 +76,10 @@ namespace ompl
                 We pre-multiply this quaternion with the quaternion mean
                 to get the desired mean. */
             void sampleGaussian(State *state, const State *mean, double stdDev) override;
+
+        private:
+            /** \brief Buffer for the random numbers used by sampleUniformBatch() */
+            std::vector<double> values_;
         };
 
         /** \brief A state space representing SO(3). The internal
@@ -144,6 +151,19 @@ namespace ompl
 
             void interpolate(const State *from, const State *to, double t, State *state) const override;
 
+            /** \brief Compute the distances with a polynomial approximation of acos. The results differ from
+                distance() by at most 2.2e-8. Spaces derived from this one use the default implementation, which
+                calls their distance(). */
+            void distanceBatch(const State *state, const State *const *others, std::size_t count,
+                               double *distances) const override;
+
+            /** \brief Slerp between \e from and \e to, computing the angle between them only once. For angles
+                below 0.01 normalized linear interpolation is used instead, which deviates from slerp by less
+                than 2e-8. Spaces derived from this one use the default implementation, which calls their
+                interpolate(). */
+            void interpolateBatch(const State *from, const State *to, const double *t, std::size_t count,
+                                  State **states) const override;
+
             StateSamplerPtr allocDefaultStateSampler() const override;
 
             State *allocState() const override;
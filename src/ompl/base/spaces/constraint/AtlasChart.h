@@ -40,6 +40,7 @@
 #include "ompl/base/spaces/constraint/AtlasStateSpace.h"
 #include "ompl/datastructures/PDF.h"
 
+#include <mutex>
 #include <vector>
 #include <Eigen/Core>
 
@@ -72,11 +73,16 @@ namespace ompl
                  * lies within the halfspace. */
                 bool contains(const Eigen::Ref<const Eigen::VectorXd> &v) const;
 
-                /** \brief If point \a v on the owning chart is very close to
-                 * the halfspace boundary, the "complementary" halfspace will
-                 * extend its boundary so that it also contains \a v when \a v
-                 * is projected onto the neighboring chart. */
-                void checkNear(const Eigen::Ref<const Eigen::VectorXd> &v) const;
+                /** \brief Return whether point \a v on the owning chart is
+                 * very close to the halfspace boundary, in which case the
+                 * "complementary" halfspace should be extended to include \a v
+                 * projected onto the neighboring chart. */
+                bool isNear(const Eigen::Ref<const Eigen::VectorXd> &v) const;
+
+                /** \brief Expand the halfspace to include ambient point \a x
+                 * when it is projected onto our chart. The caller must hold
+                 * the owning chart's lock. */
+                void expandToInclude(const Eigen::Ref<const Eigen::VectorXd> &x);
 
                 /** \brief Compute up to two vertices of intersection with a
                  * circle of radius \a r.  If one vertex is found, it is stored
@@ -136,10 +142,6 @@ namespace ompl
                  * \a u_. That is, \a result * \a u_ lies on the halfspace
                  * boundary, and \a v, \a u_, \a result * \a u_ are colinear. */
                 double distanceToPoint(const Eigen::Ref<const Eigen::VectorXd> &v) const;
-
-                /** \brief Expand the halfspace to include ambient point \a x
-                 * when it is projected onto our chart. */
-                void expandToInclude(const Eigen::Ref<const Eigen::VectorXd> &x);
             };
 
         public:
@@ -202,7 +204,9 @@ namespace ompl
 
             /** \brief Check if chart point \a v lies very close to any part of
              * the boundary. Wherever it does, expand the neighboring chart's
-             * boundary to include. */
+             * boundary to include. Only one chart's lock is held at a time, so
+             * concurrent border checks on neighboring charts cannot
+             * deadlock. */
             void borderCheck(const Eigen::Ref<const Eigen::VectorXd> &v) const;
 
             /** \brief Try to find an owner for ambient point \x from among the
@@ -220,6 +224,7 @@ namespace ompl
              * halfspace boundary with. */
             std::size_t getNeighborCount() const
             {
+                std::lock_guard<std::mutex> lock(polytopeLock_);
                 return polytope_.size();
             }
 
@@ -241,11 +246,20 @@ namespace ompl
             /** \brief Set of halfspaces defining the polytope boundary. */
             std::vector<Halfspace *> polytope_;
 
+            /** \brief Lock guarding polytope_ and its halfspaces. This is one
+             * of the atlas' lock stripes, shared with other charts. */
+            std::mutex &polytopeLock_;
+
             /** \brief Introduce a new \a halfspace to the chart's bounding
              * polytope. This chart assumes responsibility for deleting \a
              * halfspace. */
             void addBoundary(Halfspace *halfspace);
 
+            /** \brief Implementation of inPolytope() for callers already
+             * holding polytopeLock_. */
+            bool inPolytopeLocked(const Eigen::Ref<const Eigen::VectorXd> &u, const Halfspace *ignore1 = nullptr,
+                                  const Halfspace *ignore2 = nullptr) const;
+
         private:
             /** \brief Dimension of the ambient space. */
             const unsigned int n_;
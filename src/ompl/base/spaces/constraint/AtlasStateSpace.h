@@ -47,6 +47,12 @@
 
 #include <boost/math/constants/constants.hpp>
 
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <mutex>
+#include <shared_mutex>
+
 namespace ompl
 {
     namespace magic
@@ -58,6 +64,7 @@ namespace ompl
         static const double ATLAS_STATE_SPACE_EXPLORATION = 0.75;
         static const unsigned int ATLAS_STATE_SPACE_MAX_CHARTS_PER_EXTENSION = 200;
         static const double ATLAS_STATE_SPACE_BACKOFF = 0.75;
+        static const unsigned int ATLAS_STATE_SPACE_CHART_LOCK_STRIPES = 64;
     }
 
     namespace base
@@ -120,6 +127,17 @@ namespace ompl
            Annual Review of Control, Robotics, and Autonomous Systems, 2018. DOI:
            <a href="http://dx.doi.org/10.1146/annurev-control-060117-105226">10.1146/annurev-control-060117-105226</a>
            <a href="http://kavrakilab.org/publications/kingston2018sampling-based-methods-for-motion-planning.pdf">[PDF]</a>.
+
+           @par Thread Safety
+           Chart lookup, sampling and creation may be called concurrently, e.g., by multithreaded planners or by
+           several planners sharing the atlas. Lookups share a reader lock on the atlas, chart creation takes it
+           exclusively only to insert the finished chart, and each chart's polytope is guarded by one of
+           ompl::magic::ATLAS_STATE_SPACE_CHART_LOCK_STRIPES striped locks. clear() must not run concurrently with
+           planning.
+
+           @par Warm Starting
+           When planning repeatedly on the same manifold, the charts discovered by one run can be written with
+           saveCharts() and restored with loadCharts(), so later runs do not need to rediscover them.
         */
 
         /** \brief ConstrainedStateSpace encapsulating a planner-agnostic atlas
@@ -313,6 +331,7 @@ namespace ompl
             /** \brief Return the number of charts currently in the atlas. */
             std::size_t getChartCount() const
             {
+                std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
                 return charts_.size();
             }
 
@@ -328,8 +347,13 @@ namespace ompl
                 @{ */
 
             /** \brief Create a new chart for the atlas, centered at \a xorigin,
-             * which should be on the manifold. Returns nullptr upon failure. */
-            AtlasChart *newChart(const StateType *state) const;
+             * which should be on the manifold. Returns nullptr upon failure. If
+             * \a owned is not null, the chart is only added if no chart owns
+             * \a state yet. This is checked while the atlas is locked for the
+             * insertion, so threads looking for the chart of states in the same
+             * region do not add duplicate charts. If a chart owns \a state, it
+             * is returned and \a owned is set to true. */
+            AtlasChart *newChart(const StateType *state, bool *owned = nullptr) const;
 
             /** \brief Pick a chart at random. */
             AtlasChart *sampleChart() const;
@@ -345,6 +369,26 @@ namespace ompl
              * true if a new chart is created. */
             AtlasChart *getChart(const StateType *state, bool force = false, bool *created = nullptr) const;
 
+            /** \brief Return the lock stripe guarding the polytope of \a chart. */
+            std::mutex &getChartLock(const AtlasChart *chart) const
+            {
+                // Charts are heap allocated; drop the alignment bits before hashing.
+                const auto key = reinterpret_cast<std::uintptr_t>(chart) >> 4;
+                return chartLocks_[key % chartLocks_.size()];
+            }
+
+            /** \brief Write the centers of all charts in the atlas to \a out,
+             * so that another atlas on the same manifold can be warm started
+             * with loadCharts(). */
+            void saveCharts(std::ostream &out) const;
+
+            /** \brief Create charts at the centers written by saveCharts().
+             * Centers that do not satisfy the constraint or are already owned
+             * by a chart are skipped. If \a anchor is true, the loaded charts
+             * persist through calls to clear(), like those created by
+             * anchorChart(). Returns the number of charts created. */
+            std::size_t loadCharts(std::istream &in, bool anchor = true) const;
+
             /** @} */
 
             /** @name Constrained Planning
@@ -382,6 +426,10 @@ namespace ompl
             /** @} */
 
         protected:
+            /** \brief Find the chart to which \a x belongs, as owningChart(),
+             * with chartsLock_ already held by the caller. */
+            AtlasChart *findOwningChart(const StateType *state) const;
+
             /** \brief Set of states on which there are anchored charts. */
             mutable std::vector<StateType *> anchors_;
 
@@ -395,6 +443,13 @@ namespace ompl
              * nearest-neighbor queries to the chart centers. */
             mutable NearestNeighborsGNAT<NNElement> chartNN_;
 
+            /** \brief Reader-writer lock guarding anchors_, charts_, chartPDF_
+             * and chartNN_. */
+            mutable std::shared_timed_mutex chartsLock_;
+
+            /** \brief Lock stripes guarding the chart polytopes. */
+            mutable std::array<std::mutex, ompl::magic::ATLAS_STATE_SPACE_CHART_LOCK_STRIPES> chartLocks_;
+
             /** @name Tunable Parameters
                 @{ */
 
@@ -426,9 +481,6 @@ namespace ompl
 
             /** \brief Enable or disable halfspace separation of the charts. */
             bool separate_;
-
-            /** \brief Random number generator. */
-            mutable RNG rng_;
         };
     }
 }
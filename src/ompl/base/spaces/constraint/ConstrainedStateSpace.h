@@ -46,12 +46,16 @@
 
 #include <Eigen/Core>
 
+#include <memory>
+#include <mutex>
+
 namespace ompl
 {
     namespace magic
     {
         static const double CONSTRAINED_STATE_SPACE_DELTA = 0.05;
         static const double CONSTRAINED_STATE_SPACE_LAMBDA = 2.0;
+        static const unsigned int CONSTRAINED_STATE_SPACE_GEODESIC_CACHE_SIZE = 64;
     }
 
     namespace base
@@ -186,6 +190,41 @@ namespace ompl
                 }
             };
 
+            /** \brief A discrete geodesic computed by discreteGeodesic(),
+             * shared by all users of the geodesic cache. */
+            class Geodesic
+            {
+            public:
+                // non-copyable
+                Geodesic(const Geodesic &) = delete;
+                Geodesic &operator=(const Geodesic &) = delete;
+
+                /** \brief Constructor. States are freed with \a space. */
+                Geodesic(const ConstrainedStateSpace *space) : space_(space)
+                {
+                }
+
+                /** \brief Destructor. Frees the states. */
+                ~Geodesic()
+                {
+                    for (auto s : states)
+                        space_->freeState(s);
+                }
+
+                /** \brief Intermediate states, as returned by discreteGeodesic(). */
+                std::vector<State *> states;
+
+                /** \brief Whether the traversal reached its target. */
+                bool reached{false};
+
+            private:
+                /** \brief Space that allocated the states. */
+                const ConstrainedStateSpace *space_;
+            };
+
+            /** \brief Shared pointer to an immutable Geodesic. */
+            using GeodesicPtr = std::shared_ptr<const Geodesic>;
+
             /** \brief Construct a constrained space from an \a ambientSpace and
              * a \a constraint. */
             ConstrainedStateSpace(const StateSpacePtr &ambientSpace, const ConstraintPtr &constraint);
@@ -258,6 +297,29 @@ namespace ompl
              * stateList. Returns a pointer to a state in \a geodesic. */
             virtual State *geodesicInterpolate(const std::vector<State *> &geodesic, double t) const;
 
+            /** \brief Return the discrete geodesic from \a from toward \a to,
+             * as discreteGeodesic() would compute it. Traversals of the same
+             * edge are shared through a cache, so interpolate(), motion
+             * validation and getMotionStates() on an edge traverse the manifold
+             * only once. Only the traversal is cached: if \a interpolate is
+             * false, the states of a cached geodesic are checked for validity
+             * again and the result is truncated at the first invalid one. */
+            GeodesicPtr getGeodesic(const State *from, const State *to, bool interpolate = false) const;
+
+            /** \brief Set the number of edges whose geodesics are cached. Zero
+             * disables the cache. Default defined by
+             * ompl::magic::CONSTRAINED_STATE_SPACE_GEODESIC_CACHE_SIZE. */
+            void setGeodesicCacheSize(unsigned int size);
+
+            /** \brief Get the number of edges whose geodesics are cached. */
+            unsigned int getGeodesicCacheSize() const
+            {
+                return geodesicCache_.size();
+            }
+
+            /** \brief Forget all cached geodesics. */
+            void clearGeodesicCache() const;
+
             /** @} */
 
             /** @name Setters and Getters
@@ -278,6 +340,7 @@ namespace ompl
                     throw ompl::Exception("ompl::base::AtlasStateSpace::setLambda(): "
                                           "lambda must be > 1.");
                 lambda_ = lambda;
+                clearGeodesicCache();
             }
 
             /** \brief Get delta, the step size across the manifold. */
@@ -337,6 +400,25 @@ namespace ompl
 
             /** \brief Whether setup() has been called. */
             bool setup_{false};
+
+        private:
+            /** \brief Compute a geodesic with discreteGeodesic(). */
+            std::shared_ptr<Geodesic> computeGeodesic(const State *from, const State *to, bool interpolate) const;
+
+            /** \brief A cached geodesic, keyed by the values of its endpoints. */
+            struct GeodesicCacheEntry
+            {
+                std::size_t hash{0};
+                Eigen::VectorXd from;
+                Eigen::VectorXd to;
+                GeodesicPtr geodesic;
+            };
+
+            /** \brief Direct-mapped cache of geodesics, indexed by endpoint hash. */
+            mutable std::vector<GeodesicCacheEntry> geodesicCache_;
+
+            /** \brief Lock guarding geodesicCache_. */
+            mutable std::mutex geodesicCacheLock_;
         };
     }
 }
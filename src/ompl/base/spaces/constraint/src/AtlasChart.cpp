@@ -58,15 +58,10 @@ bool ompl::base::AtlasChart::Halfspace::contains(const Eigen::Ref<const Eigen::V
     return v.dot(u_) <= rhs_;
 }
 
-void ompl::base::AtlasChart::Halfspace::checkNear(const Eigen::Ref<const Eigen::VectorXd> &v) const
+bool ompl::base::AtlasChart::Halfspace::isNear(const Eigen::Ref<const Eigen::VectorXd> &v) const
 {
     // Threshold is 10% of the distance from the boundary to the origin.
-    if (distanceToPoint(v) < 1.0 / 20)
-    {
-        Eigen::VectorXd x(owner_->n_);
-        owner_->psi(v, x);
-        complement_->expandToInclude(x);
-    }
+    return distanceToPoint(v) < 1.0 / 20;
 }
 
 bool ompl::base::AtlasChart::Halfspace::circleIntersect(const double r, Eigen::Ref<Eigen::VectorXd> v1,
@@ -151,6 +146,7 @@ void ompl::base::AtlasChart::Halfspace::expandToInclude(const Eigen::Ref<const E
 
 ompl::base::AtlasChart::AtlasChart(const AtlasStateSpace *atlas, const AtlasStateSpace::StateType *state)
   : constraint_(atlas->getConstraint().get())
+  , polytopeLock_(atlas->getChartLock(this))
   , n_(atlas->getAmbientDimension())
   , k_(atlas->getManifoldDimension())
   , state_(state)
@@ -176,6 +172,7 @@ ompl::base::AtlasChart::~AtlasChart()
 
 void ompl::base::AtlasChart::clear()
 {
+    std::lock_guard<std::mutex> lock(polytopeLock_);
     for (auto h : polytope_)
         delete h;
 
@@ -238,34 +235,48 @@ void ompl::base::AtlasChart::psiInverse(const Eigen::Ref<const Eigen::VectorXd>
 bool ompl::base::AtlasChart::inPolytope(const Eigen::Ref<const Eigen::VectorXd> &u, const Halfspace *const ignore1,
                                         const Halfspace *const ignore2) const
 {
-    if (u.norm() > radius_)
-        return false;
+    std::lock_guard<std::mutex> lock(polytopeLock_);
+    return inPolytopeLocked(u, ignore1, ignore2);
+}
 
-    for (Halfspace *h : polytope_)
+void ompl::base::AtlasChart::borderCheck(const Eigen::Ref<const Eigen::VectorXd> &v) const
+{
+    // Collect the complements to expand while holding our own lock only; they
+    // belong to neighboring charts, which may share our lock stripe.
+    std::vector<Halfspace *> near;
     {
-        if (h == ignore1 || h == ignore2)
-            continue;
-
-        if (!h->contains(u))
-            return false;
+        std::lock_guard<std::mutex> lock(polytopeLock_);
+        for (Halfspace *h : polytope_)
+            if (h->isNear(v))
+                near.push_back(h->getComplement());
     }
 
-    return true;
-}
+    if (near.empty())
+        return;
 
-void ompl::base::AtlasChart::borderCheck(const Eigen::Ref<const Eigen::VectorXd> &v) const
-{
-    for (Halfspace *h : polytope_)
-        h->checkNear(v);
+    Eigen::VectorXd x(n_);
+    psi(v, x);
+    for (Halfspace *h : near)
+    {
+        std::lock_guard<std::mutex> lock(h->getOwner()->polytopeLock_);
+        h->expandToInclude(x);
+    }
 }
 
 const ompl::base::AtlasChart *ompl::base::AtlasChart::owningNeighbor(const Eigen::Ref<const Eigen::VectorXd> &x) const
 {
+    std::vector<const AtlasChart *> neighbors;
+    {
+        std::lock_guard<std::mutex> lock(polytopeLock_);
+        neighbors.reserve(polytope_.size());
+        for (Halfspace *h : polytope_)
+            neighbors.push_back(h->getComplement()->getOwner());
+    }
+
     Eigen::VectorXd projx(n_), proju(k_);
-    for (Halfspace *h : polytope_)
+    for (const AtlasChart *c : neighbors)
     {
         // Project onto the neighboring chart.
-        const AtlasChart *c = h->getComplement()->getOwner();
         c->psiInverse(x, proju);
         c->phi(proju, projx);
 
@@ -290,6 +301,7 @@ bool ompl::base::AtlasChart::toPolygon(std::vector<Eigen::VectorXd> &vertices) c
     Eigen::VectorXd v(2);
     Eigen::VectorXd intersection(n_);
     vertices.clear();
+    std::lock_guard<std::mutex> lock(polytopeLock_);
     for (std::size_t i = 0; i < polytope_.size(); i++)
     {
         for (std::size_t j = i + 1; j < polytope_.size(); j++)
@@ -298,7 +310,7 @@ bool ompl::base::AtlasChart::toPolygon(std::vector<Eigen::VectorXd> &vertices) c
             // within the circle.
             Halfspace::intersect(*polytope_[i], *polytope_[j], v);
             phi(v, intersection);
-            if (inPolytope(v, polytope_[i], polytope_[j]))
+            if (inPolytopeLocked(v, polytope_[i], polytope_[j]))
                 vertices.push_back(intersection);
         }
 
@@ -306,12 +318,12 @@ bool ompl::base::AtlasChart::toPolygon(std::vector<Eigen::VectorXd> &vertices) c
         Eigen::VectorXd v1(2), v2(2);
         if ((polytope_[i])->circleIntersect(radius_, v1, v2))
         {
-            if (inPolytope(v1, polytope_[i]))
+            if (inPolytopeLocked(v1, polytope_[i]))
             {
                 phi(v1, intersection);
                 vertices.push_back(intersection);
             }
-            if (inPolytope(v2, polytope_[i]))
+            if (inPolytopeLocked(v2, polytope_[i]))
             {
                 phi(v2, intersection);
                 vertices.push_back(intersection);
@@ -328,7 +340,7 @@ bool ompl::base::AtlasChart::toPolygon(std::vector<Eigen::VectorXd> &vertices) c
     {
         const Eigen::VectorXd vn = Eigen::Rotation2Dd(a) * v0;
 
-        if (inPolytope(vn))
+        if (inPolytopeLocked(vn))
         {
             is_frontier = true;
             phi(vn, intersection);
@@ -353,12 +365,13 @@ bool ompl::base::AtlasChart::estimateIsFrontier() const
 {
     RNG rng;
     Eigen::VectorXd ru(k_);
+    std::lock_guard<std::mutex> lock(polytopeLock_);
     for (int k = 0; k < 1000; k++)
     {
         for (int i = 0; i < ru.size(); i++)
             ru[i] = rng.gaussian01();
         ru *= radius_ / ru.norm();
-        if (inPolytope(ru))
+        if (inPolytopeLocked(ru))
             return true;
     }
     return false;
@@ -386,5 +399,24 @@ void ompl::base::AtlasChart::generateHalfspace(AtlasChart *c1, AtlasChart *c2)
 
 void ompl::base::AtlasChart::addBoundary(Halfspace *halfspace)
 {
+    std::lock_guard<std::mutex> lock(polytopeLock_);
     polytope_.push_back(halfspace);
 }
+
+bool ompl::base::AtlasChart::inPolytopeLocked(const Eigen::Ref<const Eigen::VectorXd> &u,
+                                              const Halfspace *const ignore1, const Halfspace *const ignore2) const
+{
+    if (u.norm() > radius_)
+        return false;
+
+    for (Halfspace *h : polytope_)
+    {
+        if (h == ignore1 || h == ignore2)
+            continue;
+
+        if (!h->contains(u))
+            return false;
+    }
+
+    return true;
+}
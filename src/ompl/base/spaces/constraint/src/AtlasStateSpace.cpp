@@ -40,6 +40,11 @@
 #include "ompl/base/SpaceInformation.h"
 #include "ompl/util/Exception.h"
 
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+
 /// AtlasStateSampler
 
 /// Public
@@ -225,24 +230,31 @@ ompl::base::AtlasStateSpace::~AtlasStateSpace()
 
 void ompl::base::AtlasStateSpace::clear()
 {
-    // Delete the non-anchor charts
-    for (auto chart : charts_)
-        delete chart;
-    charts_.clear();
-
-    std::vector<NNElement> nnList;
-    chartNN_.list(nnList);
-    for (auto &chart : nnList)
+    std::vector<StateType *> anchors;
     {
-        const State *state = chart.first;
-        freeState(const_cast<State *>(state));
-    }
+        std::unique_lock<std::shared_timed_mutex> lock(chartsLock_);
+
+        // Delete the non-anchor charts
+        for (auto chart : charts_)
+            delete chart;
+        charts_.clear();
+
+        std::vector<NNElement> nnList;
+        chartNN_.list(nnList);
+        for (auto &chart : nnList)
+        {
+            const State *state = chart.first;
+            freeState(const_cast<State *>(state));
+        }
+
+        chartNN_.clear();
+        chartPDF_.clear();
 
-    chartNN_.clear();
-    chartPDF_.clear();
+        anchors = anchors_;
+    }
 
     // Reinstate the anchor charts
-    for (auto anchor : anchors_)
+    for (auto anchor : anchors)
         newChart(anchor);
 
     ConstrainedStateSpace::clear();
@@ -251,7 +263,10 @@ void ompl::base::AtlasStateSpace::clear()
 ompl::base::AtlasChart *ompl::base::AtlasStateSpace::anchorChart(const ompl::base::State *state) const
 {
     auto anchor = cloneState(state)->as<StateType>();
-    anchors_.push_back(anchor);
+    {
+        std::unique_lock<std::shared_timed_mutex> lock(chartsLock_);
+        anchors_.push_back(anchor);
+    }
 
     // This could fail with an exception. We cannot recover if that happens.
     AtlasChart *chart = newChart(anchor);
@@ -262,7 +277,7 @@ ompl::base::AtlasChart *ompl::base::AtlasStateSpace::anchorChart(const ompl::bas
     return chart;
 }
 
-ompl::base::AtlasChart *ompl::base::AtlasStateSpace::newChart(const StateType *state) const
+ompl::base::AtlasChart *ompl::base::AtlasStateSpace::newChart(const StateType *state, bool *owned) const
 {
     AtlasChart *chart;
     StateType *cstate = nullptr;
@@ -283,6 +298,25 @@ ompl::base::AtlasChart *ompl::base::AtlasStateSpace::newChart(const StateType *s
         return nullptr;
     }
 
+    // The chart itself is built without holding the lock; only its insertion
+    // into the atlas is exclusive.
+    std::unique_lock<std::shared_timed_mutex> lock(chartsLock_);
+
+    if (owned != nullptr)
+    {
+        // Another thread may have added a chart for this region since the
+        // caller looked for one.
+        *owned = false;
+        if (AtlasChart *owner = findOwningChart(state))
+        {
+            lock.unlock();
+            delete chart;
+            freeState(cstate);
+            *owned = true;
+            return owner;
+        }
+    }
+
     // Ensure all charts respect boundaries of the new one, and vice versa, but
     // only look at nearby ones (within 2*rho).
     if (separate_)
@@ -308,11 +342,15 @@ ompl::base::AtlasChart *ompl::base::AtlasStateSpace::newChart(const StateType *s
 
 ompl::base::AtlasChart *ompl::base::AtlasStateSpace::sampleChart() const
 {
+    // Samplers may pick charts from several threads at once.
+    static thread_local RNG rng;
+
+    std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
     if (charts_.empty())
         throw ompl::Exception("ompl::base::AtlasStateSpace::sampleChart(): "
                               "Atlas sampled before any charts were made. Use AtlasStateSpace::anchorChart() first.");
 
-    return chartPDF_.sample(rng_.uniform01());
+    return chartPDF_.sample(rng.uniform01());
 }
 
 ompl::base::AtlasChart *ompl::base::AtlasStateSpace::getChart(const StateType *state, bool force, bool *created) const
@@ -324,8 +362,9 @@ ompl::base::AtlasChart *ompl::base::AtlasStateSpace::getChart(const StateType *s
 
         if (c == nullptr)
         {
-            c = newChart(state);
-            if (created != nullptr)
+            bool owned = false;
+            c = newChart(state, &owned);
+            if (created != nullptr && !owned)
                 *created = true;
         }
 
@@ -337,6 +376,12 @@ ompl::base::AtlasChart *ompl::base::AtlasStateSpace::getChart(const StateType *s
 }
 
 ompl::base::AtlasChart *ompl::base::AtlasStateSpace::owningChart(const StateType *state) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
+    return findOwningChart(state);
+}
+
+ompl::base::AtlasChart *ompl::base::AtlasStateSpace::findOwningChart(const StateType *state) const
 {
     Eigen::VectorXd u_t(k_);
     auto temp = allocState()->as<StateType>();
@@ -498,6 +543,7 @@ bool ompl::base::AtlasStateSpace::discreteGeodesic(const State *from, const Stat
 
 double ompl::base::AtlasStateSpace::estimateFrontierPercent() const
 {
+    std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
     double frontier = 0;
     for (const AtlasChart *c : charts_)
         frontier += c->estimateIsFrontier() ? 1 : 0;
@@ -511,6 +557,7 @@ void ompl::base::AtlasStateSpace::printPLY(std::ostream &out) const
     std::size_t vcount = 0;
     std::size_t fcount = 0;
     std::vector<Eigen::VectorXd> vertices;
+    std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
     for (AtlasChart *c : charts_)
     {
         vertices.clear();
@@ -544,3 +591,81 @@ void ompl::base::AtlasStateSpace::printPLY(std::ostream &out) const
     out << "end_header\n";
     out << v.str() << f.str();
 }
+
+void ompl::base::AtlasStateSpace::saveCharts(std::ostream &out) const
+{
+    std::shared_lock<std::shared_timed_mutex> lock(chartsLock_);
+
+    const auto precision = out.precision(std::numeric_limits<double>::max_digits10);
+    out << "atlas " << n_ << " " << k_ << " " << charts_.size() << "\n";
+    for (const AtlasChart *c : charts_)
+    {
+        const StateType &origin = *c->getOrigin();
+        for (unsigned int i = 0; i < n_; ++i)
+            out << (i == 0 ? "" : " ") << origin[i];
+        out << "\n";
+    }
+    out.precision(precision);
+}
+
+std::size_t ompl::base::AtlasStateSpace::loadCharts(std::istream &in, bool anchor) const
+{
+    std::string tag;
+    unsigned int n, k;
+    std::size_t count;
+    if (!(in >> tag >> n >> k >> count) || tag != "atlas")
+    {
+        OMPL_ERROR("ompl::base::AtlasStateSpace::loadCharts(): "
+                   "Input is not a chart list written by saveCharts().");
+        return 0;
+    }
+
+    if (n != n_ || k != k_)
+    {
+        OMPL_ERROR("ompl::base::AtlasStateSpace::loadCharts(): "
+                   "Charts are for a %u-dimensional manifold in %u dimensions, but this atlas has %u in %u.",
+                   k, n, k_, n_);
+        return 0;
+    }
+
+    auto state = allocState()->as<StateType>();
+    std::size_t loaded = 0;
+    std::size_t skipped = 0;
+    for (std::size_t c = 0; c < count; ++c)
+    {
+        for (unsigned int i = 0; i < n_; ++i)
+            in >> (*state)[i];
+
+        if (!in)
+        {
+            OMPL_ERROR("ompl::base::AtlasStateSpace::loadCharts(): "
+                       "Input ended after %zu of %zu charts.",
+                       c, count);
+            break;
+        }
+
+        bool owned = false;
+        if (!constraint_->isSatisfied(state) || owningChart(state) != nullptr || newChart(state, &owned) == nullptr ||
+            owned)
+        {
+            ++skipped;
+            continue;
+        }
+
+        if (anchor)
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(chartsLock_);
+            anchors_.push_back(cloneState(state)->as<StateType>());
+        }
+
+        ++loaded;
+    }
+    freeState(state);
+
+    if (skipped > 0)
+        OMPL_INFORM("ompl::base::AtlasStateSpace::loadCharts(): "
+                    "Skipped %zu charts that are off the manifold or already in the atlas.",
+                    skipped);
+
+    return loaded;
+}
@@ -37,6 +37,7 @@
 #include "ompl/tools/config/MagicConstants.h"
 #include "ompl/base/spaces/constraint/ConstrainedStateSpace.h"
 #include "ompl/util/Exception.h"
+#include "ompl/util/Hash.h"
 
 /// ConstrainedMotionValidator
 
@@ -54,15 +55,16 @@ ompl::base::ConstrainedMotionValidator::ConstrainedMotionValidator(const SpaceIn
 
 bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const State *s2) const
 {
-    return ss_.getConstraint()->isSatisfied(s2) && ss_.discreteGeodesic(s1, s2, false);
+    return ss_.getConstraint()->isSatisfied(s2) && ss_.getGeodesic(s1, s2, false)->reached;
 }
 
 bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const State *s2,
                                                          std::pair<State *, double> &lastValid) const
 {
-    // Invoke the manifold-traversing algorithm to save intermediate states
-    std::vector<ompl::base::State *> stateList;
-    bool reached = ss_.discreteGeodesic(s1, s2, false, &stateList);
+    // Invoke the manifold-traversing algorithm to get intermediate states
+    const ConstrainedStateSpace::GeodesicPtr geodesic = ss_.getGeodesic(s1, s2, false);
+    const std::vector<State *> &stateList = geodesic->states;
+    const bool reached = geodesic->reached;
 
     // We are supposed to be able to assume that s1 is valid. However, it's not
     // on rare occasions, and I don't know why. This makes stateList empty.
@@ -76,12 +78,9 @@ bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const
     }
 
     double distanceTraveled = 0;
-    for (std::size_t i = 0; i < stateList.size() - 1; i++)
-    {
-        if (!reached)
+    if (!reached)
+        for (std::size_t i = 0; i < stateList.size() - 1; i++)
             distanceTraveled += ss_.distance(stateList[i], stateList[i + 1]);
-        ss_.freeState(stateList[i]);
-    }
 
     if (!reached && (lastValid.first != nullptr))
     {
@@ -95,7 +94,6 @@ bool ompl::base::ConstrainedMotionValidator::checkMotion(const State *s1, const
         lastValid.second = distanceTraveled / (distanceTraveled + approxDistanceRemaining);
     }
 
-    ss_.freeState(stateList.back());
     return ss_.getConstraint()->isSatisfied(s2) && reached;
 }
 
@@ -106,6 +104,7 @@ ompl::base::ConstrainedStateSpace::ConstrainedStateSpace(const StateSpacePtr &sp
   , k_(constraint_->getManifoldDimension())
 {
     setDelta(magic::CONSTRAINED_STATE_SPACE_DELTA);
+    setGeodesicCacheSize(magic::CONSTRAINED_STATE_SPACE_GEODESIC_CACHE_SIZE);
 }
 
 void ompl::base::ConstrainedStateSpace::constrainedSanityChecks(unsigned int flags) const
@@ -214,6 +213,7 @@ void ompl::base::ConstrainedStateSpace::setDelta(double delta)
         throw ompl::Exception("ompl::base::ConstrainedStateSpace::setDelta(): "
                               "delta must be positive.");
     delta_ = delta;
+    clearGeodesicCache();
 
     if (setup_)
     {
@@ -260,6 +260,7 @@ void ompl::base::ConstrainedStateSpace::setup()
 
 void ompl::base::ConstrainedStateSpace::clear()
 {
+    clearGeodesicCache();
 }
 
 ompl::base::State *ompl::base::ConstrainedStateSpace::allocState() const
@@ -271,17 +272,14 @@ void ompl::base::ConstrainedStateSpace::interpolate(const State *from, const Sta
                                                     State *state) const
 {
     // Get the list of intermediate states along the manifold.
-    std::vector<State *> geodesic;
+    const GeodesicPtr geodesic = getGeodesic(from, to, true);
 
     // Default to returning `from' if traversal fails.
     auto temp = from;
-    if (discreteGeodesic(from, to, true, &geodesic))
-        temp = geodesicInterpolate(geodesic, t);
+    if (geodesic->reached)
+        temp = geodesicInterpolate(geodesic->states, t);
 
     copyState(state, temp);
-
-    for (auto s : geodesic)
-        freeState(s);
 }
 
 ompl::base::State *ompl::base::ConstrainedStateSpace::geodesicInterpolate(const std::vector<State *> &geodesic,
@@ -316,3 +314,88 @@ ompl::base::State *ompl::base::ConstrainedStateSpace::geodesicInterpolate(const
         return (t1 < t2 || std::abs(t1 - t2) < std::numeric_limits<double>::epsilon()) ? geodesic[i] : geodesic[i + 1];
     }
 }
+
+ompl::base::ConstrainedStateSpace::GeodesicPtr ompl::base::ConstrainedStateSpace::getGeodesic(const State *from,
+                                                                                              const State *to,
+                                                                                              bool interpolate) const
+{
+    if (geodesicCache_.empty())
+        return computeGeodesic(from, to, interpolate);
+
+    auto &&x = *from->as<StateType>();
+    auto &&y = *to->as<StateType>();
+
+    std::size_t hash = 0;
+    for (unsigned int i = 0; i < n_; ++i)
+        hash_combine(hash, x[i]);
+    for (unsigned int i = 0; i < n_; ++i)
+        hash_combine(hash, y[i]);
+
+    GeodesicCacheEntry &entry = geodesicCache_[hash % geodesicCache_.size()];
+    GeodesicPtr geodesic;
+    {
+        std::lock_guard<std::mutex> lock(geodesicCacheLock_);
+        if (entry.geodesic && entry.hash == hash && entry.from == x && entry.to == y)
+            geodesic = entry.geodesic;
+    }
+
+    if (!geodesic)
+    {
+        std::shared_ptr<Geodesic> computed = computeGeodesic(from, to, interpolate);
+
+        // A traversal that stopped early may have stopped at an invalid state,
+        // so it does not describe the edge.
+        if (interpolate || computed->reached)
+        {
+            std::lock_guard<std::mutex> lock(geodesicCacheLock_);
+            entry.hash = hash;
+            entry.from = x;
+            entry.to = y;
+            entry.geodesic = computed;
+        }
+
+        return computed;
+    }
+
+    if (interpolate)
+        return geodesic;
+
+    // Validity is not cached, so that changes to the validity checker are
+    // respected. Truncate at the first invalid state.
+    auto &&svc = si_->getStateValidityChecker();
+    std::size_t valid = 0;
+    while (valid < geodesic->states.size() && svc->isValid(geodesic->states[valid]))
+        ++valid;
+
+    if (valid == geodesic->states.size())
+        return geodesic;
+
+    auto truncated = std::make_shared<Geodesic>(this);
+    truncated->states.reserve(valid);
+    for (std::size_t i = 0; i < valid; ++i)
+        truncated->states.push_back(cloneState(geodesic->states[i]));
+
+    return truncated;
+}
+
+void ompl::base::ConstrainedStateSpace::setGeodesicCacheSize(unsigned int size)
+{
+    std::lock_guard<std::mutex> lock(geodesicCacheLock_);
+    geodesicCache_.clear();
+    geodesicCache_.resize(size);
+}
+
+void ompl::base::ConstrainedStateSpace::clearGeodesicCache() const
+{
+    std::lock_guard<std::mutex> lock(geodesicCacheLock_);
+    for (auto &entry : geodesicCache_)
+        entry.geodesic.reset();
+}
+
+std::shared_ptr<ompl::base::ConstrainedStateSpace::Geodesic>
+ompl::base::ConstrainedStateSpace::computeGeodesic(const State *from, const State *to, bool interpolate) const
+{
+    auto geodesic = std::make_shared<Geodesic>(this);
+    geodesic->reached = discreteGeodesic(from, to, interpolate, &geodesic->states);
+    return geodesic;
+}
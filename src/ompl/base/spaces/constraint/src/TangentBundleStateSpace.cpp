@@ -48,6 +48,10 @@ ompl::base::TangentBundleStateSpace::TangentBundleStateSpace(const StateSpacePtr
   : AtlasStateSpace(ambientSpace, constraint, false)
 {
     setName("TangentBundle" + space_->getName());
+
+    // Lazy geodesics are projected in place by geodesicInterpolate(), so they
+    // cannot be shared through the cache.
+    setGeodesicCacheSize(0);
     setBiasFunction([&](AtlasChart *c) -> double {
         double d = 0;
         for (auto anchor : anchors_)
@@ -0,0 +1,103 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/base/spaces/DistanceLookupTable.h"
+#include "ompl/util/Exception.h"
+#include <cmath>
+#include <numeric>
+
+ompl::base::DistanceLookupTable::DistanceLookupTable(const Function &fn, const std::array<double, 3> &lower,
+                                                     const std::array<double, 3> &upper, unsigned int resolution,
+                                                     double tolerance)
+  : lower_(lower), resolution_(resolution), res_(resolution), nodeStride_(resolution + 1)
+{
+    if (resolution == 0)
+        throw Exception("DistanceLookupTable", "The resolution must be positive");
+    for (unsigned int d = 0; d < 3; ++d)
+    {
+        if (!(upper[d] > lower[d]))
+            throw Exception("DistanceLookupTable", "The upper bounds must exceed the lower bounds");
+        scale_[d] = resolution / (upper[d] - lower[d]);
+    }
+
+    // sample the function at twice the table resolution: the even samples are
+    // the grid nodes, the odd ones the edge, face and cell midpoints
+    const unsigned int n = 2 * resolution + 1;
+    std::vector<double> samples(static_cast<std::size_t>(n) * n * n);
+    std::array<double, 3> step;
+    for (unsigned int d = 0; d < 3; ++d)
+        step[d] = (upper[d] - lower[d]) / (n - 1);
+    std::size_t index = 0;
+    for (unsigned int i = 0; i < n; ++i)
+        for (unsigned int j = 0; j < n; ++j)
+            for (unsigned int k = 0; k < n; ++k)
+                samples[index++] = fn(lower[0] + i * step[0], lower[1] + j * step[1], lower[2] + k * step[2]);
+    auto sample = [&samples, n](unsigned int i, unsigned int j, unsigned int k)
+    {
+        return samples[(static_cast<std::size_t>(i) * n + j) * n + k];
+    };
+
+    nodes_.resize(nodeStride_ * nodeStride_ * nodeStride_);
+    index = 0;
+    for (unsigned int i = 0; i <= resolution; ++i)
+        for (unsigned int j = 0; j <= resolution; ++j)
+            for (unsigned int k = 0; k <= resolution; ++k)
+                nodes_[index++] = sample(2 * i, 2 * j, 2 * k);
+
+    safe_.resize(static_cast<std::size_t>(resolution) * resolution * resolution);
+    std::size_t c = 0;
+    for (unsigned int i = 0; i < resolution; ++i)
+        for (unsigned int j = 0; j < resolution; ++j)
+            for (unsigned int k = 0; k < resolution; ++k, ++c)
+            {
+                double f[8];
+                bool safe = true;
+                for (unsigned int corner = 0; corner < 8; ++corner)
+                {
+                    f[corner] = sample(2 * (i + (corner >> 2)), 2 * (j + ((corner >> 1) & 1)), 2 * (k + (corner & 1)));
+                    safe = safe && std::isfinite(f[corner]);
+                }
+                for (unsigned int di = 0; di < 3 && safe; ++di)
+                    for (unsigned int dj = 0; dj < 3 && safe; ++dj)
+                        for (unsigned int dk = 0; dk < 3 && safe; ++dk)
+                            safe = std::abs(sample(2 * i + di, 2 * j + dj, 2 * k + dk) -
+                                            interpolate(f, .5 * di, .5 * dj, .5 * dk)) <= tolerance;
+                safe_[c] = safe ? 1 : 0;
+            }
+}
+
+double ompl::base::DistanceLookupTable::getSafeFraction() const
+{
+    return static_cast<double>(std::accumulate(safe_.begin(), safe_.end(), std::size_t(0))) / safe_.size();
+}
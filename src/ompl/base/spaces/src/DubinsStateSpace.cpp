@@ -37,6 +37,7 @@
 #include "ompl/base/spaces/DubinsStateSpace.h"
 #include "ompl/base/SpaceInformation.h"
 #include "ompl/util/Exception.h"
+#include "ompl/util/Console.h"
 #include <queue>
 #include <boost/math/constants/constants.hpp>
 
@@ -201,6 +202,33 @@ namespace
             path = tmp;
         return path;
     }
+
+    // The distance in turning radii as a function of (d, alpha, beta). The
+    // path from the goal back to the start has parameters (d, beta - pi, alpha - pi).
+    double dubinsLength(double d, double alpha, double beta, bool isSymmetric)
+    {
+        double length = dubins(d, alpha, beta).length();
+        if (isSymmetric)
+        {
+            const double pi = boost::math::constants::pi<double>();
+            length = std::min(length, dubins(d, mod2pi(beta - pi), mod2pi(alpha - pi)).length());
+        }
+        return length;
+    }
+
+    // The last path DubinsStateSpace::shortestPath() computed, and the states it connects
+    struct DubinsMotionContext : public StateSpace::MotionContext
+    {
+        bool connects(const SE2StateSpace::StateType *s1, const SE2StateSpace::StateType *s2) const
+        {
+            return from[0] == s1->getX() && from[1] == s1->getY() && from[2] == s1->getYaw() &&
+                   to[0] == s2->getX() && to[1] == s2->getY() && to[2] == s2->getYaw();
+        }
+
+        double from[3];
+        double to[3];
+        DubinsStateSpace::DubinsPath path;
+    };
 }
 
 const ompl::base::DubinsStateSpace::DubinsPathSegmentType ompl::base::DubinsStateSpace::dubinsPathType[6][3] = {
@@ -213,9 +241,31 @@ const ompl::base::DubinsStateSpace::DubinsPathSegmentType ompl::base::DubinsStat
 
 double ompl::base::DubinsStateSpace::distance(const State *state1, const State *state2) const
 {
-    if (isSymmetric_)
-        return rho_ * std::min(dubins(state1, state2).length(), dubins(state2, state1).length());
-    return rho_ * dubins(state1, state2).length();
+    if (lookupTable_)
+    {
+        const auto *s1 = static_cast<const StateType *>(state1);
+        const auto *s2 = static_cast<const StateType *>(state2);
+        double dx = s2->getX() - s1->getX(), dy = s2->getY() - s1->getY();
+        double d = sqrt(dx * dx + dy * dy) / rho_, th = atan2(dy, dx), length;
+        if (lookupTable_->lookup(d, mod2pi(s1->getYaw() - th), mod2pi(s2->getYaw() - th), length))
+            return rho_ * length;
+    }
+    return rho_ * shortestPath(state1, state2).length();
+}
+
+void ompl::base::DubinsStateSpace::setLookupTable(unsigned int resolution, double extent, double tolerance)
+{
+    if (resolution == 0)
+    {
+        lookupTable_.reset();
+        return;
+    }
+    bool isSymmetric = isSymmetric_;
+    lookupTable_ = std::make_shared<DistanceLookupTable>(
+        [isSymmetric](double d, double alpha, double beta) { return dubinsLength(d, alpha, beta, isSymmetric); },
+        std::array<double, 3>{{0., 0., 0.}}, std::array<double, 3>{{extent, twopi, twopi}}, resolution, tolerance);
+    OMPL_DEBUG("%s: %.1f%% of the distance lookup table is safe to interpolate", getName().c_str(),
+               100. * lookupTable_->getSafeFraction());
 }
 
 void ompl::base::DubinsStateSpace::interpolate(const State *from, const State *to, const double t, State *state) const
@@ -243,16 +293,7 @@ void ompl::base::DubinsStateSpace::interpolate(const State *from, const State *t
             return;
         }
 
-        path = dubins(from, to);
-        if (isSymmetric_)
-        {
-            DubinsPath path2(dubins(to, from));
-            if (path2.length() < path.length())
-            {
-                path2.reverse_ = true;
-                path = path2;
-            }
-        }
+        path = shortestPath(from, to);
         firstTime = false;
     }
     interpolate(from, path, t, state);
@@ -260,30 +301,31 @@ void ompl::base::DubinsStateSpace::interpolate(const State *from, const State *t
 
 void ompl::base::DubinsStateSpace::interpolate(const State *from, const DubinsPath &path, double t, State *state) const
 {
-    auto *s = allocState()->as<StateType>();
-    double seg = t * path.length(), phi, v;
+    const auto *f = from->as<StateType>();
+    double seg = t * path.length(), x = 0., y = 0., yaw = f->getYaw(), v;
+    const double fx = f->getX(), fy = f->getY();
 
-    s->setXY(0., 0.);
-    s->setYaw(from->as<StateType>()->getYaw());
     if (!path.reverse_)
     {
         for (unsigned int i = 0; i < 3 && seg > 0; ++i)
         {
             v = std::min(seg, path.length_[i]);
-            phi = s->getYaw();
             seg -= v;
             switch (path.type_[i])
             {
                 case DUBINS_LEFT:
-                    s->setXY(s->getX() + sin(phi + v) - sin(phi), s->getY() - cos(phi + v) + cos(phi));
-                    s->setYaw(phi + v);
+                    x += sin(yaw + v) - sin(yaw);
+                    y += -cos(yaw + v) + cos(yaw);
+                    yaw += v;
                     break;
                 case DUBINS_RIGHT:
-                    s->setXY(s->getX() - sin(phi - v) + sin(phi), s->getY() + cos(phi - v) - cos(phi));
-                    s->setYaw(phi - v);
+                    x += -sin(yaw - v) + sin(yaw);
+                    y += cos(yaw - v) - cos(yaw);
+                    yaw -= v;
                     break;
                 case DUBINS_STRAIGHT:
-                    s->setXY(s->getX() + v * cos(phi), s->getY() + v * sin(phi));
+                    x += v * cos(yaw);
+                    y += v * sin(yaw);
                     break;
             }
         }
@@ -293,29 +335,30 @@ void ompl::base::DubinsStateSpace::interpolate(const State *from, const DubinsPa
         for (unsigned int i = 0; i < 3 && seg > 0; ++i)
         {
             v = std::min(seg, path.length_[2 - i]);
-            phi = s->getYaw();
             seg -= v;
             switch (path.type_[2 - i])
             {
                 case DUBINS_LEFT:
-                    s->setXY(s->getX() + sin(phi - v) - sin(phi), s->getY() - cos(phi - v) + cos(phi));
-                    s->setYaw(phi - v);
+                    x += sin(yaw - v) - sin(yaw);
+                    y += -cos(yaw - v) + cos(yaw);
+                    yaw -= v;
                     break;
                 case DUBINS_RIGHT:
-                    s->setXY(s->getX() - sin(phi + v) + sin(phi), s->getY() + cos(phi + v) - cos(phi));
-                    s->setYaw(phi + v);
+                    x += -sin(yaw + v) + sin(yaw);
+                    y += cos(yaw + v) - cos(yaw);
+                    yaw += v;
                     break;
                 case DUBINS_STRAIGHT:
-                    s->setXY(s->getX() - v * cos(phi), s->getY() - v * sin(phi));
+                    x -= v * cos(yaw);
+                    y -= v * sin(yaw);
                     break;
             }
         }
     }
-    state->as<StateType>()->setX(s->getX() * rho_ + from->as<StateType>()->getX());
-    state->as<StateType>()->setY(s->getY() * rho_ + from->as<StateType>()->getY());
+    auto *s = state->as<StateType>();
+    s->setXY(x * rho_ + fx, y * rho_ + fy);
+    s->setYaw(yaw);
     getSubspace(1)->enforceBounds(s->as<SO2StateSpace::StateType>(1));
-    state->as<StateType>()->setYaw(s->getYaw());
-    freeState(s);
 }
 
 ompl::base::DubinsStateSpace::DubinsPath ompl::base::DubinsStateSpace::dubins(const State *state1,
@@ -330,6 +373,39 @@ ompl::base::DubinsStateSpace::DubinsPath ompl::base::DubinsStateSpace::dubins(co
     return ::dubins(d, alpha, beta);
 }
 
+ompl::base::DubinsStateSpace::DubinsPath ompl::base::DubinsStateSpace::shortestPath(const State *state1,
+                                                                                    const State *state2) const
+{
+    const auto *s1 = static_cast<const StateType *>(state1);
+    const auto *s2 = static_cast<const StateType *>(state2);
+    // a derived space may keep a context of another type for this instance, which is then replaced
+    auto *context = dynamic_cast<DubinsMotionContext *>(getMotionContext());
+    if (context == nullptr)
+        context = static_cast<DubinsMotionContext *>(
+            setMotionContext(std::unique_ptr<MotionContext>(new DubinsMotionContext())));
+    else if (context->connects(s1, s2))
+        return context->path;
+
+    DubinsPath path = dubins(state1, state2);
+    if (isSymmetric_)
+    {
+        DubinsPath path2(dubins(state2, state1));
+        if (path2.length() < path.length())
+        {
+            path2.reverse_ = true;
+            path = path2;
+        }
+    }
+    context->from[0] = s1->getX();
+    context->from[1] = s1->getY();
+    context->from[2] = s1->getYaw();
+    context->to[0] = s2->getX();
+    context->to[1] = s2->getY();
+    context->to[2] = s2->getYaw();
+    context->path = path;
+    return path;
+}
+
 void ompl::base::DubinsMotionValidator::defaultSettings()
 {
     stateSpace_ = dynamic_cast<DubinsStateSpace *>(si_->getStateSpace().get());
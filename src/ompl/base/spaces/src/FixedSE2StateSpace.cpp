@@ -0,0 +1,90 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/base/spaces/FixedSE2StateSpace.h"
+
+ompl::base::FixedSE2StateSpace::FixedSE2StateSpace()
+{
+    setName("Fixed" + getName());
+    // the subspaces are fixed once the space is locked, so replace the
+    // position subspace directly
+    auto position = std::make_shared<FixedRealVectorStateSpace<2>>();
+    components_[0] = position;
+    position_ = position.get();
+    rotation_ = as<SO2StateSpace>(1);
+}
+
+double ompl::base::FixedSE2StateSpace::distance(const State *state1, const State *state2) const
+{
+    const auto *s1 = static_cast<const StateType *>(state1);
+    const auto *s2 = static_cast<const StateType *>(state2);
+    return weights_[0] * position_->FixedRealVectorStateSpace<2>::distance(&s1->position, &s2->position) +
+           weights_[1] * rotation_->SO2StateSpace::distance(&s1->rotation, &s2->rotation);
+}
+
+bool ompl::base::FixedSE2StateSpace::equalStates(const State *state1, const State *state2) const
+{
+    const auto *s1 = static_cast<const StateType *>(state1);
+    const auto *s2 = static_cast<const StateType *>(state2);
+    return position_->FixedRealVectorStateSpace<2>::equalStates(&s1->position, &s2->position) &&
+           rotation_->SO2StateSpace::equalStates(&s1->rotation, &s2->rotation);
+}
+
+void ompl::base::FixedSE2StateSpace::interpolate(const State *from, const State *to, const double t,
+                                                 State *state) const
+{
+    const auto *f = static_cast<const StateType *>(from);
+    const auto *g = static_cast<const StateType *>(to);
+    auto *s = static_cast<StateType *>(state);
+    position_->FixedRealVectorStateSpace<2>::interpolate(&f->position, &g->position, t, &s->position);
+    rotation_->SO2StateSpace::interpolate(&f->rotation, &g->rotation, t, &s->rotation);
+}
+
+void ompl::base::FixedSE2StateSpace::copyState(State *destination, const State *source) const
+{
+    auto *d = static_cast<StateType *>(destination);
+    const auto *s = static_cast<const StateType *>(source);
+    d->setXY(s->getX(), s->getY());
+    d->setYaw(s->getYaw());
+}
+
+ompl::base::State *ompl::base::FixedSE2StateSpace::allocState() const
+{
+    return new StateType();
+}
+
+void ompl::base::FixedSE2StateSpace::freeState(State *state) const
+{
+    delete static_cast<StateType *>(state);
+}
@@ -52,6 +52,22 @@ void ompl::base::RealVectorStateSampler::sampleUniform(State *state)
         rstate->values[i] = rng_.uniformReal(bounds.low[i], bounds.high[i]);
 }
 
+void ompl::base::RealVectorStateSampler::sampleUniformBatch(State **states, std::size_t count)
+{
+    const unsigned int dim = space_->getDimension();
+    const RealVectorBounds &bounds = static_cast<const RealVectorStateSpace *>(space_)->getBounds();
+
+    values_.resize(count * dim);
+    rng_.uniform01(values_.data(), values_.size());
+    const double *u = values_.data();
+    for (std::size_t j = 0; j < count; ++j, u += dim)
+    {
+        double *v = static_cast<RealVectorStateSpace::StateType *>(states[j])->values;
+        for (unsigned int i = 0; i < dim; ++i)
+            v[i] = bounds.low[i] + (bounds.high[i] - bounds.low[i]) * u[i];
+    }
+}
+
 void ompl::base::RealVectorStateSampler::sampleUniformNear(State *state, const State *near, const double distance)
 {
     const unsigned int dim = space_->getDimension();
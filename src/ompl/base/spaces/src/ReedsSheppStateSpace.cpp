@@ -37,6 +37,8 @@
 #include "ompl/base/spaces/ReedsSheppStateSpace.h"
 #include "ompl/base/SpaceInformation.h"
 #include "ompl/util/Exception.h"
+#include "ompl/util/Console.h"
+#include <cmath>
 #include <queue>
 #include <boost/math/constants/constants.hpp>
 
@@ -476,6 +478,20 @@ namespace
         CCSCC(x, y, phi, path);
         return path;
     }
+
+    // The last path ReedsSheppStateSpace::shortestPath() computed, and the states it connects
+    struct ReedsSheppMotionContext : public StateSpace::MotionContext
+    {
+        bool connects(const SE2StateSpace::StateType *s1, const SE2StateSpace::StateType *s2) const
+        {
+            return from[0] == s1->getX() && from[1] == s1->getY() && from[2] == s1->getYaw() &&
+                   to[0] == s2->getX() && to[1] == s2->getY() && to[2] == s2->getYaw();
+        }
+
+        double from[3];
+        double to[3];
+        ReedsSheppStateSpace::ReedsSheppPath path;
+    };
 }
 
 const ompl::base::ReedsSheppStateSpace::ReedsSheppPathSegmentType
@@ -514,7 +530,32 @@ ompl::base::ReedsSheppStateSpace::ReedsSheppPath::ReedsSheppPath(const ReedsShep
 
 double ompl::base::ReedsSheppStateSpace::distance(const State *state1, const State *state2) const
 {
-    return rho_ * reedsShepp(state1, state2).length();
+    if (lookupTable_)
+    {
+        const auto *s1 = static_cast<const StateType *>(state1);
+        const auto *s2 = static_cast<const StateType *>(state2);
+        double dx = s2->getX() - s1->getX(), dy = s2->getY() - s1->getY(), th = s1->getYaw();
+        double c = cos(th), s = sin(th), length;
+        if (lookupTable_->lookup((c * dx + s * dy) / rho_, (-s * dx + c * dy) / rho_,
+                                 std::remainder(s2->getYaw() - th, twopi), length))
+            return rho_ * length;
+    }
+    return rho_ * shortestPath(state1, state2).length();
+}
+
+void ompl::base::ReedsSheppStateSpace::setLookupTable(unsigned int resolution, double extent, double tolerance)
+{
+    if (resolution == 0)
+    {
+        lookupTable_.reset();
+        return;
+    }
+    lookupTable_ = std::make_shared<DistanceLookupTable>(
+        [](double x, double y, double phi) { return ::reedsShepp(x, y, phi).length(); },
+        std::array<double, 3>{{-extent, -extent, -pi}}, std::array<double, 3>{{extent, extent, pi}}, resolution,
+        tolerance);
+    OMPL_DEBUG("%s: %.1f%% of the distance lookup table is safe to interpolate", getName().c_str(),
+               100. * lookupTable_->getSafeFraction());
 }
 
 void ompl::base::ReedsSheppStateSpace::interpolate(const State *from, const State *to, const double t,
@@ -542,7 +583,7 @@ void ompl::base::ReedsSheppStateSpace::interpolate(const State *from, const Stat
                 copyState(state, from);
             return;
         }
-        path = reedsShepp(from, to);
+        path = shortestPath(from, to);
         firstTime = false;
     }
     interpolate(from, path, t, state);
@@ -551,11 +592,10 @@ void ompl::base::ReedsSheppStateSpace::interpolate(const State *from, const Stat
 void ompl::base::ReedsSheppStateSpace::interpolate(const State *from, const ReedsSheppPath &path, double t,
                                                    State *state) const
 {
-    auto *s = allocState()->as<StateType>();
-    double seg = t * path.length(), phi, v;
+    const auto *f = from->as<StateType>();
+    double seg = t * path.length(), x = 0., y = 0., yaw = f->getYaw(), v;
+    const double fx = f->getX(), fy = f->getY();
 
-    s->setXY(0., 0.);
-    s->setYaw(from->as<StateType>()->getYaw());
     for (unsigned int i = 0; i < 5 && seg > 0; ++i)
     {
         if (path.length_[i] < 0)
@@ -568,29 +608,30 @@ void ompl::base::ReedsSheppStateSpace::interpolate(const State *from, const Reed
             v = std::min(seg, path.length_[i]);
             seg -= v;
         }
-        phi = s->getYaw();
         switch (path.type_[i])
         {
             case RS_LEFT:
-                s->setXY(s->getX() + sin(phi + v) - sin(phi), s->getY() - cos(phi + v) + cos(phi));
-                s->setYaw(phi + v);
+                x += sin(yaw + v) - sin(yaw);
+                y += -cos(yaw + v) + cos(yaw);
+                yaw += v;
                 break;
             case RS_RIGHT:
-                s->setXY(s->getX() - sin(phi - v) + sin(phi), s->getY() + cos(phi - v) - cos(phi));
-                s->setYaw(phi - v);
+                x += -sin(yaw - v) + sin(yaw);
+                y += cos(yaw - v) - cos(yaw);
+                yaw -= v;
                 break;
             case RS_STRAIGHT:
-                s->setXY(s->getX() + v * cos(phi), s->getY() + v * sin(phi));
+                x += v * cos(yaw);
+                y += v * sin(yaw);
                 break;
             case RS_NOP:
                 break;
         }
     }
-    state->as<StateType>()->setX(s->getX() * rho_ + from->as<StateType>()->getX());
-    state->as<StateType>()->setY(s->getY() * rho_ + from->as<StateType>()->getY());
+    auto *s = state->as<StateType>();
+    s->setXY(x * rho_ + fx, y * rho_ + fy);
+    s->setYaw(yaw);
     getSubspace(1)->enforceBounds(s->as<SO2StateSpace::StateType>(1));
-    state->as<StateType>()->setYaw(s->getYaw());
-    freeState(s);
 }
 
 ompl::base::ReedsSheppStateSpace::ReedsSheppPath ompl::base::ReedsSheppStateSpace::reedsShepp(const State *state1,
@@ -605,6 +646,29 @@ ompl::base::ReedsSheppStateSpace::ReedsSheppPath ompl::base::ReedsSheppStateSpac
     return ::reedsShepp(x / rho_, y / rho_, phi);
 }
 
+ompl::base::ReedsSheppStateSpace::ReedsSheppPath ompl::base::ReedsSheppStateSpace::shortestPath(const State *state1,
+                                                                                                const State *state2) const
+{
+    const auto *s1 = static_cast<const StateType *>(state1);
+    const auto *s2 = static_cast<const StateType *>(state2);
+    // a derived space may keep a context of another type for this instance, which is then replaced
+    auto *context = dynamic_cast<ReedsSheppMotionContext *>(getMotionContext());
+    if (context == nullptr)
+        context = static_cast<ReedsSheppMotionContext *>(
+            setMotionContext(std::unique_ptr<MotionContext>(new ReedsSheppMotionContext())));
+    else if (context->connects(s1, s2))
+        return context->path;
+
+    context->path = reedsShepp(state1, state2);
+    context->from[0] = s1->getX();
+    context->from[1] = s1->getY();
+    context->from[2] = s1->getYaw();
+    context->to[0] = s2->getX();
+    context->to[1] = s2->getY();
+    context->to[2] = s2->getYaw();
+    return context->path;
+}
+
 void ompl::base::ReedsSheppMotionValidator::defaultSettings()
 {
     stateSpace_ = dynamic_cast<ReedsSheppStateSpace *>(si_->getStateSpace().get());
@@ -36,7 +36,68 @@
 
 #include "ompl/base/spaces/SE3StateSpace.h"
 #include "ompl/tools/config/MagicConstants.h"
+#include <cmath>
 #include <cstring>
+#include <typeinfo>
+#include <vector>
+
+void ompl::base::SE3StateSpace::distanceBatch(const State *state, const State *const *others, std::size_t count,
+                                              double *distances) const
+{
+    // a subclass may override distance(), which the computation below would not call
+    if (typeid(*this) != typeid(SE3StateSpace))
+    {
+        StateSpace::distanceBatch(state, others, count, distances);
+        return;
+    }
+
+    const auto *cstate = static_cast<const StateType *>(state);
+    const double *p = cstate->as<RealVectorStateSpace::StateType>(0)->values;
+
+    // the rotation distances are computed into distances first, and the buffer for the rotations is kept, so
+    // nothing is allocated once a thread has seen the largest batch
+    static thread_local std::vector<const State *> rotations;
+    rotations.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+        rotations[i] = static_cast<const StateType *>(others[i])->components[1];
+    components_[1]->distanceBatch(cstate->components[1], rotations.data(), count, distances);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double *q = static_cast<const StateType *>(others[i])->as<RealVectorStateSpace::StateType>(0)->values;
+        const double dx = p[0] - q[0], dy = p[1] - q[1], dz = p[2] - q[2];
+        distances[i] = weights_[0] * std::sqrt(dx * dx + dy * dy + dz * dz) + weights_[1] * distances[i];
+    }
+}
+
+void ompl::base::SE3StateSpace::interpolateBatch(const State *from, const State *to, const double *t,
+                                                 std::size_t count, State **states) const
+{
+    // a subclass may override interpolate(), which the computation below would not call
+    if (typeid(*this) != typeid(SE3StateSpace))
+    {
+        StateSpace::interpolateBatch(from, to, t, count, states);
+        return;
+    }
+
+    const auto *cfrom = static_cast<const StateType *>(from);
+    const auto *cto = static_cast<const StateType *>(to);
+    const double *p = cfrom->as<RealVectorStateSpace::StateType>(0)->values;
+    const double *q = cto->as<RealVectorStateSpace::StateType>(0)->values;
+
+    static thread_local std::vector<State *> rotations;
+    rotations.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto *cstate = static_cast<StateType *>(states[i]);
+        double *r = cstate->as<RealVectorStateSpace::StateType>(0)->values;
+        for (unsigned int j = 0; j < 3; ++j)
+            r[j] = p[j] + (q[j] - p[j]) * t[i];
+        rotations[i] = cstate->components[1];
+    }
+
+    components_[1]->interpolateBatch(cfrom->components[1], cto->components[1], t, count, rotations.data());
+}
 
 ompl::base::State *ompl::base::SE3StateSpace::allocState() const
 {
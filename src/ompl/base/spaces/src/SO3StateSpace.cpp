@@ -38,6 +38,7 @@
 #include <algorithm>
 #include <limits>
 #include <cmath>
+#include <typeinfo>
 #include "ompl/tools/config/MagicConstants.h"
 #include <boost/math/constants/constants.hpp>
 #include <boost/assert.hpp>
@@ -46,6 +47,10 @@ using namespace boost::math::double_constants;
 
 static const double MAX_QUATERNION_NORM_ERROR = 1e-9;
 
+// Below this angle, normalized linear interpolation deviates from slerp by
+// less than 2e-8 (the deviation grows as theta^3 / 62).
+static const double NLERP_MAX_ANGLE = 1e-2;
+
 /// @cond IGNORE
 namespace ompl
 {
@@ -101,6 +106,23 @@ void ompl::base::SO3StateSampler::sampleUniform(State *state)
     rng_.quaternion(&state->as<SO3StateSpace::StateType>()->x);
 }
 
+void ompl::base::SO3StateSampler::sampleUniformBatch(State **states, std::size_t count)
+{
+    values_.resize(3 * count);
+    rng_.uniform01(values_.data(), values_.size());
+    const double *u = values_.data();
+    for (std::size_t j = 0; j < count; ++j, u += 3)
+    {
+        auto *q = static_cast<SO3StateSpace::StateType *>(states[j]);
+        double r1 = std::sqrt(1.0 - u[0]), r2 = std::sqrt(u[0]);
+        double t1 = 2.0 * pi * u[1], t2 = 2.0 * pi * u[2];
+        q->x = std::sin(t1) * r1;
+        q->y = std::cos(t1) * r1;
+        q->z = std::sin(t2) * r2;
+        q->w = std::cos(t2) * r2;
+    }
+}
+
 void ompl::base::SO3StateSampler::sampleUniformNear(State *state, const State *near, const double distance)
 {
     if (distance >= .25 * pi)
@@ -260,6 +282,22 @@ namespace ompl
                 return 0.0;
             return acos(dq);
         }
+
+        /* acos on [0, 1] with absolute error below 2.2e-8, from Abramowitz and
+           Stegun, Handbook of Mathematical Functions, 4.4.46. Unlike std::acos,
+           this vectorizes. */
+        static inline double fastAcos(double x)
+        {
+            double p = -0.0012624911;
+            p = p * x + 0.0066700901;
+            p = p * x - 0.0170881256;
+            p = p * x + 0.0308918810;
+            p = p * x - 0.0501743046;
+            p = p * x + 0.0889789874;
+            p = p * x - 0.2145988016;
+            p = p * x + 1.5707963050;
+            return std::sqrt(1.0 - x) * p;
+        }
     }  // namespace base
 }  // namespace ompl
 /// @endcond
@@ -317,6 +355,92 @@ void ompl::base::SO3StateSpace::interpolate(const State *from, const State *to,
     }
 }
 
+void ompl::base::SO3StateSpace::distanceBatch(const State *state, const State *const *others, std::size_t count,
+                                              double *distances) const
+{
+    // a subclass may override distance(), which the computation below would not call
+    if (typeid(*this) != typeid(SO3StateSpace))
+    {
+        StateSpace::distanceBatch(state, others, count, distances);
+        return;
+    }
+
+    const auto *q = static_cast<const StateType *>(state);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto *p = static_cast<const StateType *>(others[i]);
+        distances[i] = fabs(q->x * p->x + q->y * p->y + q->z * p->z + q->w * p->w);
+    }
+
+    // Separate pass over contiguous memory so that the compiler vectorizes it.
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const double dq = std::min(distances[i], 1.0);
+        distances[i] = dq > 1.0 - MAX_QUATERNION_NORM_ERROR ? 0.0 : fastAcos(dq);
+    }
+}
+
+void ompl::base::SO3StateSpace::interpolateBatch(const State *from, const State *to, const double *t,
+                                                 std::size_t count, State **states) const
+{
+    // a subclass may override interpolate(), which the computation below would not call
+    if (typeid(*this) != typeid(SO3StateSpace))
+    {
+        StateSpace::interpolateBatch(from, to, t, count, states);
+        return;
+    }
+
+    const double theta = arcLength(from, to);
+    StateType q0, q1;
+    copyState(&q0, from);
+    copyState(&q1, to);
+    if (theta <= std::numeric_limits<double>::epsilon())
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            copyState(states[i], &q0);
+        return;
+    }
+
+    // Take care of long angle case see http://en.wikipedia.org/wiki/Slerp
+    if (q0.x * q1.x + q0.y * q1.y + q0.z * q1.z + q0.w * q1.w < 0)
+    {
+        q1.x = -q1.x;
+        q1.y = -q1.y;
+        q1.z = -q1.z;
+        q1.w = -q1.w;
+    }
+
+    if (theta < NLERP_MAX_ANGLE)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            auto *qr = static_cast<StateType *>(states[i]);
+            const double s0 = 1.0 - t[i], s1 = t[i];
+            qr->x = q0.x * s0 + q1.x * s1;
+            qr->y = q0.y * s0 + q1.y * s1;
+            qr->z = q0.z * s0 + q1.z * s1;
+            qr->w = q0.w * s0 + q1.w * s1;
+            const double d = 1.0 / std::sqrt(quaternionNormSquared(*qr));
+            qr->x *= d;
+            qr->y *= d;
+            qr->z *= d;
+            qr->w *= d;
+        }
+        return;
+    }
+
+    const double d = 1.0 / sin(theta);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto *qr = static_cast<StateType *>(states[i]);
+        const double s0 = sin((1.0 - t[i]) * theta), s1 = sin(t[i] * theta);
+        qr->x = (q0.x * s0 + q1.x * s1) * d;
+        qr->y = (q0.y * s0 + q1.y * s1) * d;
+        qr->z = (q0.z * s0 + q1.z * s1) * d;
+        qr->w = (q0.w * s0 + q1.w * s1) * d;
+    }
+}
+
 ompl::base::StateSamplerPtr ompl::base::SO3StateSpace::allocDefaultStateSampler() const
 {
     return std::make_shared<SO3StateSampler>(this);
@@ -47,12 +47,25 @@ void ompl::base::Constraint::jacobian(const State *state, Eigen::Ref<Eigen::Matr
     jacobian(*state->as<ConstrainedStateSpace::StateType>(), out);
 }
 
+/// @cond IGNORE
+namespace
+{
+    /** \brief Memory used by the numerical differentiation in Constraint::jacobian() */
+    struct DifferentiationWorkspace
+    {
+        Eigen::VectorXd y1, y2, t1, t2;
+    };
+}
+/// @endcond
+
 void ompl::base::Constraint::jacobian(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::MatrixXd> out) const
 {
-    Eigen::VectorXd y1 = x;
-    Eigen::VectorXd y2 = x;
-    Eigen::VectorXd t1(getCoDimension());
-    Eigen::VectorXd t2(getCoDimension());
+    static thread_local DifferentiationWorkspace ws;
+    Eigen::VectorXd &y1 = ws.y1, &y2 = ws.y2, &t1 = ws.t1, &t2 = ws.t2;
+    y1 = x;
+    y2 = x;
+    t1.resize(getCoDimension());
+    t2.resize(getCoDimension());
 
     // Use a 7-point central difference stencil on each column.
     for (std::size_t j = 0; j < n_; j++)
@@ -66,19 +79,17 @@ void ompl::base::Constraint::jacobian(const Eigen::Ref<const Eigen::VectorXd> &x
         y2[j] -= h;
         function(y1, t1);
         function(y2, t2);
-        const Eigen::VectorXd m1 = (t1 - t2) / (y1[j] - y2[j]);
+        out.col(j) = (1.5 / (y1[j] - y2[j])) * (t1 - t2);
         y1[j] += h;
         y2[j] -= h;
         function(y1, t1);
         function(y2, t2);
-        const Eigen::VectorXd m2 = (t1 - t2) / (y1[j] - y2[j]);
+        out.col(j) -= (0.6 / (y1[j] - y2[j])) * (t1 - t2);
         y1[j] += h;
         y2[j] -= h;
         function(y1, t1);
         function(y2, t2);
-        const Eigen::VectorXd m3 = (t1 - t2) / (y1[j] - y2[j]);
-
-        out.col(j) = 1.5 * m1 - 0.6 * m2 + 0.1 * m3;
+        out.col(j) += (0.1 / (y1[j] - y2[j])) * (t1 - t2);
 
         // Reset for next iteration.
         y1[j] = y2[j] = x[j];
@@ -92,23 +103,10 @@ bool ompl::base::Constraint::project(State *state) const
 
 bool ompl::base::Constraint::project(Eigen::Ref<Eigen::VectorXd> x) const
 {
-    // Newton's method
-    unsigned int iter = 0;
-    double norm = 0;
-    Eigen::VectorXd f(getCoDimension());
-    Eigen::MatrixXd j(getCoDimension(), n_);
-
-    const double squaredTolerance = tolerance_ * tolerance_;
-
-    function(x, f);
-    while ((norm = f.squaredNorm()) > squaredTolerance && iter++ < maxIterations_)
-    {
-        jacobian(x, j);
-        x -= j.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV).solve(f);
-        function(x, f);
-    }
-
-    return norm < squaredTolerance;
+    // the memory is kept for each thread, as constraints are shared by the threads of a planner
+    static thread_local ProjectionWorkspace<> ws;
+    ws.resize(n_, getCoDimension());
+    return projectNewton(x, ws);
 }
 
 double ompl::base::Constraint::distance(const State *state) const
@@ -0,0 +1,79 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/base/Instrumentation.h"
+
+ompl::base::Instrumentation::Instrumentation()
+{
+    clear();
+}
+
+void ompl::base::Instrumentation::clear()
+{
+    for (auto &counter : counters_)
+    {
+        counter.count.store(0, std::memory_order_relaxed);
+        counter.nanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+const char *ompl::base::Instrumentation::getEventName(Event event)
+{
+    static const char *names[EVENT_COUNT] = {"validity check", "motion check", "state sample",
+                                             "nearest neighbor query", "nearest neighbor insertion",
+                                             "state allocation", "state deallocation"};
+    return event < EVENT_COUNT ? names[event] : "unknown";
+}
+
+const char *ompl::base::Instrumentation::getEventPluralName(Event event)
+{
+    static const char *names[EVENT_COUNT] = {"validity checks", "motion checks", "state samples",
+                                             "nearest neighbor queries", "nearest neighbor insertions",
+                                             "state allocations", "state deallocations"};
+    return event < EVENT_COUNT ? names[event] : "unknown";
+}
+
+void ompl::base::Instrumentation::print(std::ostream &out) const
+{
+    for (int i = 0; i < EVENT_COUNT; ++i)
+    {
+        auto event = static_cast<Event>(i);
+        std::uint64_t count = getCount(event);
+        double time = getTime(event);
+        out << getEventName(event) << ": " << count << " in " << time << " seconds";
+        if (count > 0)
+            out << " (" << 1e6 * time / (double)count << " us each)";
+        out << std::endl;
+    }
+}
@@ -68,6 +68,20 @@ const ompl::base::SpaceInformationPtr &ompl::base::Planner::getSpaceInformation(
     return si_;
 }
 
+void ompl::base::Planner::setInstrumentation(const InstrumentationPtr &instrumentation)
+{
+    if (setup_ && instrumentation)
+        OMPL_WARN("%s: Instrumentation set after setup; samplers and nearest neighbors datastructures that were "
+                  "already allocated are not instrumented",
+                  getName().c_str());
+    si_->setInstrumentation(instrumentation);
+}
+
+const ompl::base::InstrumentationPtr &ompl::base::Planner::getInstrumentation() const
+{
+    return si_->getInstrumentation();
+}
+
 const ompl::base::ProblemDefinitionPtr &ompl::base::Planner::getProblemDefinition() const
 {
     return pdef_;
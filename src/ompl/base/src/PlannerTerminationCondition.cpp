@@ -35,123 +35,304 @@
 /* Author: Ioan Sucan */
 
 #include "ompl/base/PlannerTerminationCondition.h"
+#include "ompl/util/Console.h"
 #include "ompl/util/Time.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <queue>
 #include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
 
 namespace ompl
 {
     namespace base
     {
         /// @cond IGNORE
+        namespace
+        {
+            class ConditionService;
+        }
+
         class PlannerTerminationCondition::PlannerTerminationConditionImpl
         {
         public:
-            PlannerTerminationConditionImpl(PlannerTerminationConditionFn fn, double period)
-              : fn_(std::move(fn))
-              , period_(period)
-              , terminate_(false)
-              , thread_(nullptr)
-              , evalValue_(false)
-              , signalThreadStop_(false)
-            {
-                if (period_ > 0.0)
-                    startEvalThread();
-            }
+            PlannerTerminationConditionImpl(PlannerTerminationConditionFn fn, double period);
 
-            ~PlannerTerminationConditionImpl()
-            {
-                stopEvalThread();
-            }
+            PlannerTerminationConditionImpl(time::point deadline);
+
+            ~PlannerTerminationConditionImpl();
 
             bool eval() const
             {
                 if (terminate_)
                     return true;
-                if (period_ > 0.0)
-                    return evalValue_;
+                if (scheduled_)
+                    // the service signals a deadline as soon as its thread runs, which can be late on a busy
+                    // machine; until it has, the clock is read here as well
+                    return evalValue_ || (hasDeadline_ && time::now() > deadline_);
                 return fn_();
             }
 
             void terminate() const
             {
-                // it is ok to have unprotected write here
                 terminate_ = true;
             }
 
-        private:
-            /** \brief Start the thread evaluating termination conditions if not already started */
-            void startEvalThread()
+            /** \brief Called by the ConditionService when the condition is due: update the cached value and
+                return the number of seconds until the next call (or a negative value for no more calls) */
+            double fire()
             {
-                if (thread_ == nullptr)
+                if (!fn_)
                 {
-                    signalThreadStop_ = false;
-                    evalValue_ = false;
-                    thread_ = new std::thread([this]
-                                              {
-                                                  periodicEval();
-                                              });
+                    evalValue_ = true;
+                    return -1.0;
                 }
+                if (terminate_)
+                    return -1.0;
+                time::point start = time::now();
+                evalValue_ = fn_();
+                double duration = time::seconds(time::now() - start);
+                if (duration > period_ && !warned_)
+                {
+                    warned_ = true;
+                    OMPL_WARN("Evaluating a termination condition took %g seconds, longer than its period of %g "
+                              "seconds. Conditions with a period are evaluated one at a time by a shared thread, so "
+                              "this delays the evaluation of the others.",
+                              duration, period_);
+                }
+                return period_;
             }
 
-            /** \brief Stop the thread evaluating termination conditions if not already stopped */
-            void stopEvalThread()
+        private:
+            /** \brief Function pointer to the piece of code that decides whether a termination condition has been met
+             */
+            PlannerTerminationConditionFn fn_;
+
+            /** \brief Interval of time (seconds) to wait between calls to fn_() */
+            double period_;
+
+            /** \brief Flag indicating whether the user has externally requested that the condition for termination
+             * should become true */
+            mutable std::atomic<bool> terminate_;
+
+            /** \brief Whether the value of the condition is computed by the ConditionService */
+            bool scheduled_;
+
+            /** \brief Value computed by the ConditionService */
+            std::atomic<bool> evalValue_;
+
+            /** \brief Whether this condition becomes true at deadline_ */
+            bool hasDeadline_{false};
+
+            /** \brief The time at which a deadline condition becomes true */
+            time::point deadline_;
+
+            /** \brief Whether a warning was issued because fn_() took longer than period_ */
+            bool warned_{false};
+
+            /** \brief The ConditionService this condition is registered with */
+            ConditionService *service_{nullptr};
+
+            /** \brief The registration of this condition with service_ */
+            std::uint64_t id_;
+        };
+
+        namespace
+        {
+            /** \brief A thread that serves the termination conditions which are not evaluated by the planner
+                itself. There are two services: one signals deadlines when they are reached, and one evaluates the
+                conditions with a period on schedule. User code only runs on the second, so a slow condition
+                cannot delay a deadline; it does delay the other conditions with a period, which are evaluated
+                one at a time. Conditions only read an atomic flag when the planner evaluates them (and the clock,
+                for a deadline that has not been signaled yet), and any number of them can be active without
+                starting a thread per condition. */
+            class ConditionService
             {
-                signalThreadStop_ = true;
-                if (thread_ != nullptr)
+            public:
+                /** \brief The service that signals deadlines */
+                static ConditionService &deadlines()
                 {
-                    thread_->join();
-                    delete thread_;
-                    thread_ = nullptr;
+                    // never destroyed, so conditions can still be released during static destruction
+                    static auto *service = new ConditionService(0);
+                    return *service;
                 }
-            }
 
-            /** \brief Worker function that runs in a separate thread (calls computeEval())*/
-            void periodicEval()
-            {
-                // we want to check for termination at least once every ms;
-                // even though we may evaluate the condition itself more rarely
+                /** \brief The service that evaluates conditions with a period */
+                static ConditionService &periodic()
+                {
+                    static auto *service = new ConditionService(1);
+                    return *service;
+                }
 
-                unsigned int count = 1;
-                time::duration s = time::seconds(period_);
-                if (period_ > 0.001)
+                /** \brief Call \e fire() at \e when, and again after the number of seconds it returns, until it
+                    returns a negative value */
+                std::uint64_t add(std::function<double()> fire, time::point when)
                 {
-                    count = 0.5 + period_ / 0.001;
-                    s = time::seconds(period_ / (double)count);
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    std::uint64_t id = nextId_++;
+                    active_[id] = std::move(fire);
+                    queue_.push(Entry{when, id});
+                    wakeup_.notify_one();
+                    return id;
                 }
 
-                while (!terminate_ && !signalThreadStop_)
+                /** \brief Stop calling the condition registered as \e id. If the condition is being evaluated,
+                    wait for the evaluation to finish. */
+                void remove(std::uint64_t id)
                 {
-                    evalValue_ = fn_();
-                    for (unsigned int i = 0; i < count; ++i)
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    active_.erase(id);
+                    done_.wait(lock, [this, id] { return current_ != id; });
+                }
+
+            private:
+                struct Entry
+                {
+                    time::point when;
+                    std::uint64_t id;
+
+                    bool operator>(const Entry &other) const
                     {
-                        if (terminate_ || signalThreadStop_)
-                            break;
-                        std::this_thread::sleep_for(s);
+                        return when > other.when;
                     }
+                };
+
+                ConditionService(unsigned int slot)
+                {
+                    services()[slot] = this;
+                    std::thread([this] { serve(); }).detach();
+    #if defined(__unix__) || defined(__APPLE__)
+                    // keep serving the conditions in a forked child, which only has the thread that called fork()
+                    static std::once_flag atFork;
+                    std::call_once(atFork, [] {
+                        pthread_atfork([] { forEachService([](ConditionService *s) { s->mutex_.lock(); }); },
+                                       [] { forEachService([](ConditionService *s) { s->mutex_.unlock(); }); },
+                                       [] { forEachService([](ConditionService *s) { s->restartAfterFork(); }); });
+                    });
+    #endif
                 }
-            }
 
-            /** \brief Function pointer to the piece of code that decides whether a termination condition has been met
-             */
-            PlannerTerminationConditionFn fn_;
+                /** \brief The services created so far */
+                static std::atomic<ConditionService *> *services()
+                {
+                    static std::atomic<ConditionService *> created[2] = {{nullptr}, {nullptr}};
+                    return created;
+                }
 
-            /** \brief Interval of time (seconds) to wait between calls to computeEval() */
-            double period_;
+                template <typename F>
+                static void forEachService(const F &f)
+                {
+                    for (unsigned int i = 0; i < 2; ++i)
+                        if (ConditionService *service = services()[i])
+                            f(service);
+                }
 
-            /** \brief Flag indicating whether the user has externally requested that the condition for termination
-             * should become true */
-            mutable bool terminate_;
+                void restartAfterFork()
+                {
+                    // the condition that was being evaluated when the process forked is due again
+                    if (current_ != 0u && active_.count(current_) != 0u)
+                        queue_.push(Entry{time::now(), current_});
+                    current_ = 0;
+                    // threads that were waiting on these in the parent do not exist here
+                    new (&wakeup_) std::condition_variable();
+                    new (&done_) std::condition_variable();
+                    mutex_.unlock();
+                    std::thread([this] { serve(); }).detach();
+                }
 
-            /** \brief Thread for periodicEval() */
-            std::thread *thread_;
+                void serve()
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    while (true)
+                    {
+                        if (queue_.empty())
+                        {
+                            wakeup_.wait(lock);
+                            continue;
+                        }
+                        Entry entry = queue_.top();
+                        auto it = active_.find(entry.id);
+                        if (it == active_.end())
+                        {
+                            queue_.pop();
+                            continue;
+                        }
+                        if (time::now() < entry.when)
+                        {
+                            wakeup_.wait_until(lock, entry.when);
+                            continue;
+                        }
+                        queue_.pop();
 
-            /** \brief Cached value returned by fn_() */
-            bool evalValue_;
+                        // evaluate without holding the lock; remove() waits for this to finish
+                        std::function<double()> fire = it->second;
+                        current_ = entry.id;
+                        lock.unlock();
+                        double next = fire();
+                        lock.lock();
+                        current_ = 0;
+                        done_.notify_all();
 
-            /** \brief Flag used to signal the condition evaluation thread to stop. */
-            bool signalThreadStop_;
-        };
+                        if (next < 0.0)
+                            active_.erase(entry.id);
+                        else if (active_.count(entry.id) != 0u)
+                            queue_.push(Entry{time::now() + time::seconds(next), entry.id});
+                    }
+                }
+
+                std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue_;
+                std::unordered_map<std::uint64_t, std::function<double()>> active_;
+                std::uint64_t nextId_{1};
+                std::uint64_t current_{0};
+                std::mutex mutex_;
+                std::condition_variable wakeup_;
+                std::condition_variable done_;
+            };
+        }
+
+        PlannerTerminationCondition::PlannerTerminationConditionImpl::PlannerTerminationConditionImpl(
+            PlannerTerminationConditionFn fn, double period)
+          : fn_(std::move(fn)), period_(period), terminate_(false), scheduled_(period > 0.0), evalValue_(false), id_(0)
+        {
+            if (scheduled_)
+            {
+                service_ = &ConditionService::periodic();
+                id_ = service_->add([this] { return fire(); }, time::now());
+            }
+        }
+
+        PlannerTerminationCondition::PlannerTerminationConditionImpl::PlannerTerminationConditionImpl(
+            time::point deadline)
+          : period_(-1.0)
+          , terminate_(false)
+          , scheduled_(true)
+          , evalValue_(false)
+          , hasDeadline_(true)
+          , deadline_(deadline)
+          , id_(0)
+        {
+            if (time::now() < deadline)
+            {
+                service_ = &ConditionService::deadlines();
+                id_ = service_->add([this] { return fire(); }, deadline);
+            }
+            else
+                evalValue_ = true;
+        }
+
+        PlannerTerminationCondition::PlannerTerminationConditionImpl::~PlannerTerminationConditionImpl()
+        {
+            if (id_ != 0u)
+                service_->remove(id_);
+        }
 
         /// @endcond
     }
@@ -168,6 +349,11 @@ ompl::base::PlannerTerminationCondition::PlannerTerminationCondition(const Plann
 {
 }
 
+ompl::base::PlannerTerminationCondition::PlannerTerminationCondition(time::point deadline)
+  : impl_(std::make_shared<PlannerTerminationConditionImpl>(deadline))
+{
+}
+
 void ompl::base::PlannerTerminationCondition::terminate() const
 {
     impl_->terminate();
@@ -219,23 +405,14 @@ ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondi
 
 ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(time::duration duration)
 {
-    const time::point endTime(time::now() + duration);
-    return PlannerTerminationCondition([endTime]
-                                       {
-                                           return time::now() > endTime;
-                                       });
+    return PlannerTerminationCondition(time::now() + duration);
 }
 
-ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(double duration, double interval)
+ompl::base::PlannerTerminationCondition ompl::base::timedPlannerTerminationCondition(double duration,
+                                                                                     double /*interval*/)
 {
-    if (interval > duration)
-        interval = duration;
-    const time::point endTime(time::now() + time::seconds(duration));
-    return PlannerTerminationCondition([endTime]
-                                       {
-                                           return time::now() > endTime;
-                                       },
-                                       interval);
+    // the deadline is signaled exactly, so there is no need to check it periodically
+    return timedPlannerTerminationCondition(time::seconds(duration));
 }
 
 ompl::base::PlannerTerminationCondition
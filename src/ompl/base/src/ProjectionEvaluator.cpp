@@ -296,6 +296,23 @@ void ompl::base::ProjectionEvaluator::computeCoordinates(const Eigen::Ref<Eigen:
     computeCoordinatesHelper(cellSizes_, projection, coord);
 }
 
+bool ompl::base::ProjectionEvaluator::computeCoordinateBounds(Eigen::VectorXi &low, Eigen::VectorXi &high) const
+{
+    const unsigned int dim = getDimension();
+    if (!hasBounds() || bounds_.low.size() != dim || cellSizes_.size() != dim)
+        return false;
+    for (unsigned int i = 0; i < dim; ++i)
+        if (!std::isfinite(bounds_.low[i]) || !std::isfinite(bounds_.high[i]))
+            return false;
+    low.resize(dim);
+    high.resize(dim);
+    Eigen::VectorXd corner = Eigen::Map<const Eigen::VectorXd>(bounds_.low.data(), dim);
+    computeCoordinatesHelper(cellSizes_, corner, low);
+    corner = Eigen::Map<const Eigen::VectorXd>(bounds_.high.data(), dim);
+    computeCoordinatesHelper(cellSizes_, corner, high);
+    return true;
+}
+
 void ompl::base::ProjectionEvaluator::printSettings(std::ostream &out) const
 {
     out << "Projection of dimension " << getDimension() << std::endl;
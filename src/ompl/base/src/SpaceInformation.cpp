@@ -35,10 +35,12 @@
 /* Author: Ioan Sucan */
 
 #include "ompl/base/SpaceInformation.h"
+#include <algorithm>
 #include <cassert>
 #include <queue>
 #include <utility>
 #include "ompl/base/DiscreteMotionValidator.h"
+#include "ompl/base/samplers/InstrumentedStateSampler.h"
 #include "ompl/base/samplers/UniformValidStateSampler.h"
 #include "ompl/base/spaces/DubinsStateSpace.h"
 #include "ompl/base/spaces/ReedsSheppStateSpace.h"
@@ -252,12 +254,20 @@ unsigned int ompl::base::SpaceInformation::getMotionStates(const State *s1, cons
     }
 
     /* find the states in between */
-    for (unsigned int j = 1; j < count && added < states.size(); ++j)
+    const unsigned int between = std::min<std::size_t>(count - 1, states.size() - added);
+    if (between > 0)
     {
-        if (alloc)
-            states[added] = allocState();
-        stateSpace_->interpolate(s1, s2, (double)j / (double)count, states[added]);
-        added++;
+        // reused by the calls on the same thread, as this is called for every motion that is interpolated
+        static thread_local std::vector<double> times;
+        times.resize(between);
+        for (unsigned int j = 0; j < between; ++j)
+        {
+            if (alloc)
+                states[added + j] = allocState();
+            times[j] = (double)(j + 1) / (double)count;
+        }
+        stateSpace_->interpolateBatch(s1, s2, times.data(), between, &states[added]);
+        added += between;
     }
 
     if (added < states.size() && endpoints)
@@ -326,6 +336,14 @@ bool ompl::base::SpaceInformation::checkMotion(const std::vector<State *> &state
     return true;
 }
 
+ompl::base::StateSamplerPtr ompl::base::SpaceInformation::allocStateSampler() const
+{
+    StateSamplerPtr sampler = stateSpace_->allocStateSampler();
+    if (instrumentation_)
+        return std::make_shared<InstrumentedStateSampler>(stateSpace_.get(), sampler, instrumentation_);
+    return sampler;
+}
+
 ompl::base::ValidStateSamplerPtr ompl::base::SpaceInformation::allocValidStateSampler() const
 {
     if (vssa_)
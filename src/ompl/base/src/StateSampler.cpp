@@ -37,6 +37,12 @@
 #include "ompl/base/StateSampler.h"
 #include "ompl/base/StateSpace.h"
 
+void ompl::base::StateSampler::sampleUniformBatch(State **states, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        sampleUniform(states[i]);
+}
+
 void ompl::base::CompoundStateSampler::addSampler(const StateSamplerPtr &sampler, double weightImportance)
 {
     samplers_.push_back(sampler);
@@ -51,6 +57,17 @@ void ompl::base::CompoundStateSampler::sampleUniform(State *state)
         samplers_[i]->sampleUniform(comps[i]);
 }
 
+void ompl::base::CompoundStateSampler::sampleUniformBatch(State **states, std::size_t count)
+{
+    components_.resize(count);
+    for (unsigned int i = 0; i < samplerCount_; ++i)
+    {
+        for (std::size_t j = 0; j < count; ++j)
+            components_[j] = states[j]->as<CompoundState>()->components[i];
+        samplers_[i]->sampleUniformBatch(components_.data(), count);
+    }
+}
+
 void ompl::base::CompoundStateSampler::sampleUniformNear(State *state, const State *near, const double distance)
 {
     State **comps = state->as<CompoundState>()->components;
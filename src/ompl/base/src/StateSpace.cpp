@@ -37,6 +37,7 @@
 #include "ompl/tools/config/MagicConstants.h"
 #include "ompl/base/spaces/RealVectorStateSpace.h"
 #include "ompl/util/String.h"
+#include <algorithm>
 #include <mutex>
 #include <boost/scoped_ptr.hpp>
 #include <numeric>
@@ -61,6 +62,7 @@ namespace ompl
                 std::list<StateSpace *> list_;
                 std::mutex lock_;
                 unsigned int counter_{0};
+                std::uint64_t instances_{0};
             };
 
             static boost::scoped_ptr<AllocatedSpaces> g_allocatedSpaces;
@@ -76,6 +78,14 @@ namespace ompl
                 std::call_once(g_once, &initAllocatedSpaces);
                 return *g_allocatedSpaces;
             }
+
+            // The most motion contexts a thread keeps; one per space in use
+            const std::size_t MAX_MOTION_CONTEXTS = 8;
+
+            // The motion contexts of the calling thread and the spaces that
+            // stored them, least recently stored first
+            thread_local std::vector<std::pair<std::uint64_t, std::unique_ptr<StateSpace::MotionContext>>>
+                g_motionContexts;
         }  // namespace
     }
 }
@@ -88,6 +98,7 @@ ompl::base::StateSpace::StateSpace()
 
     // autocompute a unique name
     name_ = "Space" + std::to_string(as.counter_++);
+    instanceId_ = ++as.instances_;
 
     longestValidSegment_ = 0.0;
     longestValidSegmentFraction_ = 0.01;  // 1%
@@ -372,6 +383,20 @@ const double *ompl::base::StateSpace::getValueAddressAtName(const State *state,
     return (it != locations.end()) ? getValueAddressAtLocation(state, it->second) : nullptr;
 }
 
+void ompl::base::StateSpace::distanceBatch(const State *state, const State *const *others, std::size_t count,
+                                           double *distances) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        distances[i] = distance(state, others[i]);
+}
+
+void ompl::base::StateSpace::interpolateBatch(const State *from, const State *to, const double *t, std::size_t count,
+                                              State **states) const
+{
+    for (std::size_t i = 0; i < count; ++i)
+        interpolate(from, to, t[i], states[i]);
+}
+
 unsigned int ompl::base::StateSpace::getSerializationLength() const
 {
     return 0;
@@ -853,6 +878,28 @@ unsigned int ompl::base::StateSpace::validSegmentCount(const State *state1, cons
     return longestValidSegmentCountFactor_ * (unsigned int)ceil(distance(state1, state2) / longestValidSegment_);
 }
 
+ompl::base::StateSpace::MotionContext *ompl::base::StateSpace::getMotionContext() const
+{
+    for (auto &slot : g_motionContexts)
+        if (slot.first == instanceId_)
+            return slot.second.get();
+    return nullptr;
+}
+
+ompl::base::StateSpace::MotionContext *
+ompl::base::StateSpace::setMotionContext(std::unique_ptr<MotionContext> context) const
+{
+    auto slot = std::find_if(g_motionContexts.begin(), g_motionContexts.end(),
+                             [this](const std::pair<std::uint64_t, std::unique_ptr<MotionContext>> &s)
+                             { return s.first == instanceId_; });
+    if (slot != g_motionContexts.end())
+        g_motionContexts.erase(slot);
+    else if (g_motionContexts.size() == MAX_MOTION_CONTEXTS)
+        g_motionContexts.erase(g_motionContexts.begin());
+    g_motionContexts.emplace_back(instanceId_, std::move(context));
+    return g_motionContexts.back().second.get();
+}
+
 ompl::base::CompoundStateSpace::CompoundStateSpace()
 {
     setName("Compound" + getName());
@@ -36,6 +36,7 @@
 
 #include "ompl/base/ValidStateSampler.h"
 #include "ompl/tools/config/MagicConstants.h"
+#include <utility>
 
 ompl::base::ValidStateSampler::ValidStateSampler(const SpaceInformation *si)
   : si_(si), attempts_(magic::MAX_VALID_SAMPLE_ATTEMPTS), name_("not set")
@@ -52,3 +53,12 @@ ompl::base::ValidStateSampler::ValidStateSampler(const SpaceInformation *si)
 }
 
 ompl::base::ValidStateSampler::~ValidStateSampler() = default;
+
+std::size_t ompl::base::ValidStateSampler::sampleBatch(State **states, std::size_t count)
+{
+    std::size_t valid = 0;
+    for (std::size_t i = 0; i < count; ++i)
+        if (sample(states[i]))
+            std::swap(states[valid++], states[i]);
+    return valid;
+}
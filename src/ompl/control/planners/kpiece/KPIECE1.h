@@ -65,6 +65,9 @@ namespace ompl
            associated to the state space. An exception is thrown if
            no default projection is available either.
            This implementation is intended for systems with differential constraints.
+           It runs in a single thread. The parallel variant of the geometric planner, geometric::pKPIECE1,
+           exchanges cell coverage through geometric::Discretization, which this planner does not use, so there
+           is no parallel variant of this one.
            @par External documentation
            I.A. Şucan and L.E. Kavraki, Kinodynamic motion planning by interior-exterior cell exploration,
            in <em>Workshop on the Algorithmic Foundations of Robotics</em>, Dec. 2008.<br>
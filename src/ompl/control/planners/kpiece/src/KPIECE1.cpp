@@ -78,6 +78,9 @@ void ompl::control::KPIECE1::setup()
         throw Exception("The fraction of time spent selecting border cells must be in the range (0,1]");
 
     tree_.grid.setDimension(projectionEvaluator_->getDimension());
+    Grid::Coord low, high;
+    if (projectionEvaluator_->computeCoordinateBounds(low, high))
+        tree_.grid.setDenseBounds(low, high);
 }
 
 void ompl::control::KPIECE1::clear()
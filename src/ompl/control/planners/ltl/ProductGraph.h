@@ -40,10 +40,12 @@
 #include "ompl/base/State.h"
 #include "ompl/control/planners/ltl/Automaton.h"
 #include "ompl/control/planners/ltl/PropositionalDecomposition.h"
+#include "ompl/datastructures/LPAstarOnGraph.h"
 #include "ompl/util/ClassForward.h"
 #include <boost/graph/adjacency_list.hpp>
 #include <unordered_map>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <vector>
 
@@ -151,8 +153,10 @@ namespace ompl
                 and the corresponding co-safety Automaton state is as close as possible
                 to an accepting state given the adjacency properties of the
                 PropositionalDecomposition.
-                Dijkstra's shortest-path algorithm is used to compute the path with
-                the given edge-weight function. */
+                The path is computed with Lifelong Planning A* (with a zero heuristic)
+                under the given edge-weight function. As long as the graph and the start
+                State do not change between calls, the search from the previous call is
+                reused and only the vertices affected by changed edge weights are repaired. */
             std::vector<State *> computeLead(State *start, const std::function<double(State *, State *)> &edgeWeight);
 
             /** \brief Clears all memory belonging to this ProductGraph. */
@@ -213,28 +217,49 @@ namespace ompl
                 co-safety state, and safety state. */
             State *getState(int region, int cosafe, int safe) const
             {
-                State s;
-                s.decompRegion = region;
-                s.cosafeState = cosafe;
-                s.safeState = safe;
-                State *&ret = stateToPtr_[s];
+                State *&ret = stateTable_[stateIndex(region, cosafe, safe)];
                 if (ret == nullptr)
-                    ret = new State(s);
+                {
+                    ret = new State();
+                    ret->decompRegion = region;
+                    ret->cosafeState = cosafe;
+                    ret->safeState = safe;
+                }
                 return ret;
             }
 
         protected:
-            struct Edge
-            {
-                double cost;
-            };
-
-            using GraphType = boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, State *, Edge>;
+            using GraphType = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS, State *,
+                                                    boost::property<boost::edge_weight_t, double>>;
             using Vertex = boost::graph_traits<GraphType>::vertex_descriptor;
             using VertexIter = boost::graph_traits<GraphType>::vertex_iterator;
             using VertexIndexMap = boost::property_map<GraphType, boost::vertex_index_t>::type;
             using EdgeIter = boost::graph_traits<GraphType>::edge_iterator;
 
+            /** \brief The search in computeLead() is uninformed, i.e., LPA* degenerates
+                to an incremental version of Dijkstra's algorithm. */
+            struct ZeroHeuristic
+            {
+                double operator()(std::size_t /*v*/) const
+                {
+                    return 0.0;
+                }
+            };
+
+            using LeadSearch = LPAstarOnGraph<GraphType, ZeroHeuristic>;
+
+            /** \brief Returns the index in stateTable_ of the State with the given components.
+                The dead automaton state (-1) and the unknown region (-1) are valid inputs. */
+            std::size_t stateIndex(int region, int cosafe, int safe) const
+            {
+                return ((static_cast<std::size_t>(region + 1) * (numCosafeStates_ + 1)) + (cosafe + 1)) *
+                           (numSafeStates_ + 1) +
+                       (safe + 1);
+            }
+
+            /** \brief Reset the incremental search; the next call to computeLead() starts from scratch. */
+            void resetLeadSearch();
+
             PropositionalDecompositionPtr decomp_;
             AutomatonPtr cosafety_;
             AutomatonPtr safety_;
@@ -246,12 +271,27 @@ namespace ompl
                in the ProductGraph. There will exist situations in which
                all we have are the component values (region, automaton states)
                of a State and we want the actual State pointer.
-               We use this map to access it. */
-            mutable std::unordered_map<State, State *, HashState> stateToPtr_;
+               The product space is small and bounded, so the pointers are kept
+               in a dense table indexed by stateIndex() instead of a hash map. */
+            std::size_t numCosafeStates_;
+            std::size_t numSafeStates_;
+            mutable std::vector<State *> stateTable_;
+
+            /* Map from the stateIndex() of a State to the index of the
+               corresponding vertex in the graph (-1 if not in the graph). */
+            std::vector<int> stateToIndex_;
+
+            /* Vertex that every solution State is connected to with a zero-cost
+               edge, so that the lead search has a single target. */
+            Vertex sink_;
+
+            /* State from which leadSearch_ is rooted. */
+            State *leadStart_{nullptr};
+
+            ZeroHeuristic zeroHeuristic_;
 
-            /* Map from State pointer to the index of the corresponding vertex
-               in the graph. */
-            std::unordered_map<State *, int> stateToIndex_;
+            /* Incremental shortest-path search reused across calls to computeLead(). */
+            std::unique_ptr<LeadSearch> leadSearch_;
         };
     }
 }
@@ -45,13 +45,11 @@
 #include "ompl/util/DisableCompilerWarning.h"
 #include <algorithm>
 #include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <list>
 #include <unordered_map>
-#include <unordered_set>
 #include <map>
 #include <ostream>
 #include <queue>
-#include <stack>
 #include <utility>
 #include <vector>
 
@@ -103,12 +101,24 @@ int ompl::control::ProductGraph::State::getSafeState() const
 
 ompl::control::ProductGraph::ProductGraph(PropositionalDecompositionPtr decomp, AutomatonPtr cosafetyAut,
                                           AutomatonPtr safetyAut)
-  : decomp_(std::move(decomp)), cosafety_(std::move(cosafetyAut)), safety_(std::move(safetyAut))
+  : decomp_(std::move(decomp))
+  , cosafety_(std::move(cosafetyAut))
+  , safety_(std::move(safetyAut))
+  , numCosafeStates_(cosafety_->numStates())
+  , numSafeStates_(safety_->numStates())
+  , stateTable_(stateIndex(decomp_->getNumRegions(), 0, 0), nullptr)
+  , stateToIndex_(stateTable_.size(), -1)
 {
 }
 
 ompl::control::ProductGraph::ProductGraph(const PropositionalDecompositionPtr &decomp, AutomatonPtr cosafetyAut)
-  : decomp_(decomp), cosafety_(std::move(cosafetyAut)), safety_(Automaton::AcceptingAutomaton(decomp->getNumProps()))
+  : decomp_(decomp)
+  , cosafety_(std::move(cosafetyAut))
+  , safety_(Automaton::AcceptingAutomaton(decomp->getNumProps()))
+  , numCosafeStates_(cosafety_->numStates())
+  , numSafeStates_(safety_->numStates())
+  , stateTable_(stateIndex(decomp_->getNumRegions(), 0, 0), nullptr)
+  , stateToIndex_(stateTable_.size(), -1)
 {
 }
 
@@ -135,49 +145,61 @@ const ompl::control::AutomatonPtr &ompl::control::ProductGraph::getSafetyAutom()
 std::vector<ompl::control::ProductGraph::State *> ompl::control::ProductGraph::computeLead(
     ProductGraph::State *start, const std::function<double(ProductGraph::State *, ProductGraph::State *)> &edgeWeight)
 {
-    std::vector<GraphType::vertex_descriptor> parents(boost::num_vertices(graph_));
-    std::vector<double> distances(boost::num_vertices(graph_));
+    std::vector<State *> lead;
+    if (solutionStates_.empty())
+        return lead;
+
+    auto weights = boost::get(boost::edge_weight, graph_);
+    const Vertex startVertex = stateToIndex_[stateIndex(start->decompRegion, start->cosafeState, start->safeState)];
 OMPL_PUSH_DISABLE_GCC_WARNING(-Wmaybe-uninitialized)
     EdgeIter ei, eend;
 OMPL_POP_GCC
-    // first build up the edge weights
-    for (boost::tie(ei, eend) = boost::edges(graph_); ei != eend; ++ei)
-    {
-        GraphType::vertex_descriptor src = boost::source(*ei, graph_);
-        GraphType::vertex_descriptor target = boost::target(*ei, graph_);
-        graph_[*ei].cost = edgeWeight(graph_[src], graph_[target]);
-    }
-    int startIndex = stateToIndex_[start];
-    boost::dijkstra_shortest_paths(
-        graph_, boost::vertex(startIndex, graph_),
-        boost::weight_map(get(&Edge::cost, graph_))
-            .distance_map(boost::make_iterator_property_map(distances.begin(), get(boost::vertex_index, graph_)))
-            .predecessor_map(boost::make_iterator_property_map(parents.begin(), get(boost::vertex_index, graph_))));
-    // pick state from solutionStates_ such that distance[state] is minimized
-    State *bestSoln = *solutionStates_.begin();
-    double cost = distances[boost::vertex(stateToIndex_[bestSoln], graph_)];
-    for (std::vector<State *>::const_iterator s = solutionStates_.begin() + 1; s != solutionStates_.end(); ++s)
+    if (!leadSearch_ || leadStart_ != start)
     {
-        if (distances[boost::vertex(stateToIndex_[*s], graph_)] < cost)
+        // first build up the edge weights and start a fresh search
+        for (boost::tie(ei, eend) = boost::edges(graph_); ei != eend; ++ei)
         {
-            cost = distances[boost::vertex(stateToIndex_[*s], graph_)];
-            bestSoln = *s;
+            const Vertex target = boost::target(*ei, graph_);
+            if (target != sink_)
+                weights[*ei] = edgeWeight(graph_[boost::source(*ei, graph_)], graph_[target]);
         }
+        leadStart_ = start;
+        leadSearch_.reset(new LeadSearch(startVertex, sink_, graph_, zeroHeuristic_));
     }
-    // build lead from bestSoln parents
-    std::stack<State *> leadStack;
-    while (!(bestSoln == start))
+    else
     {
-        leadStack.push(bestSoln);
-        bestSoln = graph_[parents[boost::vertex(stateToIndex_[bestSoln], graph_)]];
+        // only notify the search about the edges whose weight changed since the last call
+        for (boost::tie(ei, eend) = boost::edges(graph_); ei != eend; ++ei)
+        {
+            const Vertex src = boost::source(*ei, graph_);
+            const Vertex target = boost::target(*ei, graph_);
+            if (target == sink_)
+                continue;
+            const double w = edgeWeight(graph_[src], graph_[target]);
+            const double prev = weights[*ei];
+            if (w == prev)
+                continue;
+            weights[*ei] = w;
+            // the start vertex always has cost zero; incoming edges cannot change that
+            if (target == startVertex)
+                continue;
+            if (w < prev)
+                leadSearch_->insertEdge(src, target, w);
+            else
+                leadSearch_->removeEdge(src, target);
+        }
     }
-    leadStack.push(bestSoln);
 
-    std::vector<State *> lead;
-    while (!leadStack.empty())
+    std::list<std::size_t> path;
+    leadSearch_->computeShortestPath(path);
+
+    // build lead from the shortest path to the sink, which passes through
+    // the solution state with minimum cost
+    for (std::size_t v : path)
     {
-        lead.push_back(leadStack.top());
-        leadStack.pop();
+        if (v == sink_)
+            break;
+        lead.push_back(graph_[v]);
         // Truncate the lead as early when it hits the desired automaton states
         // \todo: more elegant way to do this?
         if (lead.back()->cosafeState == solutionStates_.front()->cosafeState &&
@@ -187,35 +209,45 @@ OMPL_POP_GCC
     return lead;
 }
 
+void ompl::control::ProductGraph::resetLeadSearch()
+{
+    leadSearch_.reset();
+    leadStart_ = nullptr;
+}
+
 void ompl::control::ProductGraph::clear()
 {
+    resetLeadSearch();
     solutionStates_.clear();
-    stateToIndex_.clear();
+    std::fill(stateToIndex_.begin(), stateToIndex_.end(), -1);
     startState_ = nullptr;
     graph_.clear();
-    for (auto &i : stateToPtr_)
-        delete i.second;
-    stateToPtr_.clear();
+    for (auto &s : stateTable_)
+    {
+        delete s;
+        s = nullptr;
+    }
 }
 
 void ompl::control::ProductGraph::buildGraph(State *start, const std::function<void(State *)> &initialize)
 {
+    resetLeadSearch();
     graph_.clear();
     solutionStates_.clear();
+    std::fill(stateToIndex_.begin(), stateToIndex_.end(), -1);
     std::queue<State *> q;
-    std::unordered_set<State *> processed;
     std::vector<int> regNeighbors;
     VertexIndexMap index = get(boost::vertex_index, graph_);
 
     GraphType::vertex_descriptor next = boost::add_vertex(graph_);
     startState_ = start;
     graph_[boost::vertex(next, graph_)] = startState_;
-    stateToIndex_[startState_] = index[next];
+    int &startIndex = stateToIndex_[stateIndex(start->decompRegion, start->cosafeState, start->safeState)];
+    startIndex = index[next];
     q.push(startState_);
-    processed.insert(startState_);
 
     OMPL_INFORM("Building graph from start state (%u,%u,%u) with index %d", startState_->decompRegion,
-                startState_->cosafeState, startState_->safeState, stateToIndex_[startState_]);
+                startState_->cosafeState, startState_->safeState, startIndex);
 
     while (!q.empty())
     {
@@ -229,7 +261,8 @@ void ompl::control::ProductGraph::buildGraph(State *start, const std::function<v
             solutionStates_.push_back(current);
         }
 
-        GraphType::vertex_descriptor v = boost::vertex(stateToIndex_[current], graph_);
+        GraphType::vertex_descriptor v = boost::vertex(
+            stateToIndex_[stateIndex(current->decompRegion, current->cosafeState, current->safeState)], graph_);
 
         // enqueue each neighbor of current
         decomp_->getNeighbors(current->decompRegion, regNeighbors);
@@ -242,22 +275,19 @@ void ompl::control::ProductGraph::buildGraph(State *start, const std::function<v
             // then we can dynamically allocate a copy of it
             // and add the new pointer to the graph.
             // either way, we need the pointer
-            if (processed.find(nextState) == processed.end())
+            int &nextIndex =
+                stateToIndex_[stateIndex(nextState->decompRegion, nextState->cosafeState, nextState->safeState)];
+            if (nextIndex < 0)
             {
                 const GraphType::vertex_descriptor next = boost::add_vertex(graph_);
-                stateToIndex_[nextState] = index[next];
+                nextIndex = index[next];
                 graph_[boost::vertex(next, graph_)] = nextState;
                 q.push(nextState);
-                processed.insert(nextState);
             }
 
             // whether or not the neighbor is newly discovered,
             // we still need to add the edge to the graph
-            GraphType::edge_descriptor edge;
-            bool ignore;
-            boost::tie(edge, ignore) = boost::add_edge(v, boost::vertex(stateToIndex_[nextState], graph_), graph_);
-            // graph_[edge].src = index[v];
-            // graph_[edge].dest = stateToIndex_[nextState];
+            boost::add_edge(v, boost::vertex(nextIndex, graph_), 0.0, graph_);
         }
         regNeighbors.clear();
     }
@@ -266,10 +296,18 @@ void ompl::control::ProductGraph::buildGraph(State *start, const std::function<v
         OMPL_ERROR("No solution path found in product graph.");
     }
 
+    // connect all solution states to a single sink vertex, which is the target of the lead search;
+    // the edges have zero cost, so the shortest path to the sink ends with a shortest lead
+    sink_ = boost::add_vertex(graph_);
+    graph_[sink_] = nullptr;
+    for (State *s : solutionStates_)
+        boost::add_edge(boost::vertex(stateToIndex_[stateIndex(s->decompRegion, s->cosafeState, s->safeState)], graph_),
+                        sink_, 0.0, graph_);
+
     OMPL_INFORM("Number of decomposition regions: %u", decomp_->getNumRegions());
     OMPL_INFORM("Number of cosafety automaton states: %u", cosafety_->numStates());
     OMPL_INFORM("Number of safety automaton states: %u", safety_->numStates());
-    OMPL_INFORM("Number of high-level states in abstraction graph: %u", boost::num_vertices(graph_));
+    OMPL_INFORM("Number of high-level states in abstraction graph: %u", boost::num_vertices(graph_) - 1);
 }
 
 bool ompl::control::ProductGraph::isSolution(const State *s) const
@@ -305,27 +343,14 @@ ompl::control::ProductGraph::State *ompl::control::ProductGraph::getState(const
 ompl::control::ProductGraph::State *ompl::control::ProductGraph::getState(const base::State *cs, int cosafe,
                                                                           int safe) const
 {
-    State s;
-    s.decompRegion = decomp_->locateRegion(cs);
-    s.cosafeState = cosafe;
-    s.safeState = safe;
-    State *&ret = stateToPtr_[s];
-    if (ret == nullptr)
-        ret = new State(s);
-    return ret;
+    return getState(decomp_->locateRegion(cs), cosafe, safe);
 }
 
 ompl::control::ProductGraph::State *ompl::control::ProductGraph::getState(const State *parent, int nextRegion) const
 {
-    State s;
-    s.decompRegion = nextRegion;
     const World nextWorld = decomp_->worldAtRegion(nextRegion);
-    s.cosafeState = cosafety_->step(parent->cosafeState, nextWorld);
-    s.safeState = safety_->step(parent->safeState, nextWorld);
-    State *&ret = stateToPtr_[s];
-    if (ret == nullptr)
-        ret = new State(s);
-    return ret;
+    return getState(nextRegion, cosafety_->step(parent->cosafeState, nextWorld),
+                    safety_->step(parent->safeState, nextWorld));
 }
 
 ompl::control::ProductGraph::State *ompl::control::ProductGraph::getState(const State *parent,
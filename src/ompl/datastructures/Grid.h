@@ -43,10 +43,18 @@
 #include <cstdlib>
 #include <unordered_map>
 #include <algorithm>
+#include <memory>
 
 namespace ompl
 {
-    /** \brief Representation of a simple grid */
+    /** \brief Representation of a simple grid
+
+        Cells are kept in a hash map keyed by their coordinates. If the
+        range of coordinates that will typically be used is known (e.g., for
+        a bounded projection), setDenseBounds() additionally enables a dense,
+        paged array index for the coordinates within that range, so that cell
+        and neighbor lookups in that range are O(1) array accesses instead of
+        hash lookups. */
     template <typename _T>
     class Grid
     {
@@ -105,6 +113,57 @@ namespace ompl
                 throw;
             dimension_ = dimension;
             maxNeighbors_ = 2 * dimension_;
+            disableDenseIndex();
+        }
+
+        /// Use a dense array index for the cells with coordinates
+        /// between \e low and \e high (inclusive). Cells outside this
+        /// range are still supported, but are only found through the
+        /// hash map. Memory for the index is allocated in pages, as cells
+        /// are added. Returns false (and does not use a dense index) if the
+        /// range is empty, does not match the grid dimension, or contains
+        /// too many cells.
+        bool setDenseBounds(const Coord &low, const Coord &high)
+        {
+            disableDenseIndex();
+            if (low.size() != dimension_ || high.size() != dimension_ || dimension_ == 0)
+                return false;
+            denseStrides_.resize(dimension_);
+            std::size_t count = 1;
+            for (unsigned int i = 0; i < dimension_; ++i)
+            {
+                if (high[i] < low[i])
+                    return false;
+                const auto extent = static_cast<std::size_t>(static_cast<long long>(high[i]) - low[i]) + 1;
+                if (count > MAX_DENSE_CELLS / extent)
+                    return false;
+                denseStrides_[i] = count;
+                count *= extent;
+            }
+            denseLow_ = low;
+            denseHigh_ = high;
+            densePages_.resize((count + DENSE_PAGE_SIZE - 1) / DENSE_PAGE_SIZE);
+            dense_ = true;
+
+            // index the cells that already exist
+            std::size_t index;
+            for (const auto &h : hash_)
+                if (denseIndex(*h.first, index))
+                    setDenseCell(index, h.second);
+            return true;
+        }
+
+        /// Stop using a dense index for cell lookups and free its memory
+        void disableDenseIndex()
+        {
+            dense_ = false;
+            densePages_.clear();
+        }
+
+        /// Check if a dense array index is used for cell lookups
+        bool hasDenseIndex() const
+        {
+            return dense_;
         }
 
         /// Check if a cell exists at the specified coordinate
@@ -116,6 +175,9 @@ namespace ompl
         /// Get the cell at a specified coordinate
         Cell *getCell(const Coord &coord) const
         {
+            std::size_t index;
+            if (dense_ && denseIndex(coord, index))
+                return getDenseCell(index);
             auto pos = hash_.find(const_cast<Coord *>(&coord));
             Cell *c = (pos != hash_.end()) ? pos->second : nullptr;
             return c;
@@ -140,6 +202,39 @@ namespace ompl
         {
             list.reserve(list.size() + maxNeighbors_);
 
+            std::size_t index;
+            if (dense_ && denseIndex(coord, index))
+            {
+                // neighbors inside the dense range are found by offsetting the index;
+                // only neighbors beyond the range need a hash lookup
+                for (int i = dimension_ - 1; i >= 0; --i)
+                {
+                    Cell *cell;
+                    if (coord[i] > denseLow_[i])
+                        cell = getDenseCell(index - denseStrides_[i]);
+                    else
+                    {
+                        coord[i]--;
+                        cell = getHashCell(coord);
+                        coord[i]++;
+                    }
+                    if (cell)
+                        list.push_back(cell);
+
+                    if (coord[i] < denseHigh_[i])
+                        cell = getDenseCell(index + denseStrides_[i]);
+                    else
+                    {
+                        coord[i]++;
+                        cell = getHashCell(coord);
+                        coord[i]--;
+                    }
+                    if (cell)
+                        list.push_back(cell);
+                }
+                return;
+            }
+
             for (int i = dimension_ - 1; i >= 0; --i)
             {
                 coord[i]--;
@@ -235,7 +330,7 @@ namespace ompl
                 auto pos = hash_.find(&cell->coord);
                 if (pos != hash_.end())
                 {
-                    hash_.erase(pos);
+                    erase(pos);
                     return true;
                 }
             }
@@ -246,6 +341,9 @@ namespace ompl
         virtual void add(Cell *cell)
         {
             hash_.insert(std::make_pair(&cell->coord, cell));
+            std::size_t index;
+            if (dense_ && denseIndex(cell->coord, index))
+                setDenseCell(index, cell);
         }
 
         /// Clear the memory occupied by a cell; do not call this function unless remove() was called first
@@ -315,8 +413,54 @@ namespace ompl
             getCells(content);
             hash_.clear();
 
+            // keep the pages of the dense index allocated, so they can be reused
+            std::size_t index;
             for (auto &c : content)
+            {
+                if (dense_ && denseIndex(c->coord, index))
+                    setDenseCell(index, nullptr);
                 delete c;
+            }
+        }
+
+        /// Get the cell at a specified coordinate, without using the dense index
+        Cell *getHashCell(Coord &coord) const
+        {
+            auto pos = hash_.find(&coord);
+            return (pos != hash_.end()) ? pos->second : nullptr;
+        }
+
+        /// Compute the position of \e coord in the dense index; returns false if \e coord is outside the dense range
+        bool denseIndex(const Coord &coord, std::size_t &index) const
+        {
+            index = 0;
+            for (unsigned int i = 0; i < dimension_; ++i)
+            {
+                if (coord[i] < denseLow_[i] || coord[i] > denseHigh_[i])
+                    return false;
+                index += static_cast<std::size_t>(coord[i] - denseLow_[i]) * denseStrides_[i];
+            }
+            return true;
+        }
+
+        /// Get the cell stored at position \e index of the dense index
+        Cell *getDenseCell(std::size_t index) const
+        {
+            const std::unique_ptr<Cell *[]> &page = densePages_[index / DENSE_PAGE_SIZE];
+            return page ? page[index % DENSE_PAGE_SIZE] : nullptr;
+        }
+
+        /// Store \e cell at position \e index of the dense index, allocating the page if needed
+        void setDenseCell(std::size_t index, Cell *cell)
+        {
+            std::unique_ptr<Cell *[]> &page = densePages_[index / DENSE_PAGE_SIZE];
+            if (!page)
+            {
+                if (cell == nullptr)
+                    return;
+                page.reset(new Cell *[DENSE_PAGE_SIZE]());
+            }
+            page[index % DENSE_PAGE_SIZE] = cell;
         }
 
         /// Hash function for coordinates; see
@@ -351,6 +495,15 @@ namespace ompl
         /// Define the datatype for the used hash structure
         using CoordHash = std::unordered_map<Coord *, Cell *, HashFunCoordPtr, EqualCoordPtr>;
 
+        /// Remove the cell at position \e pos of the hash map from the grid (the cell is not freed)
+        void erase(typename CoordHash::iterator pos)
+        {
+            std::size_t index;
+            if (dense_ && denseIndex(*pos->first, index))
+                setDenseCell(index, nullptr);
+            hash_.erase(pos);
+        }
+
         /// Helper to sort components by size
         struct SortComponents
         {
@@ -386,6 +539,27 @@ namespace ompl
 
         /// The hash holding the cells
         CoordHash hash_;
+
+        /// The number of cells in a page of the dense index
+        static const std::size_t DENSE_PAGE_SIZE = 1024;
+
+        /// The maximum number of cells that can be covered by the dense index
+        static const std::size_t MAX_DENSE_CELLS = std::size_t(1) << 28;
+
+        /// Flag indicating whether the dense index is in use
+        bool dense_{false};
+
+        /// The lower corner cell of the dense index
+        Coord denseLow_;
+
+        /// The upper corner cell of the dense index
+        Coord denseHigh_;
+
+        /// The offset in the dense index between consecutive coordinates along each dimension
+        std::vector<std::size_t> denseStrides_;
+
+        /// The pages of the dense index; a page is allocated when a cell in its range is first added
+        std::vector<std::unique_ptr<Cell *[]>> densePages_;
     };
 }  // namespace ompl
 
@@ -257,7 +257,7 @@ namespace ompl
                 auto pos = GridN<_T>::hash_.find(&cell->coord);
                 if (pos != GridN<_T>::hash_.end())
                 {
-                    GridN<_T>::hash_.erase(pos);
+                    GridN<_T>::erase(pos);
                     auto *cx = static_cast<CellX *>(cell);
                     if (cx->border)
                         external_.remove(reinterpret_cast<typename externalBHeap::Element *>(cx->heapElement));
@@ -91,6 +91,7 @@ namespace ompl
             assert(Grid<_T>::empty() == true);
             Grid<_T>::dimension_ = dimension;
             Grid<_T>::maxNeighbors_ = 2 * dimension;
+            Grid<_T>::disableDenseIndex();
             if (!overrideCellNeighborsLimit_)
                 interiorCellNeighborsLimit_ = Grid<_T>::maxNeighbors_;
         }
@@ -199,7 +200,7 @@ namespace ompl
                 auto pos = Grid<_T>::hash_.find(&cell->coord);
                 if (pos != Grid<_T>::hash_.end())
                 {
-                    Grid<_T>::hash_.erase(pos);
+                    Grid<_T>::erase(pos);
                     return true;
                 }
             }
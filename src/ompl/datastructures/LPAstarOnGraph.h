@@ -100,7 +100,10 @@ namespace ompl
         }
         void removeEdge(std::size_t u, std::size_t v)
         {
-            assert(v != source_->getId());
+            // the source does not depend on its incoming edges; callers on undirected graphs
+            // remove both directions of an edge, so this is not an error
+            if (v == source_->getId())
+                return;
 
             Node *n_u = getNode(u);
             Node *n_v = getNode(v);
@@ -117,10 +120,11 @@ namespace ompl
         {
             WeightMap weights = boost::get(boost::edge_weight_t(), graph_);
 
-            if (queue_.empty())
-                return std::numeric_limits<double>::infinity();
-
-            while (topHead()->key() < target_->calculateKey() || target_->rhs() != target_->costToCome())
+            // an empty queue means every node is locally consistent, i.e., the
+            // previous search is still valid and only the path needs to be extracted;
+            // the cost of the target is then exact, and infinite if it cannot be reached
+            while (!queue_.empty() &&
+                   (topHead()->key() < target_->calculateKey() || target_->rhs() != target_->costToCome()))
             {
                 // pop from queue and process
                 Node *u = topHead();
@@ -165,9 +169,6 @@ namespace ompl
                         updateVertex(n_v);
                     }
                 }
-
-                if (queue_.empty())
-                    break;
             }
 
             // now get path
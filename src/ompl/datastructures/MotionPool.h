@@ -0,0 +1,206 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_DATASTRUCTURES_MOTION_POOL_
+#define OMPL_DATASTRUCTURES_MOTION_POOL_
+
+#include "ompl/base/SpaceInformation.h"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief A slab allocator for the motions of tree-based planners.
+
+        Motions are constructed in blocks of memory that the pool keeps
+        until it is destroyed, and every slot of a block owns a state that
+        is allocated from the space information the first time the slot is
+        used. clear() releases all motions but keeps both the blocks and
+        the states, so a planner that is cleared and solves again grows its
+        tree without allocating, and clearing takes constant time for
+        motions that are trivially destructible.
+
+        \e Motion must be default constructible and have a member
+        <tt>base::State *state</tt>, which the pool sets. The state of a
+        motion belongs to the pool and must neither be freed nor replaced
+        by the planner. A pool is meant to be used by one thread at a time. */
+    template <typename Motion>
+    class MotionPool
+    {
+    public:
+        /** \brief Allocate states from \e si, and motions in blocks of \e blockSize */
+        MotionPool(base::SpaceInformationPtr si, std::size_t blockSize = 256)
+          : si_(std::move(si)), blockSize_(blockSize)
+        {
+        }
+
+        ~MotionPool()
+        {
+            clear();
+            for (auto &block : blocks_)
+                for (std::size_t i = 0; i < blockSize_; ++i)
+                    if (block[i].state != nullptr)
+                        si_->freeState(block[i].state);
+        }
+
+        MotionPool(const MotionPool &) = delete;
+        MotionPool &operator=(const MotionPool &) = delete;
+
+        /** \brief Construct a motion that has a state of its own. The
+            value of the state is unspecified. */
+        Motion *allocate()
+        {
+            Slot *slot = nextSlot();
+            if (slot->state == nullptr)
+                slot->state = si_->allocState();
+            return construct(slot);
+        }
+
+        /** \brief Construct a motion for \e state, which was allocated by
+            the space information. The pool takes ownership of \e state. */
+        Motion *allocate(base::State *state)
+        {
+            Slot *slot = nextSlot();
+            if (slot->state != nullptr)
+                si_->freeState(slot->state);
+            slot->state = state;
+            return construct(slot);
+        }
+
+        /** \brief Return a single motion to the pool. Its slot, and the
+            state of the slot, are reused by the next motion allocated. */
+        void free(Motion *motion)
+        {
+            motion->~Motion();
+            auto *slot = reinterpret_cast<Slot *>(motion);
+            slot->live = false;
+            freeSlots_.push_back(slot);
+            --size_;
+        }
+
+        /** \brief Release all motions allocated so far */
+        void clear()
+        {
+            if (!std::is_trivially_destructible<Motion>::value)
+                for (std::size_t i = 0; i < used_; ++i)
+                {
+                    Slot &slot = blocks_[i / blockSize_][i % blockSize_];
+                    if (slot.live)
+                    {
+                        reinterpret_cast<Motion *>(&slot.storage)->~Motion();
+                        slot.live = false;
+                    }
+                }
+            freeSlots_.clear();
+            used_ = 0;
+            size_ = 0;
+        }
+
+        /** \brief The number of motions currently allocated */
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        /** \brief The number of motions the pool can hold without allocating more blocks */
+        std::size_t capacity() const
+        {
+            return blocks_.size() * blockSize_;
+        }
+
+    private:
+        /** \brief The memory for one motion, and the state that goes with it */
+        struct Slot
+        {
+            /** \brief The storage the motion is constructed in; this must be the first member */
+            typename std::aligned_storage<sizeof(Motion), alignof(Motion)>::type storage;
+
+            /** \brief The state owned by this slot */
+            base::State *state{nullptr};
+
+            /** \brief Whether a motion is currently constructed in this slot */
+            bool live{false};
+        };
+
+        /** \brief Get a slot that is not in use, preferring slots of freed motions */
+        Slot *nextSlot()
+        {
+            if (!freeSlots_.empty())
+            {
+                Slot *slot = freeSlots_.back();
+                freeSlots_.pop_back();
+                return slot;
+            }
+            if (used_ == capacity())
+                blocks_.emplace_back(new Slot[blockSize_]);
+            Slot *slot = &blocks_[used_ / blockSize_][used_ % blockSize_];
+            ++used_;
+            return slot;
+        }
+
+        /** \brief Construct a motion in \e slot */
+        Motion *construct(Slot *slot)
+        {
+            auto *motion = new (&slot->storage) Motion();
+            motion->state = slot->state;
+            slot->live = true;
+            ++size_;
+            return motion;
+        }
+
+        /** \brief The space information states are allocated from */
+        base::SpaceInformationPtr si_;
+
+        /** \brief The number of slots in a block */
+        std::size_t blockSize_;
+
+        /** \brief The blocks of slots */
+        std::vector<std::unique_ptr<Slot[]>> blocks_;
+
+        /** \brief The number of slots handed out from the blocks since the last clear() */
+        std::size_t used_{0};
+
+        /** \brief Slots of motions returned by free() */
+        std::vector<Slot *> freeSlots_;
+
+        /** \brief The number of motions currently allocated */
+        std::size_t size_{0};
+    };
+}
+
+#endif
@@ -43,6 +43,8 @@
 #include "ompl/datastructures/PDF.h"
 #endif
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <iostream>
 #include <queue>
 #include <random>
@@ -268,6 +270,43 @@ namespace ompl
                 tree_->list(*this, data);
         }
 
+        /// \brief Write the structure of the tree to \e out in binary form, so that loadStructure() can restore
+        /// it without computing any distances. Elements are not written themselves; each one is identified by
+        /// the position \e index assigns to it, typically its position in the vector returned by list().
+        /// Return false, and write nothing, if some elements are marked for removal.
+        bool saveStructure(std::ostream &out, const std::function<std::size_t(const _T &)> &index) const
+        {
+            if (!removed_.empty())
+                return false;
+            writeValue<std::uint64_t>(out, size_);
+            if (tree_)
+                tree_->save(out, index);
+            return true;
+        }
+
+        /// \brief Replace the contents of this GNAT with a tree written by saveStructure(). Position i in
+        /// \e elements must hold the element that had index i when saving. Return false, and leave the GNAT
+        /// empty, if the stream does not contain a valid tree over all of \e elements.
+        bool loadStructure(std::istream &in, const std::vector<_T> &elements)
+        {
+            clear();
+            std::uint64_t size;
+            if (!readValue(in, size) || size != elements.size())
+                return false;
+            if (size > 0)
+            {
+                std::vector<bool> seen(elements.size(), false);
+                tree_ = Node::load(*this, in, elements, seen);
+                if (tree_ == nullptr || std::find(seen.begin(), seen.end(), false) != seen.end())
+                {
+                    clear();
+                    return false;
+                }
+            }
+            size_ = size;
+            return true;
+        }
+
         /// \brief Print a GNAT structure (mostly useful for debugging purposes).
         friend std::ostream &operator<<(std::ostream &out, const NearestNeighborsGNAT<_T> &gnat)
         {
@@ -322,6 +361,20 @@ namespace ompl
     protected:
         using GNAT = NearestNeighborsGNAT<_T>;
 
+        /// \brief Write the bytes of \e value to \e out (used by saveStructure())
+        template <typename V>
+        static void writeValue(std::ostream &out, V value)
+        {
+            out.write(reinterpret_cast<const char *>(&value), sizeof(V));
+        }
+
+        /// \brief Read the bytes of \e value from \e in (used by loadStructure())
+        template <typename V>
+        static bool readValue(std::istream &in, V &value)
+        {
+            return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(V)));
+        }
+
         /// Return true iff data has been marked for removal.
         bool isRemoved(const _T &data) const
         {
@@ -575,7 +628,8 @@ namespace ompl
                 {
                     double dist;
                     Node *child;
-                    std::size_t sz = children_.size(), offset = gnat.offset_++;
+                    std::size_t sz = children_.size(),
+                                offset = gnat.offset_.fetch_add(1, std::memory_order_relaxed);
                     std::vector<double> distToPivot(sz);
                     std::vector<int> permutation(sz);
                     for (unsigned int i = 0; i < sz; ++i)
@@ -629,7 +683,8 @@ namespace ompl
                 if (!children_.empty())
                 {
                     Node *child;
-                    std::size_t sz = children_.size(), offset = gnat.offset_++;
+                    std::size_t sz = children_.size(),
+                                offset = gnat.offset_.fetch_add(1, std::memory_order_relaxed);
                     std::vector<double> distToPivot(sz);
                     std::vector<int> permutation(sz);
                     // Not a random permutation, but processing the children in slightly different order is
@@ -701,6 +756,88 @@ namespace ompl
                     child->list(gnat, data);
             }
 
+            /// Write the subtree rooted at this node (see NearestNeighborsGNAT::saveStructure()).
+            void save(std::ostream &out, const std::function<std::size_t(const _T &)> &index) const
+            {
+                writeValue<std::uint64_t>(out, index(pivot_));
+                writeValue<std::uint32_t>(out, degree_);
+                writeValue(out, minRadius_);
+                writeValue(out, maxRadius_);
+                writeValue<std::uint32_t>(out, minRange_.size());
+                for (std::size_t i = 0; i < minRange_.size(); ++i)
+                {
+                    writeValue(out, minRange_[i]);
+                    writeValue(out, maxRange_[i]);
+                }
+                writeValue<std::uint64_t>(out, data_.size());
+                for (const auto &d : data_)
+                    writeValue<std::uint64_t>(out, index(d));
+                writeValue<std::uint32_t>(out, children_.size());
+                for (const auto &child : children_)
+                    child->save(out, index);
+            }
+
+            /// Read a subtree written by save(), marking the elements it contains in \e seen. Return nullptr
+            /// if the data is inconsistent.
+            static Node *load(const GNAT &gnat, std::istream &in, const std::vector<_T> &elements,
+                              std::vector<bool> &seen)
+            {
+                std::uint64_t pivot, numData;
+                std::uint32_t degree, numRanges, numChildren;
+                double minRadius, maxRadius;
+                if (!readValue(in, pivot) || pivot >= elements.size() || seen[pivot] || !readValue(in, degree) ||
+                    !readValue(in, minRadius) || !readValue(in, maxRadius) || !readValue(in, numRanges) ||
+                    numRanges > gnat.maxDegree_)
+                    return nullptr;
+                seen[pivot] = true;
+
+                auto *node = new Node(numRanges, gnat.maxNumPtsPerLeaf_, elements[pivot]);
+                node->degree_ = degree;
+                node->minRadius_ = minRadius;
+                node->maxRadius_ = maxRadius;
+                bool valid = true;
+                for (std::uint32_t i = 0; i < numRanges && valid; ++i)
+                    valid = readValue(in, node->minRange_[i]) && readValue(in, node->maxRange_[i]);
+                valid = valid && readValue(in, numData) && numData <= elements.size();
+                for (std::uint64_t i = 0; i < numData && valid; ++i)
+                {
+                    std::uint64_t d;
+                    valid = readValue(in, d) && d < elements.size() && !seen[d];
+                    if (valid)
+                    {
+                        seen[d] = true;
+                        node->data_.push_back(elements[d]);
+                    }
+                }
+                // as after split(), internal nodes hold no data elements
+                valid = valid && readValue(in, numChildren) && numChildren <= gnat.maxDegree_ &&
+                        (numChildren == 0 || numData == 0);
+                if (valid && numChildren > 0)
+                {
+                    std::vector<_T> tmp;
+                    node->data_.swap(tmp);
+                }
+                for (std::uint32_t i = 0; i < numChildren && valid; ++i)
+                {
+                    // the children store their distance ranges to all of their siblings
+                    Node *child = load(gnat, in, elements, seen);
+                    valid = child != nullptr && child->minRange_.size() >= numChildren;
+                    if (child != nullptr)
+                        node->children_.push_back(child);
+                }
+                if (!valid)
+                {
+                    delete node;
+                    return nullptr;
+                }
+#ifdef GNAT_SAMPLER
+                node->subtreeSize_ = node->data_.size() + 1;
+                for (const auto &child : node->children_)
+                    node->subtreeSize_ += child->subtreeSize_;
+#endif
+                return node;
+            }
+
             friend std::ostream &operator<<(std::ostream &out, const Node &node)
             {
                 out << "\ndegree:\t" << node.degree_;
@@ -797,8 +934,9 @@ namespace ompl
 #endif
 
         /// \cond IGNORE
-        // used to cycle through children of a node in different orders
-        mutable std::size_t offset_{0};
+        // used to cycle through children of a node in different orders; atomic, as queries may run
+        // concurrently
+        mutable std::atomic<std::size_t> offset_{0};
         /// \endcond
     };
 }
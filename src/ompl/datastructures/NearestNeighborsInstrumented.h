@@ -0,0 +1,134 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_INSTRUMENTED_
+#define OMPL_DATASTRUCTURES_NEAREST_NEIGHBORS_INSTRUMENTED_
+
+#include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/base/Instrumentation.h"
+#include <memory>
+
+namespace ompl
+{
+    /** \brief A nearest neighbors datastructure that forwards all calls to another datastructure and records the
+        queries and insertions in a base::Instrumentation instance. */
+    template <typename _T>
+    class NearestNeighborsInstrumented : public NearestNeighbors<_T>
+    {
+    public:
+        /** \brief Take ownership of \e nn and record its queries and insertions in \e instrumentation */
+        NearestNeighborsInstrumented(NearestNeighbors<_T> *nn, base::InstrumentationPtr instrumentation)
+          : NearestNeighbors<_T>(), nn_(nn), instrumentation_(std::move(instrumentation))
+        {
+        }
+
+        ~NearestNeighborsInstrumented() override = default;
+
+        void setDistanceFunction(const typename NearestNeighbors<_T>::DistanceFunction &distFun) override
+        {
+            NearestNeighbors<_T>::setDistanceFunction(distFun);
+            nn_->setDistanceFunction(distFun);
+        }
+
+        bool reportsSortedResults() const override
+        {
+            return nn_->reportsSortedResults();
+        }
+
+        void clear() override
+        {
+            nn_->clear();
+        }
+
+        void add(const _T &data) override
+        {
+            base::Instrumentation::Scope scope(instrumentation_.get(),
+                                               base::Instrumentation::NEAREST_NEIGHBOR_INSERTION);
+            nn_->add(data);
+        }
+
+        void add(const std::vector<_T> &data) override
+        {
+            auto start = std::chrono::steady_clock::now();
+            nn_->add(data);
+            instrumentation_->record(base::Instrumentation::NEAREST_NEIGHBOR_INSERTION,
+                                     std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now() - start)
+                                         .count(),
+                                     data.size());
+        }
+
+        bool remove(const _T &data) override
+        {
+            return nn_->remove(data);
+        }
+
+        _T nearest(const _T &data) const override
+        {
+            base::Instrumentation::Scope scope(instrumentation_.get(), base::Instrumentation::NEAREST_NEIGHBOR_QUERY);
+            return nn_->nearest(data);
+        }
+
+        void nearestK(const _T &data, std::size_t k, std::vector<_T> &nbh) const override
+        {
+            base::Instrumentation::Scope scope(instrumentation_.get(), base::Instrumentation::NEAREST_NEIGHBOR_QUERY);
+            nn_->nearestK(data, k, nbh);
+        }
+
+        void nearestR(const _T &data, double radius, std::vector<_T> &nbh) const override
+        {
+            base::Instrumentation::Scope scope(instrumentation_.get(), base::Instrumentation::NEAREST_NEIGHBOR_QUERY);
+            nn_->nearestR(data, radius, nbh);
+        }
+
+        std::size_t size() const override
+        {
+            return nn_->size();
+        }
+
+        void list(std::vector<_T> &data) const override
+        {
+            nn_->list(data);
+        }
+
+    protected:
+        /** \brief The datastructure the calls are forwarded to */
+        std::unique_ptr<NearestNeighbors<_T>> nn_;
+
+        /** \brief The instrumentation the queries and insertions are recorded in */
+        base::InstrumentationPtr instrumentation_;
+    };
+}
+
+#endif
@@ -175,7 +175,8 @@ ompl::base::PlannerStatus ompl::geometric::CForest::solve(const base::PlannerTer
     checkValidity();
 
     time::point start = time::now();
-    std::vector<std::thread *> threads(planners_.size());
+    std::vector<std::thread> threads;
+    threads.reserve(planners_.size());
     const base::ReportIntermediateSolutionFn prevSolutionCallback =
         getProblemDefinition()->getIntermediateSolutionCallback();
 
@@ -189,20 +190,13 @@ ompl::base::PlannerStatus ompl::geometric::CForest::solve(const base::PlannerTer
     bestCost_ = opt_->infiniteCost();
 
     // run each planner in its own thread, with the same ptc.
-    for (std::size_t i = 0; i < threads.size(); ++i)
-    {
-        base::Planner *planner = planners_[i].get();
-        threads[i] = new std::thread([this, planner, &ptc]
-                                     {
-                                         return solve(planner, ptc);
-                                     });
-    }
-
+    for (auto &planner : planners_)
+        threads.emplace_back([this, &planner, &ptc]
+                             {
+                                 solve(planner.get(), ptc);
+                             });
     for (auto &thread : threads)
-    {
-        thread->join();
-        delete thread;
-    }
+        thread.join();
 
     // restore callback
     getProblemDefinition()->setIntermediateSolutionCallback(prevSolutionCallback);
@@ -38,6 +38,7 @@
 #define OMPL_GEOMETRIC_PLANNERS_EST_EST_
 
 #include "ompl/geometric/planners/PlannerIncludes.h"
+#include "ompl/datastructures/MotionPool.h"
 #include "ompl/datastructures/NearestNeighbors.h"
 #include "ompl/datastructures/PDF.h"
 #include <vector>
@@ -151,6 +152,9 @@ namespace ompl
             /// \brief The set of all states in the tree
             std::vector<Motion *> motions_;
 
+            /// \brief The memory of the motions in the tree, kept across calls to clear()
+            MotionPool<Motion> motionPool_;
+
             /// \brief The probability distribution function over states in the tree
             PDF<Motion *> pdf_;
 
@@ -40,7 +40,7 @@
 #include <limits>
 #include <cassert>
 
-ompl::geometric::EST::EST(const base::SpaceInformationPtr &si) : base::Planner(si, "EST")
+ompl::geometric::EST::EST(const base::SpaceInformationPtr &si) : base::Planner(si, "EST"), motionPool_(si)
 {
     specs_.approximateSolutions = true;
     specs_.directed = true;
@@ -87,12 +87,7 @@ void ompl::geometric::EST::clear()
 
 void ompl::geometric::EST::freeMemory()
 {
-    for (auto &motion : motions_)
-    {
-        if (motion->state != nullptr)
-            si_->freeState(motion->state);
-        delete motion;
-    }
+    motionPool_.clear();
 }
 
 ompl::base::PlannerStatus ompl::geometric::EST::solve(const base::PlannerTerminationCondition &ptc)
@@ -105,7 +100,7 @@ ompl::base::PlannerStatus ompl::geometric::EST::solve(const base::PlannerTermina
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
 
         nn_->nearestR(motion, nbrhoodRadius_, neighbors);
@@ -167,7 +162,7 @@ ompl::base::PlannerStatus ompl::geometric::EST::solve(const base::PlannerTermina
         if (si_->checkMotion(existing->state, xstate))
         {
             // create a motion
-            auto *motion = new Motion(si_);
+            auto *motion = motionPool_.allocate();
             si_->copyState(motion->state, xstate);
             motion->parent = existing;
 
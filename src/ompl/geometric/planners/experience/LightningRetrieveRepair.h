@@ -41,6 +41,8 @@
 #include "ompl/geometric/PathGeometric.h"
 #include "ompl/geometric/PathSimplifier.h"
 #include "ompl/datastructures/NearestNeighbors.h"
+#include <algorithm>
+#include <mutex>
 
 namespace ompl
 {
@@ -70,6 +72,11 @@ namespace ompl
            planning framework that learns from experience, in _IEEE Intl.
            Conf. Robotics and Automation (ICRA)_, 2012.
            [[PDF]](http://users.wpi.edu/~dberenson/lightning.pdf)
+
+           Instead of repairing only the most promising of the recalled paths, up to
+           getNumParallelRepairs() of the best candidates are repaired at the same time, each in its own
+           thread. As soon as one repair succeeds, the others are cancelled. The candidates are scored
+           on the shared ompl::ThreadPool.
         */
 
         /** \brief The Lightning Framework's Retrieve-Repair component */
@@ -113,9 +120,15 @@ namespace ompl
             /** \brief Pass a pointer of the database from the lightning framework */
             void setLightningDB(const tools::LightningDBPtr &experienceDB);
 
-            /** \brief Set the planner that will be used for repairing invalid paths recalled from experience */
+            /** \brief Set the planner that will be used for repairing invalid paths recalled from experience.
+                When several paths are repaired in parallel, this planner repairs the most promising one and
+                the others use planners obtained from the repair planner allocator. */
             void setRepairPlanner(const base::PlannerPtr &planner);
 
+            /** \brief Set the allocator for the additional repair planners needed when several paths are
+                repaired in parallel. By default, RRTConnect is used. */
+            void setRepairPlannerAllocator(const base::PlannerAllocator &pa);
+
             void setup() override;
 
             /**
@@ -126,6 +139,14 @@ namespace ompl
              */
             bool repairPath(const base::PlannerTerminationCondition &ptc, geometric::PathGeometric &primaryPath);
 
+            /**
+             * \brief Repairs a path to be valid in the current planning environment, using the repair planner
+             * with index \e repairID (0 <= repairID < getNumParallelRepairs())
+             * \return true if no error
+             */
+            bool repairPath(const base::PlannerTerminationCondition &ptc, geometric::PathGeometric &primaryPath,
+                            std::size_t repairID);
+
             /**
              * \brief Use our secondary planner to find a valid path between start and goal, and return that path
              * \param start
@@ -136,6 +157,10 @@ namespace ompl
             bool replan(const base::State *start, const base::State *goal, geometric::PathGeometric &newPathSegment,
                         const base::PlannerTerminationCondition &ptc);
 
+            /** \brief Same as above, but using the repair planner with index \e repairID */
+            bool replan(const base::State *start, const base::State *goal, geometric::PathGeometric &newPathSegment,
+                        const base::PlannerTerminationCondition &ptc, std::size_t repairID);
+
             /**
              * \brief Getter for number of 'k' close solutions to choose from database for further filtering
              */
@@ -152,6 +177,19 @@ namespace ompl
                 nearestK_ = nearestK;
             }
 
+            /** \brief Get the maximum number of recalled paths that are repaired at the same time */
+            unsigned int getNumParallelRepairs() const
+            {
+                return numParallelRepairs_;
+            }
+
+            /** \brief Set the maximum number of recalled paths that are repaired at the same time */
+            void setNumParallelRepairs(unsigned int numParallelRepairs)
+            {
+                numParallelRepairs_ = std::max(1u, numParallelRepairs);
+                setup_ = false;
+            }
+
         protected:
             /**
              * \brief Count the number of states along the discretized path that are in collision
@@ -162,13 +200,33 @@ namespace ompl
              */
             std::size_t checkMotionScore(const base::State *s1, const base::State *s2) const;
 
+            /** \brief The objects used by one repair, so that repairs can run concurrently */
+            struct Repairer
+            {
+                /** \brief The planner used for replanning */
+                base::PlannerPtr planner;
+
+                /** \brief The problem definition the planner uses */
+                base::ProblemDefinitionPtr pdef;
+
+                /** \brief The simplifier for the replanned segments */
+                geometric::PathSimplifierPtr simplifier;
+            };
+
             /**
-             * \brief Filters the top n paths in nearestPaths_ to the top 1, based on state validity with current
-             * environment
+             * \brief Filters the top n paths in nearestPaths_ to the (at most) getNumParallelRepairs() best ones,
+             * based on state validity with current environment. The chosen paths are ordered from best to worst
+             * and reversed when needed; their indices in nearestPaths_ are stored in \e chosenIDs.
              * \return true if no error
              */
-            bool findBestPath(const base::State *startState, const base::State *goalState,
-                              base::PlannerDataPtr &chosenPath);
+            bool findBestPaths(const base::State *startState, const base::State *goalState,
+                               std::vector<base::PlannerDataPtr> &chosenPaths, std::vector<std::size_t> &chosenIDs);
+
+            /** \brief Score a recalled path: the number of invalid states on it and on the motions connecting it
+                to the start and goal states. The path is considered in reverse if that brings its endpoints
+                closer to start and goal; \e distance is set to the distance between the endpoints. */
+            std::size_t scorePath(const base::State *startState, const base::State *goalState,
+                                  const base::PlannerData &path, bool &reversed, double &distance) const;
 
             /** \brief The database of motions to search through */
             tools::LightningDBPtr experienceDB_;
@@ -185,14 +243,26 @@ namespace ompl
             /** \brief A secondary problem definition for the repair planner to use */
             base::ProblemDefinitionPtr repairProblemDef_;
 
+            /** \brief Allocator for the repair planners used in addition to repairPlanner_ */
+            base::PlannerAllocator repairPlannerAllocator_;
+
+            /** \brief One entry per concurrent repair; the first one uses repairPlanner_ and repairProblemDef_ */
+            std::vector<Repairer> repairers_;
+
             /** \brief Debug the repair planner by saving its planner data each time it is used */
             std::vector<base::PlannerDataPtr> repairPlannerDatas_;
 
+            /** \brief Protects repairPlannerDatas_ while repairs run concurrently */
+            std::mutex repairPlannerDatasLock_;
+
             /** \brief The instance of the path simplifier */
             geometric::PathSimplifierPtr psk_;
 
             /** \brief Number of 'k' close solutions to choose from database for further filtering */
             int nearestK_;
+
+            /** \brief Maximum number of recalled paths that are repaired at the same time */
+            unsigned int numParallelRepairs_;
         };
     }
 }
@@ -41,10 +41,11 @@
 #include "ompl/tools/config/SelfConfig.h"
 #include "ompl/tools/config/MagicConstants.h"
 #include "ompl/tools/lightning/LightningDB.h"
-
-#include <thread>
+#include "ompl/util/ThreadPool.h"
 
 #include <limits>
+#include <numeric>
+#include <thread>
 #include <utility>
 
 ompl::geometric::LightningRetrieveRepair::LightningRetrieveRepair(const base::SpaceInformationPtr &si,
@@ -52,12 +53,17 @@ ompl::geometric::LightningRetrieveRepair::LightningRetrieveRepair(const base::Sp
   : base::Planner(si, "LightningRetrieveRepair")
   , experienceDB_(std::move(experienceDB))
   , nearestK_(ompl::magic::NEAREST_K_RECALL_SOLUTIONS)  // default value
+  , numParallelRepairs_(ompl::magic::NUM_PARALLEL_REPAIRS)
 {
     specs_.approximateSolutions = true;
     specs_.directed = true;
 
     // Repair Planner Specific:
     repairProblemDef_ = std::make_shared<base::ProblemDefinition>(si_);
+    repairPlannerAllocator_ = [](const base::SpaceInformationPtr &si)
+    {
+        return std::make_shared<RRTConnect>(si);
+    };
 
     psk_ = std::make_shared<PathSimplifier>(si_);
 }
@@ -68,9 +74,11 @@ void ompl::geometric::LightningRetrieveRepair::clear()
 {
     Planner::clear();
 
-    // Clear the inner planner
+    // Clear the inner planners
     if (repairPlanner_)
         repairPlanner_->clear();
+    for (auto &repairer : repairers_)
+        repairer.planner->clear();
 }
 
 void ompl::geometric::LightningRetrieveRepair::setLightningDB(const ompl::tools::LightningDBPtr &experienceDB)
@@ -86,6 +94,13 @@ void ompl::geometric::LightningRetrieveRepair::setRepairPlanner(const base::Plan
     setup_ = false;
 }
 
+void ompl::geometric::LightningRetrieveRepair::setRepairPlannerAllocator(const base::PlannerAllocator &pa)
+{
+    repairPlannerAllocator_ = pa;
+    repairers_.clear();
+    setup_ = false;
+}
+
 void ompl::geometric::LightningRetrieveRepair::setup()
 {
     Planner::setup();
@@ -107,6 +122,24 @@ void ompl::geometric::LightningRetrieveRepair::setup()
     repairPlanner_->setProblemDefinition(repairProblemDef_);
     if (!repairPlanner_->isSetup())
         repairPlanner_->setup();
+
+    // Each concurrent repair needs its own planner, problem definition and simplifier
+    repairers_.resize(numParallelRepairs_);
+    repairers_[0] = {repairPlanner_, repairProblemDef_, psk_};
+    for (std::size_t i = 1; i < repairers_.size(); ++i)
+    {
+        Repairer &repairer = repairers_[i];
+        if (!repairer.planner)
+        {
+            repairer.planner = repairPlannerAllocator_(si_);
+            repairer.pdef = std::make_shared<base::ProblemDefinition>(si_);
+            repairer.simplifier = std::make_shared<PathSimplifier>(si_);
+        }
+        repairer.pdef->setOptimizationObjective(pdef_->getOptimizationObjective());
+        repairer.planner->setProblemDefinition(repairer.pdef);
+        if (!repairer.planner->isSetup())
+            repairer.planner->setup();
+    }
 }
 
 ompl::base::PlannerStatus ompl::geometric::LightningRetrieveRepair::solve(const base::PlannerTerminationCondition &ptc)
@@ -146,39 +179,73 @@ ompl::base::PlannerStatus ompl::geometric::LightningRetrieveRepair::solve(const
         return base::PlannerStatus::TIMEOUT;  // The planner failed to find a solution
     }
 
-    ompl::base::PlannerDataPtr chosenPath;
+    std::vector<ompl::base::PlannerDataPtr> chosenPaths;
+    std::vector<std::size_t> chosenIDs;
 
-    // Filter top n paths to 1
-    // TODO Rather than selecting 1 best path, you could also spawn n (n<=k) threads and repair the top n paths.
-    if (!findBestPath(startState, goalState, chosenPath))
+    // Filter top n paths to the ones we will try to repair
+    if (!findBestPaths(startState, goalState, chosenPaths, chosenIDs))
     {
         return base::PlannerStatus::ABORT;
     }
 
-    // All saved trajectories should be at least 2 states long
-    assert(chosenPath->numVertices() >= 2);
-
-    // Convert chosen PlannerData experience to an actual path
-    auto primaryPath(std::make_shared<PathGeometric>(si_));
-    // Add start
-    primaryPath->append(startState);
-    // Add old states
-    for (std::size_t i = 0; i < chosenPath->numVertices(); ++i)
+    // Convert chosen PlannerData experiences to actual paths
+    std::vector<PathGeometricPtr> candidatePaths;
+    for (const auto &chosenPath : chosenPaths)
     {
-        primaryPath->append(chosenPath->getVertex(i).getState());
-    }
-    // Add goal
-    primaryPath->append(goalState);
+        // All saved trajectories should be at least 2 states long
+        assert(chosenPath->numVertices() >= 2);
+
+        auto candidatePath(std::make_shared<PathGeometric>(si_));
+        // Add start
+        candidatePath->append(startState);
+        // Add old states
+        for (std::size_t i = 0; i < chosenPath->numVertices(); ++i)
+        {
+            candidatePath->append(chosenPath->getVertex(i).getState());
+        }
+        // Add goal
+        candidatePath->append(goalState);
 
-    // All save trajectories should be at least 2 states long, and then we append the start and goal states
-    assert(primaryPath->getStateCount() >= 4);
+        // All save trajectories should be at least 2 states long, and then we append the start and goal states
+        assert(candidatePath->getStateCount() >= 4);
+        candidatePaths.push_back(candidatePath);
+    }
 
-    // Repair chosen path
-    if (!repairPath(ptc, *primaryPath))
+    // Repair the chosen paths concurrently. The first successful repair terminates the others.
+    base::PlannerTerminationCondition repairPtc([&ptc]
+                                                {
+                                                    return ptc();
+                                                });
+    std::mutex winnerLock;
+    std::size_t winner = candidatePaths.size();
+    // The repairs plan until ptc is true, so each runs in a thread of its own rather than on the pool, where
+    // they could run one after the other.
+    std::vector<std::thread> threads;
+    threads.reserve(candidatePaths.size());
+    for (std::size_t i = 0; i < candidatePaths.size(); ++i)
+        threads.emplace_back([this, i, &candidatePaths, &repairPtc, &winnerLock, &winner]
+                             {
+                                 if (!repairPath(repairPtc, *candidatePaths[i], i))
+                                     return;
+                                 std::lock_guard<std::mutex> lock(winnerLock);
+                                 if (winner == candidatePaths.size())
+                                 {
+                                     winner = i;
+                                     repairPtc.terminate();
+                                 }
+                             });
+    for (auto &thread : threads)
+        thread.join();
+
+    if (winner == candidatePaths.size())
     {
         OMPL_INFORM("LightningRetrieveRepair: repairPath failed or aborted");
         return base::PlannerStatus::ABORT;
     }
+    nearestPathsChosenID_ = chosenIDs[winner];
+    PathGeometricPtr primaryPath = candidatePaths[winner];
+    OMPL_INFORM("LightningRetrieveRepair: Using repaired path %d (%d of %d repaired concurrently)",
+                (int)nearestPathsChosenID_, (int)winner + 1, (int)candidatePaths.size());
 
     // Smooth the result
     OMPL_INFORM("LightningRetrieveRepair solve: Simplifying solution (smoothing)...");
@@ -195,155 +262,129 @@ ompl::base::PlannerStatus ompl::geometric::LightningRetrieveRepair::solve(const
     return {solved, false};
 }
 
-bool ompl::geometric::LightningRetrieveRepair::findBestPath(const base::State *startState, const base::State *goalState,
-                                                            ompl::base::PlannerDataPtr &chosenPath)
+std::size_t ompl::geometric::LightningRetrieveRepair::scorePath(const base::State *startState,
+                                                                const base::State *goalState,
+                                                                const base::PlannerData &path, bool &reversed,
+                                                                double &distance) const
 {
-    OMPL_INFORM("LightningRetrieveRepair: Found %d similar paths. Filtering", nearestPaths_.size());
-
-    // Filter down to just 1 chosen path
-    ompl::base::PlannerDataPtr bestPath = nearestPaths_.front();
-    std::size_t bestPathScore = std::numeric_limits<std::size_t>::max();
-
-    // Track which path has the shortest distance
-    std::vector<double> distances(nearestPaths_.size(), 0);
-    std::vector<bool> isReversed(nearestPaths_.size());
+    const ompl::base::State *pathStartState = path.getVertex(0).getState();
+    const ompl::base::State *pathGoalState = path.getVertex(path.numVertices() - 1).getState();
 
-    assert(isReversed.size() == nearestPaths_.size());
+    double regularDistance = si_->distance(startState, pathStartState) + si_->distance(goalState, pathGoalState);
+    double reversedDistance = si_->distance(startState, pathGoalState) + si_->distance(goalState, pathStartState);
 
-    for (std::size_t pathID = 0; pathID < nearestPaths_.size(); ++pathID)
-    {
-        const ompl::base::PlannerDataPtr &currentPath = nearestPaths_[pathID];
+    // Check if path is reversed from normal [start->goal] direction and cache the distance
+    // We won't actually flip it until later to save memory operations and not alter our NN tree in the LightningDB
+    reversed = regularDistance > reversedDistance;
+    distance = reversed ? reversedDistance : regularDistance;
 
-        // Error check
-        if (currentPath->numVertices() < 2)  // needs at least a start and a goal
-        {
-            OMPL_ERROR("A path was recalled that somehow has less than 2 vertices, which shouldn't happen");
-            return false;
-        }
-
-        const ompl::base::State *pathStartState = currentPath->getVertex(0).getState();
-        const ompl::base::State *pathGoalState = currentPath->getVertex(currentPath->numVertices() - 1).getState();
+    std::size_t pathScore = 0;  // the score
 
-        double regularDistance = si_->distance(startState, pathStartState) + si_->distance(goalState, pathGoalState);
-        double reversedDistance = si_->distance(startState, pathGoalState) + si_->distance(goalState, pathStartState);
+    // Check the validity between our start location and the path's start
+    // TODO: this might bias the score to be worse for the little connecting segment
+    pathScore += checkMotionScore(startState, reversed ? pathGoalState : pathStartState);
 
-        // Check if path is reversed from normal [start->goal] direction and cache the distance
-        if (regularDistance > reversedDistance)
-        {
-            // The distance between starts and goals is less when in reverse
-            isReversed[pathID] = true;
-            distances[pathID] = reversedDistance;
-            // We won't actually flip it until later to save memory operations and not alter our NN tree in the
-            // LightningDB
-        }
-        else
-        {
-            isReversed[pathID] = false;
-            distances[pathID] = regularDistance;
-        }
-
-        std::size_t pathScore = 0;  // the score
-
-        // Check the validity between our start location and the path's start
-        // TODO: this might bias the score to be worse for the little connecting segment
-        if (!isReversed[pathID])
-            pathScore += checkMotionScore(startState, pathStartState);
-        else
-            pathScore += checkMotionScore(startState, pathGoalState);
-
-        // Score current path for validity
-        std::size_t invalidStates = 0;
-        for (std::size_t vertex_id = 0; vertex_id < currentPath->numVertices(); ++vertex_id)
+    // Score current path for validity
+    for (std::size_t vertex_id = 0; vertex_id < path.numVertices(); ++vertex_id)
+    {
+        // Check if the sampled points are valid
+        if (!si_->isValid(path.getVertex(vertex_id).getState()))
         {
-            // Check if the sampled points are valid
-            if (!si_->isValid(currentPath->getVertex(vertex_id).getState()))
-            {
-                invalidStates++;
-            }
+            pathScore++;
         }
-        // Track separate for debugging
-        pathScore += invalidStates;
+    }
 
-        // Check the validity between our goal location and the path's goal
-        // TODO: this might bias the score to be worse for the little connecting segment
-        if (!isReversed[pathID])
-            pathScore += checkMotionScore(goalState, pathGoalState);
-        else
-            pathScore += checkMotionScore(goalState, pathStartState);
+    // Check the validity between our goal location and the path's goal
+    // TODO: this might bias the score to be worse for the little connecting segment
+    pathScore += checkMotionScore(goalState, reversed ? pathStartState : pathGoalState);
 
-        // Factor in the distance between start/goal and our new start/goal
-        OMPL_INFORM("LightningRetrieveRepair: Path %d | %d vertices | %d invalid | score %d | reversed: %s | "
-                    "distance: %f",
-                    int(pathID), currentPath->numVertices(), invalidStates, pathScore,
-                    isReversed[pathID] ? "true" : "false", distances[pathID]);
+    return pathScore;
+}
 
-        // Check if we have a perfect score (0) and this is the shortest path (the first one)
-        if (pathID == 0 && pathScore == 0)
-        {
-            OMPL_DEBUG("LightningRetrieveRepair:  --> The shortest path (path 0) has a perfect score (0), ending "
-                       "filtering early.");
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
-            break;  // end the for loop
-        }
+bool ompl::geometric::LightningRetrieveRepair::findBestPaths(const base::State *startState,
+                                                             const base::State *goalState,
+                                                             std::vector<base::PlannerDataPtr> &chosenPaths,
+                                                             std::vector<std::size_t> &chosenIDs)
+{
+    OMPL_INFORM("LightningRetrieveRepair: Found %d similar paths. Filtering", nearestPaths_.size());
 
-        // Check if this is the best score we've seen so far
-        if (pathScore < bestPathScore)
-        {
-            OMPL_DEBUG("LightningRetrieveRepair:  --> This path is the best we've seen so far. Previous best: %d",
-                       bestPathScore);
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
-        }
-        // if the best score is the same as a previous one we've seen,
-        // choose the one that has the shortest connecting component
-        else if (pathScore == bestPathScore && distances[nearestPathsChosenID_] > distances[pathID])
+    for (const auto &currentPath : nearestPaths_)
+    {
+        // Error check
+        if (currentPath->numVertices() < 2)  // needs at least a start and a goal
         {
-            // This new path is a shorter distance
-            OMPL_DEBUG("LightningRetrieveRepair:  --> This path is as good as the best we've seen so far, but its path "
-                       "is shorter. Previous best score: %d from index %d",
-                       bestPathScore, nearestPathsChosenID_);
-            bestPathScore = pathScore;
-            bestPath = currentPath;
-            nearestPathsChosenID_ = pathID;
+            OMPL_ERROR("A path was recalled that somehow has less than 2 vertices, which shouldn't happen");
+            return false;
         }
-        else
-            OMPL_DEBUG("LightningRetrieveRepair:  --> Not best. Best score: %d from index %d", bestPathScore,
-                       nearestPathsChosenID_);
     }
 
-    // Check if we have a solution
-    if (!bestPath)
+    std::vector<std::size_t> scores(nearestPaths_.size());
+    std::vector<double> distances(nearestPaths_.size(), 0);
+    std::vector<char> isReversed(nearestPaths_.size());
+
+    // Check if the shortest path (the first one) has a perfect score (0); in that case it is the only one we need
+    bool reversed;
+    scores[0] = scorePath(startState, goalState, *nearestPaths_[0], reversed, distances[0]);
+    isReversed[0] = reversed;
+    std::size_t candidates = nearestPaths_.size();
+    if (scores[0] == 0)
     {
-        OMPL_ERROR("LightningRetrieveRepair: No best path found from k filtered paths");
-        return false;
+        OMPL_DEBUG("LightningRetrieveRepair:  --> The shortest path (path 0) has a perfect score (0), ending "
+                   "filtering early.");
+        candidates = 1;
     }
-    if ((bestPath->numVertices() == 0u) || bestPath->numVertices() == 1)
+    else
     {
-        OMPL_ERROR("LightningRetrieveRepair: Only %d vertices found in PlannerData loaded from file. This is a bug.",
-                   bestPath->numVertices());
-        return false;
+        // Scoring is dominated by collision checking, so score the remaining paths concurrently
+        std::vector<std::function<void()>> tasks;
+        for (std::size_t pathID = 1; pathID < candidates; ++pathID)
+            tasks.emplace_back([this, pathID, startState, goalState, &scores, &distances, &isReversed]
+                               {
+                                   bool rev;
+                                   scores[pathID] =
+                                       scorePath(startState, goalState, *nearestPaths_[pathID], rev, distances[pathID]);
+                                   isReversed[pathID] = rev;
+                               });
+        ThreadPool::global().run(tasks);
     }
 
-    // Reverse the path if necessary. We allocate memory for this so that we don't alter the database
-    if (isReversed[nearestPathsChosenID_])
+    for (std::size_t pathID = 0; pathID < candidates; ++pathID)
+        OMPL_INFORM("LightningRetrieveRepair: Path %d | %d vertices | score %d | reversed: %s | distance: %f",
+                    int(pathID), nearestPaths_[pathID]->numVertices(), scores[pathID],
+                    isReversed[pathID] ? "true" : "false", distances[pathID]);
+
+    // Order by score; if the scores are the same, choose the one that has the shortest connecting component
+    std::vector<std::size_t> order(candidates);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&scores, &distances](std::size_t a, std::size_t b)
+                     {
+                         return scores[a] < scores[b] || (scores[a] == scores[b] && distances[a] < distances[b]);
+                     });
+    order.resize(std::min<std::size_t>(order.size(), repairers_.size()));
+
+    chosenPaths.clear();
+    chosenIDs.clear();
+    for (std::size_t pathID : order)
     {
-        OMPL_DEBUG("LightningRetrieveRepair: Reversing planner data vertices count %d", bestPath->numVertices());
-        auto newPath(std::make_shared<ompl::base::PlannerData>(si_));
-        for (std::size_t i = bestPath->numVertices(); i > 0; --i)  // size_t can't go negative so subtract 1 instead
+        const ompl::base::PlannerDataPtr &bestPath = nearestPaths_[pathID];
+        OMPL_DEBUG("LightningRetrieveRepair:  --> Chose path %d with score %d", pathID, scores[pathID]);
+
+        // Reverse the path if necessary. We allocate memory for this so that we don't alter the database
+        if (isReversed[pathID])
         {
-            newPath->addVertex(bestPath->getVertex(i - 1));
+            OMPL_DEBUG("LightningRetrieveRepair: Reversing planner data vertices count %d", bestPath->numVertices());
+            auto newPath(std::make_shared<ompl::base::PlannerData>(si_));
+            for (std::size_t i = bestPath->numVertices(); i > 0; --i)  // size_t can't go negative so subtract 1
+            {
+                newPath->addVertex(bestPath->getVertex(i - 1));
+            }
+            chosenPaths.push_back(newPath);
         }
-        // Set result
-        chosenPath = newPath;
-    }
-    else
-    {
-        // Set result
-        chosenPath = bestPath;
+        else
+            chosenPaths.push_back(bestPath);
+        chosenIDs.push_back(pathID);
     }
+    nearestPathsChosenID_ = chosenIDs.front();
     OMPL_DEBUG("LightningRetrieveRepair: Done Filtering\n");
 
     return true;
@@ -351,6 +392,13 @@ bool ompl::geometric::LightningRetrieveRepair::findBestPath(const base::State *s
 
 bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTerminationCondition &ptc,
                                                           ompl::geometric::PathGeometric &primaryPath)
+{
+    return repairPath(ptc, primaryPath, 0);
+}
+
+bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTerminationCondition &ptc,
+                                                          ompl::geometric::PathGeometric &primaryPath,
+                                                          std::size_t repairID)
 {
     // \todo: we should reuse our collision checking from the previous step to make this faster
 
@@ -420,7 +468,7 @@ bool ompl::geometric::LightningRetrieveRepair::repairPath(const base::PlannerTer
             // Not valid motion, replan
             OMPL_DEBUG("LightningRetrieveRepair: Planning from %d to %d", fromID, toID);
 
-            if (!replan(fromState, toState, newPathSegment, ptc))
+            if (!replan(fromState, toState, newPathSegment, ptc, repairID))
             {
                 OMPL_INFORM("LightningRetrieveRepair: Unable to repair path between state %d and %d", fromID, toID);
                 return false;
@@ -473,26 +521,37 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
                                                       PathGeometric &newPathSegment,
                                                       const base::PlannerTerminationCondition &ptc)
 {
+    return replan(start, goal, newPathSegment, ptc, 0);
+}
+
+bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *start, const ompl::base::State *goal,
+                                                      PathGeometric &newPathSegment,
+                                                      const base::PlannerTerminationCondition &ptc,
+                                                      std::size_t repairID)
+{
+    const base::PlannerPtr &repairPlanner = repairers_[repairID].planner;
+    const base::ProblemDefinitionPtr &repairProblemDef = repairers_[repairID].pdef;
+
     // Reset problem definition
-    repairProblemDef_->clearSolutionPaths();
-    repairProblemDef_->clearStartStates();
-    repairProblemDef_->clearGoal();
+    repairProblemDef->clearSolutionPaths();
+    repairProblemDef->clearStartStates();
+    repairProblemDef->clearGoal();
 
     // Reset planner
-    repairPlanner_->clear();
+    repairPlanner->clear();
 
     // Configure problem definition
-    repairProblemDef_->setStartAndGoalStates(start, goal);
+    repairProblemDef->setStartAndGoalStates(start, goal);
 
     // Configure planner
-    repairPlanner_->setProblemDefinition(repairProblemDef_);
+    repairPlanner->setProblemDefinition(repairProblemDef);
 
     // Solve
     OMPL_INFORM("LightningRetrieveRepair: Preparing to repair path");
     base::PlannerStatus lastStatus = base::PlannerStatus::UNKNOWN;
     time::point startTime = time::now();
 
-    lastStatus = repairPlanner_->solve(ptc);
+    lastStatus = repairPlanner->solve(ptc);
 
     // Results
     double planTime = time::seconds(time::now() - startTime);
@@ -504,15 +563,15 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
     }
 
     // Check if approximate
-    if (repairProblemDef_->hasApproximateSolution() ||
-        repairProblemDef_->getSolutionDifference() > std::numeric_limits<double>::epsilon())
+    if (repairProblemDef->hasApproximateSolution() ||
+        repairProblemDef->getSolutionDifference() > std::numeric_limits<double>::epsilon())
     {
         OMPL_INFORM("LightningRetrieveRepair: Solution is approximate, not using");
         return false;
     }
 
     // Convert solution into a PathGeometric path
-    base::PathPtr p = repairProblemDef_->getSolutionPath();
+    base::PathPtr p = repairProblemDef->getSolutionPath();
     if (!p)
     {
         OMPL_ERROR("LightningRetrieveRepair: Unable to get solution path from problem definition");
@@ -525,16 +584,19 @@ bool ompl::geometric::LightningRetrieveRepair::replan(const ompl::base::State *s
     OMPL_INFORM("LightningRetrieveRepair: Simplifying solution (smoothing)...");
     time::point simplifyStart = time::now();
     std::size_t numStates = newPathSegment.getStateCount();
-    psk_->simplify(newPathSegment, ptc);
+    repairers_[repairID].simplifier->simplify(newPathSegment, ptc);
     double simplifyTime = time::seconds(time::now() - simplifyStart);
     OMPL_INFORM("LightningRetrieveRepair: Path simplification took %f seconds and removed %d states", simplifyTime,
                 numStates - newPathSegment.getStateCount());
 
     // Save the planner data for debugging purposes
-    repairPlannerDatas_.push_back(std::make_shared<ompl::base::PlannerData>(si_));
-    repairPlanner_->getPlannerData(*repairPlannerDatas_.back());
-    repairPlannerDatas_.back()->decoupleFromPlanner();  // copy states so that when planner unloads/clears we don't lose
-                                                        // them
+    auto repairPlannerData(std::make_shared<ompl::base::PlannerData>(si_));
+    repairPlanner->getPlannerData(*repairPlannerData);
+    repairPlannerData->decoupleFromPlanner();  // copy states so that when planner unloads/clears we don't lose them
+    {
+        std::lock_guard<std::mutex> lock(repairPlannerDatasLock_);
+        repairPlannerDatas_.push_back(repairPlannerData);
+    }
 
     // Return success
     OMPL_INFORM("LightningRetrieveRepair: solution found in %f seconds with %d states", planTime,
@@ -39,6 +39,7 @@
 /* Acknowledgements for insightful comments: Oren Salzman (Tel Aviv University),
  *                                           Joseph Starek (Stanford) */
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
 
@@ -213,25 +214,40 @@ void ompl::geometric::FMT::sampleFree(const base::PlannerTerminationCondition &p
 {
     unsigned int nodeCount = 0;
     unsigned int sampleAttempts = 0;
-    auto *motion = new Motion(si_);
+    std::vector<Motion *> motions;
+    std::vector<base::State *> states;
 
-    // Sample numSamples_ number of nodes from the free configuration space
+    // Sample numSamples_ number of nodes from the free configuration space. The states are drawn in batches, but
+    // never more than are still needed, so the number of attempts is the same as when sampling one at a time.
+    const std::size_t batchSize = 128;
     while (nodeCount < numSamples_ && !ptc)
     {
-        sampler_->sampleUniform(motion->getState());
-        sampleAttempts++;
-
-        bool collision_free = si_->isValid(motion->getState());
-
-        if (collision_free)
-        {
-            nodeCount++;
-            nn_->add(motion);
-            motion = new Motion(si_);
-        }  // If collision free
-    }      // While nodeCount < numSamples
-    si_->freeState(motion->getState());
-    delete motion;
+        const std::size_t count = std::min<std::size_t>(batchSize, numSamples_ - nodeCount);
+        while (motions.size() < count)
+            motions.push_back(new Motion(si_));
+        states.resize(count);
+        for (std::size_t i = 0; i < count; ++i)
+            states[i] = motions[i]->getState();
+        sampler_->sampleUniformBatch(states.data(), count);
+        sampleAttempts += count;
+
+        // Add the collision free samples; the motions of the others are kept for the next batch
+        std::size_t unused = 0;
+        for (std::size_t i = 0; i < motions.size(); ++i)
+            if (i < count && si_->isValid(motions[i]->getState()))
+            {
+                nodeCount++;
+                nn_->add(motions[i]);
+            }
+            else
+                motions[unused++] = motions[i];
+        motions.resize(unused);
+    }  // While nodeCount < numSamples
+    for (auto &motion : motions)
+    {
+        si_->freeState(motion->getState());
+        delete motion;
+    }
 
     // 95% confidence limit for an upper bound for the true free space volume
     freeSpaceVolume_ = boost::math::binomial_distribution<>::find_upper_bound_on_p(sampleAttempts, nodeCount, 0.05) *
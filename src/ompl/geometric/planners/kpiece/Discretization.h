@@ -85,6 +85,12 @@ namespace ompl
                 /** \brief The iteration at which this cell was created */
                 unsigned int iteration{0};
 
+                /** \brief The coverage of this cell reported by other
+                    discretizations of the same projection (e.g., trees
+                    grown in parallel). This is zero unless
+                    updateExternalCoverage() is called. */
+                double externalCoverage{0.0};
+
                 /** \brief The computed importance (based on other class members) */
                 double importance{0.0};
             };
@@ -150,10 +156,20 @@ namespace ompl
                 grid_.setDimension(dim);
             }
 
-            /** \brief Restore the discretization to its original form */
-            void clear()
+            /** \brief Set the range of coordinates (typically computed from the bounds of the projection) for
+                which the grid uses a dense array index instead of hashing. Returns false if the range is not
+                suitable for a dense index, in which case only hashing is used. */
+            bool setCoordinateBounds(const Coord &low, const Coord &high)
             {
-                freeMemory();
+                return grid_.setDenseBounds(low, high);
+            }
+
+            /** \brief Restore the discretization to its original form. If \e freeMotions is false, the motions
+                are not passed to the function given to the constructor; this is for callers that free all
+                motions at once. */
+            void clear(bool freeMotions = true)
+            {
+                freeMemory(freeMotions);
                 size_ = 0;
                 iteration_ = 1;
                 recentCell_ = nullptr;
@@ -174,11 +190,12 @@ namespace ompl
                 return grid_.size();
             }
 
-            /** \brief Free the memory for the motions contained in a grid */
-            void freeMemory()
+            /** \brief Free the memory for the motions contained in a grid (only the cells if \e freeMotions is
+                false) */
+            void freeMemory(bool freeMotions = true)
             {
                 for (auto it = grid_.begin(); it != grid_.end(); ++it)
-                    freeCellData(it->second->data);
+                    freeCellData(it->second->data, freeMotions);
                 grid_.clear();
             }
 
@@ -279,6 +296,19 @@ namespace ompl
                 return grid_;
             }
 
+            /** \brief Set the external coverage of every cell to the
+                value returned by \e externalCoverage for the cell's
+                coordinates and recompute the importance of all
+                cells. Cells that other discretizations have covered
+                well become less important, so exploration is steered
+                towards regions that have not been explored elsewhere. */
+            void updateExternalCoverage(const std::function<double(const Coord &)> &externalCoverage)
+            {
+                for (auto it = grid_.begin(); it != grid_.end(); ++it)
+                    it->second->data->externalCoverage = externalCoverage(it->second->coord);
+                grid_.updateAll();
+            }
+
             void getPlannerData(base::PlannerData &data, int tag, bool start, const Motion *lastGoalMotion) const
             {
                 std::vector<CellData *> cdata;
@@ -311,10 +341,11 @@ namespace ompl
 
         private:
             /** \brief Free the memory for the data contained in a grid cell */
-            void freeCellData(CellData *cdata)
+            void freeCellData(CellData *cdata, bool freeMotions = true)
             {
-                for (unsigned int i = 0; i < cdata->motions.size(); ++i)
-                    freeMotion_(cdata->motions[i]);
+                if (freeMotions)
+                    for (unsigned int i = 0; i < cdata->motions.size(); ++i)
+                        freeMotion_(cdata->motions[i]);
                 delete cdata;
             }
 
@@ -324,7 +355,7 @@ namespace ompl
             static void computeImportance(Cell *cell, void * /*unused*/)
             {
                 CellData &cd = *(cell->data);
-                cd.importance = cd.score / ((cell->neighbors + 1) * cd.coverage * cd.selections);
+                cd.importance = cd.score / ((cell->neighbors + 1) * (cd.coverage + cd.externalCoverage) * cd.selections);
             }
 
             /** \brief A grid containing motions, imposed on a
@@ -39,6 +39,7 @@
 
 #include "ompl/geometric/planners/PlannerIncludes.h"
 #include "ompl/geometric/planners/kpiece/Discretization.h"
+#include "ompl/datastructures/MotionPool.h"
 
 namespace ompl
 {
@@ -218,6 +219,10 @@ namespace ompl
             /** \brief A state space sampler */
             base::StateSamplerPtr sampler_;
 
+            /** \brief The memory of the motions in the tree, kept across calls to clear(). This must outlive \e
+             * disc_, which returns its motions here when it is destroyed. */
+            MotionPool<Motion> motionPool_;
+
             /** \brief The tree datastructure and the grid that covers it */
             Discretization<Motion> disc_;
 
@@ -0,0 +1,298 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_GEOMETRIC_PLANNERS_KPIECE_PKPIECE1_
+#define OMPL_GEOMETRIC_PLANNERS_KPIECE_PKPIECE1_
+
+#include "ompl/geometric/planners/PlannerIncludes.h"
+#include "ompl/geometric/planners/kpiece/Discretization.h"
+#include "ompl/base/StateSamplerArray.h"
+#include "ompl/datastructures/Grid.h"
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ompl
+{
+    namespace geometric
+    {
+        /**
+           @anchor gpKPIECE1
+           @par Short description
+           pKPIECE1 is a parallel version of KPIECE1. Each thread grows
+           its own tree, with its own discretization of the same
+           projection, using the same cell selection and cell
+           importance heuristics as KPIECE1. Every few iterations
+           (see setMergeInterval()), each thread publishes the
+           coverage of its cells to a shared grid and reads back the
+           coverage the other threads have achieved in the same
+           cells. That external coverage lowers the importance of a
+           cell, so the threads spread out over the projection
+           instead of all exploring the same region. Once a thread
+           finds a solution, all threads terminate.
+           @par External documentation
+           I.A. Şucan and L.E. Kavraki, Kinodynamic motion planning by interior-exterior cell exploration,
+           in <em>Workshop on the Algorithmic Foundations of Robotics</em>, Dec. 2008.<br>
+           [[PDF]](http://ioan.sucan.ro/files/pubs/wafr2008.pdf)
+        */
+
+        /** \brief Parallel Kinematic Planning by Interior-Exterior Cell Exploration */
+        class pKPIECE1 : public base::Planner
+        {
+        public:
+            /** \brief Constructor */
+            pKPIECE1(const base::SpaceInformationPtr &si);
+
+            ~pKPIECE1() override;
+
+            base::PlannerStatus solve(const base::PlannerTerminationCondition &ptc) override;
+
+            void clear() override;
+
+            /** \brief Set the goal bias. See KPIECE1::setGoalBias() */
+            void setGoalBias(double goalBias)
+            {
+                goalBias_ = goalBias;
+            }
+
+            /** \brief Get the goal bias the planner is using */
+            double getGoalBias() const
+            {
+                return goalBias_;
+            }
+
+            /** \brief Set the range the planner is supposed to use. See KPIECE1::setRange() */
+            void setRange(double distance)
+            {
+                maxDistance_ = distance;
+            }
+
+            /** \brief Get the range the planner is using */
+            double getRange() const
+            {
+                return maxDistance_;
+            }
+
+            /** \brief Set the fraction of time for focusing on the
+                border (between 0 and 1). See KPIECE1::setBorderFraction() */
+            void setBorderFraction(double bp);
+
+            /** \brief Get the fraction of time to focus exploration
+                on boundary */
+            double getBorderFraction() const
+            {
+                return selectBorderFraction_;
+            }
+
+            /** \brief Set the minimum fraction of a motion that needs
+                to be valid for the motion to be kept. See
+                KPIECE1::setMinValidPathFraction() */
+            void setMinValidPathFraction(double fraction)
+            {
+                minValidPathFraction_ = fraction;
+            }
+
+            /** \brief Get the value of the fraction set by setMinValidPathFraction() */
+            double getMinValidPathFraction() const
+            {
+                return minValidPathFraction_;
+            }
+
+            /** \brief Set the factor that is multiplied to a cell's
+                score if extending a motion from that cell failed. See
+                KPIECE1::setFailedExpansionCellScoreFactor() */
+            void setFailedExpansionCellScoreFactor(double factor)
+            {
+                failedExpansionScoreFactor_ = factor;
+            }
+
+            /** \brief Get the factor that is multiplied to a cell's
+                score if extending a motion from that cell failed. */
+            double getFailedExpansionCellScoreFactor() const
+            {
+                return failedExpansionScoreFactor_;
+            }
+
+            /** \brief Set the number of threads (and trees) used by
+                the planner. Changing the number of threads clears the
+                planner. */
+            void setThreadCount(unsigned int nthreads);
+
+            /** \brief Get the number of threads used by the planner */
+            unsigned int getThreadCount() const
+            {
+                return threadCount_;
+            }
+
+            /** \brief Set the number of iterations a thread performs
+                between two exchanges of cell coverage with the other
+                threads. */
+            void setMergeInterval(unsigned int iterations)
+            {
+                mergeInterval_ = iterations;
+            }
+
+            /** \brief Get the number of iterations between two exchanges of cell coverage */
+            unsigned int getMergeInterval() const
+            {
+                return mergeInterval_;
+            }
+
+            /** \brief Set the projection evaluator. This class is
+                able to compute the projection of a given state. */
+            void setProjectionEvaluator(const base::ProjectionEvaluatorPtr &projectionEvaluator)
+            {
+                projectionEvaluator_ = projectionEvaluator;
+            }
+
+            /** \brief Set the projection evaluator (select one from
+                the ones registered with the state space). */
+            void setProjectionEvaluator(const std::string &name)
+            {
+                projectionEvaluator_ = si_->getStateSpace()->getProjection(name);
+            }
+
+            /** \brief Get the projection evaluator */
+            const base::ProjectionEvaluatorPtr &getProjectionEvaluator() const
+            {
+                return projectionEvaluator_;
+            }
+
+            void setup() override;
+
+            void getPlannerData(base::PlannerData &data) const override;
+
+        protected:
+            /** \brief Representation of a motion for this algorithm */
+            class Motion
+            {
+            public:
+                Motion() = default;
+
+                /** \brief Constructor that allocates memory for the state */
+                Motion(const base::SpaceInformationPtr &si) : state(si->allocState())
+                {
+                }
+
+                ~Motion() = default;
+
+                /** \brief The state contained by this motion */
+                base::State *state{nullptr};
+
+                /** \brief The parent motion in the exploration tree */
+                Motion *parent{nullptr};
+            };
+
+            /** \brief The solution found by any of the threads */
+            struct SolutionInfo
+            {
+                Motion *solution;
+                Motion *approxsol;
+                double approxdif;
+                std::mutex lock;
+            };
+
+            /** \brief The coverage of a cell achieved by each of the threads */
+            using CoverageGrid = Grid<std::vector<double>>;
+
+            /** \brief The exploration loop run by thread \e tid */
+            void threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc, SolutionInfo *sol);
+
+            /** \brief Publish the cell coverage of thread \e tid and
+                update its cells with the coverage of the other threads */
+            void mergeCoverage(unsigned int tid);
+
+            /** \brief Set the dimension and coordinate bounds of the discretizations */
+            void configureDiscretizations();
+
+            /** \brief Free the memory for a motion */
+            void freeMotion(Motion *motion);
+
+            /** \brief The state samplers, one for each thread */
+            base::StateSamplerArray<base::StateSampler> samplerArray_;
+
+            /** \brief The trees and the grids that cover them, one for each thread */
+            std::vector<std::unique_ptr<Discretization<Motion>>> discs_;
+
+            /** \brief The coverage of each cell, as last published by each thread */
+            CoverageGrid coverage_;
+
+            /** \brief Lock for coverage_ */
+            std::mutex coverageLock_;
+
+            /** \brief This algorithm uses a discretization (a grid)
+                to guide the exploration. The exploration is imposed
+                on a projection of the state space. */
+            base::ProjectionEvaluatorPtr projectionEvaluator_;
+
+            /** \brief When extending a motion from a cell, the
+                extension can fail. If it is, the score of the cell is
+                multiplied by this factor. */
+            double failedExpansionScoreFactor_{0.5};
+
+            /** \brief The fraction of time the goal is picked as the state to expand towards (if such a state is
+             * available) */
+            double goalBias_{0.05};
+
+            /** \brief When extending a motion, the planner can decide
+                to keep the first valid part of it, even if invalid
+                states are found, as long as the valid part represents
+                a sufficiently large fraction from the original
+                motion */
+            double minValidPathFraction_{0.2};
+
+            /** \brief The fraction of time for focusing on the border of the grids */
+            double selectBorderFraction_{0.9};
+
+            /** \brief The maximum length of a motion to be added to a tree */
+            double maxDistance_{0.};
+
+            /** \brief The number of threads (and trees) */
+            unsigned int threadCount_{0};
+
+            /** \brief The random number generator. Each thread draws from the stream of its seed selected by the
+                thread index. This fixes the random numbers of each thread, but not the results: when the trees
+                exchange cell coverage depends on how the threads are scheduled. */
+            RNG rng_;
+
+            /** \brief The number of iterations between two exchanges of cell coverage */
+            unsigned int mergeInterval_{100};
+
+            /** \brief The most recent goal motion.  Used for PlannerData computation */
+            Motion *lastGoalMotion_{nullptr};
+        };
+    }
+}
+
+#endif
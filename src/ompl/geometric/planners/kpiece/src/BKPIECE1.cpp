@@ -71,6 +71,12 @@ void ompl::geometric::BKPIECE1::setup()
 
     dStart_.setDimension(projectionEvaluator_->getDimension());
     dGoal_.setDimension(projectionEvaluator_->getDimension());
+    Discretization<Motion>::Coord low, high;
+    if (projectionEvaluator_->computeCoordinateBounds(low, high))
+    {
+        dStart_.setCoordinateBounds(low, high);
+        dGoal_.setCoordinateBounds(low, high);
+    }
 }
 
 ompl::base::PlannerStatus ompl::geometric::BKPIECE1::solve(const base::PlannerTerminationCondition &ptc)
@@ -41,7 +41,7 @@
 #include <cassert>
 
 ompl::geometric::KPIECE1::KPIECE1(const base::SpaceInformationPtr &si)
-  : base::Planner(si, "KPIECE1"), disc_([this](Motion *m) { freeMotion(m); })
+  : base::Planner(si, "KPIECE1"), motionPool_(si), disc_([this](Motion *m) { freeMotion(m); })
 {
     specs_.approximateSolutions = true;
     specs_.directed = true;
@@ -71,21 +71,24 @@ void ompl::geometric::KPIECE1::setup()
         throw Exception("The minimum valid path fraction must be in the range (0,1]");
 
     disc_.setDimension(projectionEvaluator_->getDimension());
+    Discretization<Motion>::Coord low, high;
+    if (projectionEvaluator_->computeCoordinateBounds(low, high))
+        disc_.setCoordinateBounds(low, high);
 }
 
 void ompl::geometric::KPIECE1::clear()
 {
     Planner::clear();
     sampler_.reset();
-    disc_.clear();
+    // the pool takes back all motions at once, so they are not returned one by one
+    disc_.clear(false);
+    motionPool_.clear();
     lastGoalMotion_ = nullptr;
 }
 
 void ompl::geometric::KPIECE1::freeMotion(Motion *motion)
 {
-    if (motion->state != nullptr)
-        si_->freeState(motion->state);
-    delete motion;
+    motionPool_.free(motion);
 }
 
 ompl::base::PlannerStatus ompl::geometric::KPIECE1::solve(const base::PlannerTerminationCondition &ptc)
@@ -98,7 +101,7 @@ ompl::base::PlannerStatus ompl::geometric::KPIECE1::solve(const base::PlannerTer
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
         projectionEvaluator_->computeCoordinates(motion->state, xcoord);
         disc_.addMotion(motion, xcoord, 1.0);
@@ -145,7 +148,7 @@ ompl::base::PlannerStatus ompl::geometric::KPIECE1::solve(const base::PlannerTer
         if (keep)
         {
             /* create a motion */
-            auto *motion = new Motion(si_);
+            auto *motion = motionPool_.allocate();
             si_->copyState(motion->state, xstate);
             motion->parent = existing;
 
@@ -67,6 +67,12 @@ void ompl::geometric::LBKPIECE1::setup()
 
     dStart_.setDimension(projectionEvaluator_->getDimension());
     dGoal_.setDimension(projectionEvaluator_->getDimension());
+    Discretization<Motion>::Coord low, high;
+    if (projectionEvaluator_->computeCoordinateBounds(low, high))
+    {
+        dStart_.setCoordinateBounds(low, high);
+        dGoal_.setCoordinateBounds(low, high);
+    }
 }
 
 ompl::base::PlannerStatus ompl::geometric::LBKPIECE1::solve(const base::PlannerTerminationCondition &ptc)
@@ -0,0 +1,337 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/geometric/planners/kpiece/pKPIECE1.h"
+#include "ompl/base/goals/GoalSampleableRegion.h"
+#include "ompl/tools/config/SelfConfig.h"
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include <thread>
+
+ompl::geometric::pKPIECE1::pKPIECE1(const base::SpaceInformationPtr &si)
+  : base::Planner(si, "pKPIECE1"), samplerArray_(si), coverage_(0)
+{
+    specs_.approximateSolutions = true;
+    specs_.multithreaded = true;
+    specs_.directed = true;
+
+    setThreadCount(2);
+
+    Planner::declareParam<double>("range", this, &pKPIECE1::setRange, &pKPIECE1::getRange, "0.:1.:10000.");
+    Planner::declareParam<double>("goal_bias", this, &pKPIECE1::setGoalBias, &pKPIECE1::getGoalBias, "0.:.05:1.");
+    Planner::declareParam<double>("border_fraction", this, &pKPIECE1::setBorderFraction,
+                                  &pKPIECE1::getBorderFraction, "0.:0.05:1.");
+    Planner::declareParam<double>("failed_expansion_score_factor", this,
+                                  &pKPIECE1::setFailedExpansionCellScoreFactor,
+                                  &pKPIECE1::getFailedExpansionCellScoreFactor);
+    Planner::declareParam<double>("min_valid_path_fraction", this, &pKPIECE1::setMinValidPathFraction,
+                                  &pKPIECE1::getMinValidPathFraction);
+    Planner::declareParam<unsigned int>("thread_count", this, &pKPIECE1::setThreadCount,
+                                        &pKPIECE1::getThreadCount, "1:64");
+    Planner::declareParam<unsigned int>("merge_interval", this, &pKPIECE1::setMergeInterval,
+                                        &pKPIECE1::getMergeInterval, "1:1:1000");
+}
+
+ompl::geometric::pKPIECE1::~pKPIECE1() = default;
+
+void ompl::geometric::pKPIECE1::setup()
+{
+    Planner::setup();
+    tools::SelfConfig sc(si_, getName());
+    sc.configureProjectionEvaluator(projectionEvaluator_);
+    sc.configurePlannerRange(maxDistance_);
+
+    if (failedExpansionScoreFactor_ < std::numeric_limits<double>::epsilon() || failedExpansionScoreFactor_ > 1.0)
+        throw Exception("Failed expansion cell score factor must be in the range (0,1]");
+    if (minValidPathFraction_ < std::numeric_limits<double>::epsilon() || minValidPathFraction_ > 1.0)
+        throw Exception("The minimum valid path fraction must be in the range (0,1]");
+    if (mergeInterval_ == 0)
+        throw Exception("The merge interval must be positive");
+
+    configureDiscretizations();
+}
+
+void ompl::geometric::pKPIECE1::configureDiscretizations()
+{
+    // the published coverage is recomputed from the discretizations at every merge
+    coverage_.clear();
+    coverage_.setDimension(projectionEvaluator_->getDimension());
+
+    Discretization<Motion>::Coord low, high;
+    bool bounded = projectionEvaluator_->computeCoordinateBounds(low, high);
+    if (bounded)
+        coverage_.setDenseBounds(low, high);
+    for (auto &disc : discs_)
+    {
+        disc->setDimension(projectionEvaluator_->getDimension());
+        if (bounded)
+            disc->setCoordinateBounds(low, high);
+    }
+}
+
+void ompl::geometric::pKPIECE1::clear()
+{
+    Planner::clear();
+    samplerArray_.clear();
+    for (auto &disc : discs_)
+        disc->clear();
+    coverage_.clear();
+    lastGoalMotion_ = nullptr;
+}
+
+void ompl::geometric::pKPIECE1::setThreadCount(unsigned int nthreads)
+{
+    assert(nthreads > 0);
+    if (nthreads == discs_.size())
+        return;
+    clear();
+    threadCount_ = nthreads;
+    discs_.clear();
+    for (unsigned int i = 0; i < threadCount_; ++i)
+    {
+        discs_.emplace_back(new Discretization<Motion>([this](Motion *m) { freeMotion(m); }));
+        discs_.back()->setBorderFraction(selectBorderFraction_);
+    }
+    if (isSetup())
+        configureDiscretizations();
+}
+
+void ompl::geometric::pKPIECE1::setBorderFraction(double bp)
+{
+    for (auto &disc : discs_)
+        disc->setBorderFraction(bp);
+    selectBorderFraction_ = bp;
+}
+
+void ompl::geometric::pKPIECE1::freeMotion(Motion *motion)
+{
+    if (motion->state != nullptr)
+        si_->freeState(motion->state);
+    delete motion;
+}
+
+void ompl::geometric::pKPIECE1::mergeCoverage(unsigned int tid)
+{
+    std::lock_guard<std::mutex> slock(coverageLock_);
+
+    // publish the coverage of the cells of this thread
+    const Discretization<Motion>::Grid &grid = discs_[tid]->getGrid();
+    for (const auto &c : grid)
+    {
+        CoverageGrid::Cell *cell = coverage_.getCell(c.second->coord);
+        if (cell == nullptr)
+        {
+            cell = coverage_.createCell(c.second->coord);
+            cell->data.resize(threadCount_, 0.0);
+            coverage_.add(cell);
+        }
+        cell->data[tid] = c.second->data->coverage;
+    }
+
+    // every cell of this thread is in coverage_, so the lookup below always succeeds
+    discs_[tid]->updateExternalCoverage([this, tid](const Discretization<Motion>::Coord &coord)
+                                        {
+                                            const std::vector<double> &cov = coverage_.getCell(coord)->data;
+                                            return std::accumulate(cov.begin(), cov.end(), 0.0) - cov[tid];
+                                        });
+}
+
+void ompl::geometric::pKPIECE1::threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc,
+                                            SolutionInfo *sol)
+{
+    base::Goal *goal = pdef_->getGoal().get();
+    auto *goal_s = dynamic_cast<base::GoalSampleableRegion *>(goal);
+    Discretization<Motion> &disc = *discs_[tid];
+    RNG rng(rng_.getLocalSeed(), tid + 1);
+
+    Discretization<Motion>::Coord xcoord(projectionEvaluator_->getDimension());
+    base::State *xstate = si_->allocState();
+    unsigned int iterations = 0;
+
+    while (sol->solution == nullptr && !ptc)
+    {
+        disc.countIteration();
+        if (++iterations % mergeInterval_ == 0)
+            mergeCoverage(tid);
+
+        /* Decide on a state to expand from */
+        Motion *existing = nullptr;
+        Discretization<Motion>::Cell *ecell = nullptr;
+        disc.selectMotion(existing, ecell);
+        assert(existing);
+
+        /* sample random state (with goal biasing) */
+        if ((goal_s != nullptr) && rng.uniform01() < goalBias_ && goal_s->canSample())
+            goal_s->sampleGoal(xstate);
+        else
+            samplerArray_[tid]->sampleUniformNear(xstate, existing->state, maxDistance_);
+
+        std::pair<base::State *, double> fail(xstate, 0.0);
+        bool keep = si_->checkMotion(existing->state, xstate, fail);
+        if (!keep && fail.second > minValidPathFraction_)
+            keep = true;
+
+        if (keep)
+        {
+            /* create a motion */
+            auto *motion = new Motion(si_);
+            si_->copyState(motion->state, xstate);
+            motion->parent = existing;
+
+            double dist = 0.0;
+            bool solv = goal->isSatisfied(motion->state, &dist);
+            projectionEvaluator_->computeCoordinates(motion->state, xcoord);
+            disc.addMotion(motion, xcoord, dist);  // this will also update the discretization heaps as needed, so no
+                                                   // call to updateCell() is needed
+
+            if (solv)
+            {
+                std::lock_guard<std::mutex> slock(sol->lock);
+                if (sol->solution == nullptr)
+                {
+                    sol->approxdif = dist;
+                    sol->solution = motion;
+                }
+                break;
+            }
+            if (dist < sol->approxdif)
+            {
+                std::lock_guard<std::mutex> slock(sol->lock);
+                if (dist < sol->approxdif)
+                {
+                    sol->approxdif = dist;
+                    sol->approxsol = motion;
+                }
+            }
+        }
+        else
+            ecell->data->score *= failedExpansionScoreFactor_;
+        disc.updateCell(ecell);
+    }
+
+    si_->freeState(xstate);
+}
+
+ompl::base::PlannerStatus ompl::geometric::pKPIECE1::solve(const base::PlannerTerminationCondition &ptc)
+{
+    checkValidity();
+
+    samplerArray_.resize(threadCount_);
+
+    Discretization<Motion>::Coord xcoord(projectionEvaluator_->getDimension());
+
+    // every thread grows its own tree from all the start states
+    while (const base::State *st = pis_.nextStart())
+    {
+        projectionEvaluator_->computeCoordinates(st, xcoord);
+        for (auto &disc : discs_)
+        {
+            auto *motion = new Motion(si_);
+            si_->copyState(motion->state, st);
+            disc->addMotion(motion, xcoord, 1.0);
+        }
+    }
+
+    if (discs_[0]->getMotionCount() == 0)
+    {
+        OMPL_ERROR("%s: There are no valid initial states!", getName().c_str());
+        return base::PlannerStatus::INVALID_START;
+    }
+
+    OMPL_INFORM("%s: Starting planning with %u states already in datastructure, using %u threads",
+                getName().c_str(), discs_[0]->getMotionCount(), threadCount_);
+
+    SolutionInfo sol;
+    sol.solution = nullptr;
+    sol.approxsol = nullptr;
+    sol.approxdif = std::numeric_limits<double>::infinity();
+
+    // every thread grows the tree until ptc is true, so each needs a thread of its own
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount_);
+    for (unsigned int i = 0; i < threadCount_; ++i)
+        threads.emplace_back([this, i, &ptc, &sol]
+                             {
+                                 threadSolve(i, ptc, &sol);
+                             });
+    for (auto &thread : threads)
+        thread.join();
+
+    bool solved = false;
+    bool approximate = false;
+    if (sol.solution == nullptr)
+    {
+        sol.solution = sol.approxsol;
+        approximate = true;
+    }
+
+    if (sol.solution != nullptr)
+    {
+        lastGoalMotion_ = sol.solution;
+
+        /* construct the solution path */
+        std::vector<Motion *> mpath;
+        while (sol.solution != nullptr)
+        {
+            mpath.push_back(sol.solution);
+            sol.solution = sol.solution->parent;
+        }
+
+        /* set the solution path */
+        auto path(std::make_shared<PathGeometric>(si_));
+        for (int i = mpath.size() - 1; i >= 0; --i)
+            path->append(mpath[i]->state);
+        pdef_->addSolutionPath(path, approximate, sol.approxdif, getName());
+        solved = true;
+    }
+
+    std::size_t motions = 0, cells = 0;
+    for (auto &disc : discs_)
+    {
+        motions += disc->getMotionCount();
+        cells += disc->getCellCount();
+    }
+    OMPL_INFORM("%s: Created %u states in %u cells (over %u trees)", getName().c_str(), motions, cells,
+                threadCount_);
+
+    return {solved, approximate};
+}
+
+void ompl::geometric::pKPIECE1::getPlannerData(base::PlannerData &data) const
+{
+    Planner::getPlannerData(data);
+    for (std::size_t i = 0; i < discs_.size(); ++i)
+        discs_[i]->getPlannerData(data, 0, true, i == 0 ? lastGoalMotion_ : nullptr);
+}
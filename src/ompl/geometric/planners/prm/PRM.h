@@ -347,6 +347,17 @@ namespace ompl
                 return si_->distance(stateProperty_[a], stateProperty_[b]);
             }
 
+            /** \brief Check the motion from \e s1 to \e s2 with motionValidator_, if it is set, or with the motion
+                validator of the space information otherwise */
+            bool checkMotion(const base::State *s1, const base::State *s2) const
+            {
+                if (!motionValidator_)
+                    return si_->checkMotion(s1, s2);
+                base::Instrumentation::Scope scope(si_->getInstrumentation().get(),
+                                                   base::Instrumentation::MOTION_CHECK);
+                return motionValidator_->checkMotion(s1, s2);
+            }
+
             ///////////////////////////////////////
             // Planner progress property functions
             std::string getIterationCount() const
@@ -378,6 +389,11 @@ namespace ompl
             /** \brief Nearest neighbors data structure */
             RoadmapNeighbors nn_;
 
+            /** \brief The motion validator used instead of the one of the space information, if set. This is
+                private to the planner, so setting it does not affect other planners using the same space
+                information. */
+            base::MotionValidatorPtr motionValidator_;
+
             /** \brief Connectivity graph */
             Graph g_;
 
@@ -0,0 +1,88 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_GEOMETRIC_PLANNERS_PRM_TYPED_PRM_
+#define OMPL_GEOMETRIC_PLANNERS_PRM_TYPED_PRM_
+
+#include "ompl/geometric/planners/prm/PRM.h"
+#include "ompl/base/TypedDiscreteMotionValidator.h"
+#include "ompl/util/Exception.h"
+#include <typeinfo>
+
+namespace ompl
+{
+    namespace geometric
+    {
+        /** \brief PRM instantiated over a state space of type \e SpaceType
+            and a state validity checker of type \e CheckerType.
+
+            This is the same planner, but the distances computed by its roadmap nearest neighbors datastructure call
+            \e SpaceType directly, so the compiler can inline them. The space of the space information must be exactly a
+            \e SpaceType, and setup() throws otherwise: a type derived from \e SpaceType could override the functions
+            that are called here. If the space information uses the default DiscreteMotionValidator, setup() gives the
+            planner its own base::TypedDiscreteMotionValidator for the same types, so the motions checked by the planner
+            are checked without virtual calls per state as well. The space information is not changed, so other planners
+            using it are not affected, and the motions checked here are not counted by its motion validator. The rest of
+            solve(), including sampling, interpolating and copying states, goes through the space information as in the
+            untyped planner. */
+        template <typename SpaceType, typename CheckerType>
+        class TypedPRM : public PRM
+        {
+        public:
+            /** \brief Constructor */
+            TypedPRM(const base::SpaceInformationPtr &si, bool starStrategy = false) : PRM(si, starStrategy)
+            {
+                setName("Typed" + getName());
+            }
+
+            ~TypedPRM() override = default;
+
+            void setup() override
+            {
+                PRM::setup();
+
+                const base::StateSpace *stateSpace = si_->getStateSpace().get();
+                if (typeid(*stateSpace) != typeid(SpaceType))
+                    throw Exception(getName(), "The state space is not of the type the planner was instantiated for");
+                const auto *space = static_cast<const SpaceType *>(stateSpace);
+                nn_->setDistanceFunction([this, space](const Vertex a, const Vertex b) {
+                    return space->SpaceType::distance(stateProperty_[a], stateProperty_[b]);
+                });
+                motionValidator_ = base::allocTypedDiscreteMotionValidator<SpaceType, CheckerType>(si_);
+            }
+        };
+    }
+}
+
+#endif
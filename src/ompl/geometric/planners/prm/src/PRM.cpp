@@ -487,7 +487,9 @@ ompl::base::PlannerStatus ompl::geometric::PRM::solve(const base::PlannerTermina
     unsigned long int nrStartStates = boost::num_vertices(g_);
     OMPL_INFORM("%s: Starting planning with %lu states already in datastructure", getName().c_str(), nrStartStates);
 
-    // Reset addedNewSolution_ member and create solution checking thread
+    // Reset addedNewSolution_ member and create solution checking thread. This is a dedicated thread rather than a
+    // task on the shared pool: the roadmap construction only stops once the check has found a solution, so the two
+    // must always run concurrently.
     addedNewSolution_ = false;
     base::PathPtr sol;
     std::thread slnThread([this, &ptc, &sol] { checkForSolution(ptc, sol); });
@@ -579,7 +581,7 @@ ompl::geometric::PRM::Vertex ompl::geometric::PRM::addMilestone(base::State *sta
         {
             totalConnectionAttemptsProperty_[m]++;
             totalConnectionAttemptsProperty_[n]++;
-            if (si_->checkMotion(stateProperty_[n], stateProperty_[m]))
+            if (checkMotion(stateProperty_[n], stateProperty_[m]))
             {
                 successfulConnectionAttemptsProperty_[m]++;
                 successfulConnectionAttemptsProperty_[n]++;
@@ -37,6 +37,7 @@
 #ifndef OMPL_GEOMETRIC_PLANNERS_RRT_RRT_
 #define OMPL_GEOMETRIC_PLANNERS_RRT_RRT_
 
+#include "ompl/datastructures/MotionPool.h"
 #include "ompl/datastructures/NearestNeighbors.h"
 #include "ompl/geometric/planners/PlannerIncludes.h"
 
@@ -172,12 +173,31 @@ namespace ompl
                 return si_->distance(a->state, b->state);
             }
 
+            /** \brief Check the motion from \e s1 to \e s2 with motionValidator_, if it is set, or with the motion
+                validator of the space information otherwise */
+            bool checkMotion(const base::State *s1, const base::State *s2) const
+            {
+                if (!motionValidator_)
+                    return si_->checkMotion(s1, s2);
+                base::Instrumentation::Scope scope(si_->getInstrumentation().get(),
+                                                   base::Instrumentation::MOTION_CHECK);
+                return motionValidator_->checkMotion(s1, s2);
+            }
+
             /** \brief State sampler */
             base::StateSamplerPtr sampler_;
 
             /** \brief A nearest-neighbors datastructure containing the tree of motions */
             std::shared_ptr<NearestNeighbors<Motion *>> nn_;
 
+            /** \brief The motion validator used instead of the one of the space information, if set. This is
+                private to the planner, so setting it does not affect other planners using the same space
+                information. */
+            base::MotionValidatorPtr motionValidator_;
+
+            /** \brief The memory of the motions in the tree, kept across calls to clear() */
+            MotionPool<Motion> motionPool_;
+
             /** \brief The fraction of time the goal is picked as the state to expand towards (if such a state is
              * available) */
             double goalBias_{.05};
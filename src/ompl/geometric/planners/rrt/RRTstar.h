@@ -39,6 +39,7 @@
 
 #include "ompl/geometric/planners/PlannerIncludes.h"
 #include "ompl/base/OptimizationObjective.h"
+#include "ompl/datastructures/MotionPool.h"
 #include "ompl/datastructures/NearestNeighbors.h"
 
 #include <limits>
@@ -333,6 +334,11 @@ namespace ompl
             class Motion
             {
             public:
+                /** \brief Constructor that does not allocate memory for the state */
+                Motion() : state(nullptr), parent(nullptr), inGoal(false)
+                {
+                }
+
                 /** \brief Constructor that allocates memory for the state. This constructor automatically allocates
                  * memory for \e state, \e cost, and \e incCost */
                 Motion(const base::SpaceInformationPtr &si) : state(si->allocState()), parent(nullptr), inGoal(false)
@@ -391,6 +397,17 @@ namespace ompl
                 return si_->distance(a->state, b->state);
             }
 
+            /** \brief Check the motion from \e s1 to \e s2 with motionValidator_, if it is set, or with the motion
+                validator of the space information otherwise */
+            bool checkMotion(const base::State *s1, const base::State *s2) const
+            {
+                if (!motionValidator_)
+                    return si_->checkMotion(s1, s2);
+                base::Instrumentation::Scope scope(si_->getInstrumentation().get(),
+                                                   base::Instrumentation::MOTION_CHECK);
+                return motionValidator_->checkMotion(s1, s2);
+            }
+
             /** \brief Gets the neighbours of a given motion, using either k-nearest of radius as appropriate. */
             void getNeighbors(Motion *motion, std::vector<Motion *> &nbh) const;
 
@@ -431,6 +448,14 @@ namespace ompl
             /** \brief A nearest-neighbors datastructure containing the tree of motions */
             std::shared_ptr<NearestNeighbors<Motion *>> nn_;
 
+            /** \brief The motion validator used instead of the one of the space information, if set. This is
+                private to the planner, so setting it does not affect other planners using the same space
+                information. */
+            base::MotionValidatorPtr motionValidator_;
+
+            /** \brief The memory of the motions in the tree, kept across calls to clear() */
+            MotionPool<Motion> motionPool_;
+
             /** \brief The fraction of time the goal is picked as the state to expand towards (if such a state is
              * available) */
             double goalBias_{.05};
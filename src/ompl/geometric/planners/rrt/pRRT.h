@@ -173,6 +173,12 @@ namespace ompl
 
             unsigned int threadCount_;
 
+            /** \brief The random number generator. Each thread draws from the stream of its seed selected by the
+                thread index, so the samples of a thread do not depend on the order in which the threads start.
+                The threads add to the same tree, however, so the tree and the solution still depend on thread
+                scheduling. */
+            RNG rng_;
+
             double goalBias_{.05};
             double maxDistance_{0.};
 
@@ -117,6 +117,8 @@ void ompl::geometric::LazyLBTRRT::freeMemory()
     }
     delete LPAstarApx_;
     delete LPAstarLb_;
+    LPAstarApx_ = nullptr;
+    LPAstarLb_ = nullptr;
 }
 
 ompl::base::PlannerStatus ompl::geometric::LazyLBTRRT::solve(const base::PlannerTerminationCondition &ptc)
@@ -156,6 +158,9 @@ ompl::base::PlannerStatus ompl::geometric::LazyLBTRRT::solve(const base::Planner
 
     goalMotion_ = createGoalMotion(goal_s);
 
+    // the searches are rebuilt from the graphs on every call
+    delete LPAstarLb_;
+    delete LPAstarApx_;
     CostEstimatorLb costEstimatorLb(goal, idToMotionMap_);
     LPAstarLb_ = new LPAstarLb(startMotion_->id_, goalMotion_->id_, graphLb_, costEstimatorLb);  // rooted at source
     CostEstimatorApx costEstimatorApx(this);
@@ -40,7 +40,7 @@
 #include "ompl/tools/config/SelfConfig.h"
 
 ompl::geometric::RRT::RRT(const base::SpaceInformationPtr &si, bool addIntermediateStates)
-  : base::Planner(si, addIntermediateStates ? "RRTintermediate" : "RRT")
+  : base::Planner(si, addIntermediateStates ? "RRTintermediate" : "RRT"), motionPool_(si)
 {
     specs_.approximateSolutions = true;
     specs_.directed = true;
@@ -81,17 +81,7 @@ void ompl::geometric::RRT::setup()
 
 void ompl::geometric::RRT::freeMemory()
 {
-    if (nn_)
-    {
-        std::vector<Motion *> motions;
-        nn_->list(motions);
-        for (auto &motion : motions)
-        {
-            if (motion->state != nullptr)
-                si_->freeState(motion->state);
-            delete motion;
-        }
-    }
+    motionPool_.clear();
 }
 
 ompl::base::PlannerStatus ompl::geometric::RRT::solve(const base::PlannerTerminationCondition &ptc)
@@ -102,7 +92,7 @@ ompl::base::PlannerStatus ompl::geometric::RRT::solve(const base::PlannerTermina
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
         nn_->add(motion);
     }
@@ -145,7 +135,7 @@ ompl::base::PlannerStatus ompl::geometric::RRT::solve(const base::PlannerTermina
             dstate = xstate;
         }
 
-        if (si_->checkMotion(nmotion->state, dstate))
+        if (checkMotion(nmotion->state, dstate))
         {
             if (addIntermediateStates_)
             {
@@ -157,8 +147,7 @@ ompl::base::PlannerStatus ompl::geometric::RRT::solve(const base::PlannerTermina
 
                 for (std::size_t i = 1; i < states.size(); ++i)
                 {
-                    auto *motion = new Motion;
-                    motion->state = states[i];
+                    auto *motion = motionPool_.allocate(states[i]);
                     motion->parent = nmotion;
                     nn_->add(motion);
 
@@ -167,7 +156,7 @@ ompl::base::PlannerStatus ompl::geometric::RRT::solve(const base::PlannerTermina
             }
             else
             {
-                auto *motion = new Motion(si_);
+                auto *motion = motionPool_.allocate();
                 si_->copyState(motion->state, dstate);
                 motion->parent = nmotion;
                 nn_->add(motion);
@@ -40,7 +40,7 @@
 #include "ompl/util/String.h"
 
 ompl::geometric::RRTConnect::RRTConnect(const base::SpaceInformationPtr &si, bool addIntermediateStates)
-  : base::Planner(si, addIntermediateStates ? "RRTConnectIntermediate" : "RRTConnect")
+  : base::Planner(si, addIntermediateStates ? "RRTConnectIntermediate" : "RRTConnect"), motionPool_(si)
 {
     specs_.recognizedGoal = base::GOAL_SAMPLEABLE_REGION;
     specs_.directed = true;
@@ -75,29 +75,7 @@ void ompl::geometric::RRTConnect::setup()
 
 void ompl::geometric::RRTConnect::freeMemory()
 {
-    std::vector<Motion *> motions;
-
-    if (tStart_)
-    {
-        tStart_->list(motions);
-        for (auto &motion : motions)
-        {
-            if (motion->state != nullptr)
-                si_->freeState(motion->state);
-            delete motion;
-        }
-    }
-
-    if (tGoal_)
-    {
-        tGoal_->list(motions);
-        for (auto &motion : motions)
-        {
-            if (motion->state != nullptr)
-                si_->freeState(motion->state);
-            delete motion;
-        }
-    }
+    motionPool_.clear();
 }
 
 void ompl::geometric::RRTConnect::clear()
@@ -139,8 +117,8 @@ ompl::geometric::RRTConnect::GrowState ompl::geometric::RRTConnect::growTree(Tre
         reach = false;
     }
 
-    bool validMotion = tgi.start ? si_->checkMotion(nmotion->state, dstate) :
-                                   si_->isValid(dstate) && si_->checkMotion(dstate, nmotion->state);
+    bool validMotion = tgi.start ? checkMotion(nmotion->state, dstate) :
+                                   si_->isValid(dstate) && checkMotion(dstate, nmotion->state);
 
     if (!validMotion)
         return TRAPPED;
@@ -158,8 +136,7 @@ ompl::geometric::RRTConnect::GrowState ompl::geometric::RRTConnect::growTree(Tre
 
         for (std::size_t i = 1; i < states.size(); ++i)
         {
-            auto *motion = new Motion;
-            motion->state = states[i];
+            auto *motion = motionPool_.allocate(states[i]);
             motion->parent = nmotion;
             motion->root = nmotion->root;
             tree->add(motion);
@@ -171,7 +148,7 @@ ompl::geometric::RRTConnect::GrowState ompl::geometric::RRTConnect::growTree(Tre
     }
     else
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, dstate);
         motion->parent = nmotion;
         motion->root = nmotion->root;
@@ -196,7 +173,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTConnect::solve(const base::Planner
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
         motion->root = motion->state;
         tStart_->add(motion);
@@ -242,7 +219,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTConnect::solve(const base::Planner
             const base::State *st = tGoal_->size() == 0 ? pis_.nextGoal(ptc) : pis_.nextGoal();
             if (st != nullptr)
             {
-                auto *motion = new Motion(si_);
+                auto *motion = motionPool_.allocate();
                 si_->copyState(motion->state, st);
                 motion->root = motion->state;
                 tGoal_->add(motion);
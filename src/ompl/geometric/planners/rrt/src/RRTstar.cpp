@@ -50,7 +50,7 @@
 #include "ompl/util/GeometricEquations.h"
 
 ompl::geometric::RRTstar::RRTstar(const base::SpaceInformationPtr &si)
-  : base::Planner(si, "RRTstar")
+  : base::Planner(si, "RRTstar"), motionPool_(si)
 {
     specs_.approximateSolutions = true;
     specs_.optimizingPaths = true;
@@ -176,7 +176,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
         // There are, add them
         while (const base::State *st = pis_.nextStart())
         {
-            auto *motion = new Motion(si_);
+            auto *motion = motionPool_.allocate();
             si_->copyState(motion->state, st);
             motion->cost = opt_->identityCost();
             nn_->add(motion);
@@ -279,10 +279,10 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
         }
 
         // Check if the motion between the nearest state and the state to add is valid
-        if (si_->checkMotion(nmotion->state, dstate))
+        if (checkMotion(nmotion->state, dstate))
         {
             // create a motion
-            auto *motion = new Motion(si_);
+            auto *motion = motionPool_.allocate();
             si_->copyState(motion->state, dstate);
             motion->parent = nmotion;
             motion->incCost = opt_->motionCost(nmotion->state, motion->state);
@@ -344,7 +344,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
                 {
                     if (nbh[*i] == nmotion ||
                         ((!useKNearest_ || si_->distance(nbh[*i]->state, motion->state) < maxDistance_) &&
-                         si_->checkMotion(nbh[*i]->state, motion->state)))
+                         checkMotion(nbh[*i]->state, motion->state)))
                     {
                         motion->incCost = incCosts[*i];
                         motion->cost = costs[*i];
@@ -370,7 +370,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
                         if (opt_->isCostBetterThan(costs[i], motion->cost))
                         {
                             if ((!useKNearest_ || si_->distance(nbh[i]->state, motion->state) < maxDistance_) &&
-                                si_->checkMotion(nbh[i]->state, motion->state))
+                                checkMotion(nbh[i]->state, motion->state))
                             {
                                 motion->incCost = incCosts[i];
                                 motion->cost = costs[i];
@@ -399,8 +399,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
                 }
                 else  // If the new motion does not improve the best cost it is ignored.
                 {
-                    si_->freeState(motion->state);
-                    delete motion;
+                    motionPool_.free(motion);
                     continue;
                 }
             }
@@ -429,7 +428,7 @@ ompl::base::PlannerStatus ompl::geometric::RRTstar::solve(const base::PlannerTer
                         {
                             motionValid =
                                 (!useKNearest_ || si_->distance(nbh[i]->state, motion->state) < maxDistance_) &&
-                                si_->checkMotion(motion->state, nbh[i]->state);
+                                checkMotion(motion->state, nbh[i]->state);
                         }
                         else
                         {
@@ -640,17 +639,7 @@ void ompl::geometric::RRTstar::updateChildCosts(Motion *m)
 
 void ompl::geometric::RRTstar::freeMemory()
 {
-    if (nn_)
-    {
-        std::vector<Motion *> motions;
-        nn_->list(motions);
-        for (auto &motion : motions)
-        {
-            if (motion->state)
-                si_->freeState(motion->state);
-            delete motion;
-        }
-    }
+    motionPool_.clear();
 }
 
 void ompl::geometric::RRTstar::getPlannerData(base::PlannerData &data) const
@@ -811,12 +800,8 @@ int ompl::geometric::RRTstar::pruneTree(const base::Cost &pruneTreeCost)
                 // Remove the leaf from its parent
                 removeFromParent(leavesToPrune.front());
 
-                // Erase the actual motion
-                // First free the state
-                si_->freeState(leavesToPrune.front()->state);
-
-                // then delete the pointer
-                delete leavesToPrune.front();
+                // Erase the actual motion, returning it and its state to the pool
+                motionPool_.free(leavesToPrune.front());
 
                 // And finally remove it from the list, erase returns the next iterator
                 leavesToPrune.pop();
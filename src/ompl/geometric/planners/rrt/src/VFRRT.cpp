@@ -166,8 +166,7 @@ ompl::geometric::VFRRT::Motion *ompl::geometric::VFRRT::extendTree(Motion *m, ba
         *space->getValueAddressAtIndex(newState, i) += d * v[i];
     if (!v.hasNaN() && si_->checkMotion(m->state, newState))
     {
-        auto *motion = new Motion(si_);
-        motion->state = newState;
+        auto *motion = motionPool_.allocate(newState);
         motion->parent = m;
         updateExplorationEfficiency(motion);
         nn_->add(motion);
@@ -204,7 +203,7 @@ ompl::base::PlannerStatus ompl::geometric::VFRRT::solve(const base::PlannerTermi
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
         nn_->add(motion);
     }
@@ -101,7 +101,7 @@ void ompl::geometric::pRRT::threadSolve(unsigned int tid, const base::PlannerTer
 {
     base::Goal *goal = pdef_->getGoal().get();
     auto *goal_s = dynamic_cast<base::GoalSampleableRegion *>(goal);
-    RNG rng;
+    RNG rng(rng_.getLocalSeed(), tid + 1);
 
     auto *rmotion = new Motion(si_);
     base::State *rstate = rmotion->state;
@@ -203,17 +203,16 @@ ompl::base::PlannerStatus ompl::geometric::pRRT::solve(const base::PlannerTermin
     sol.approxsol = nullptr;
     sol.approxdif = std::numeric_limits<double>::infinity();
 
-    std::vector<std::thread *> th(threadCount_);
+    // every thread grows the tree until ptc is true, so each needs a thread of its own
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount_);
     for (unsigned int i = 0; i < threadCount_; ++i)
-        th[i] = new std::thread([this, i, &ptc, &sol]
-                                {
-                                    return threadSolve(i, ptc, &sol);
-                                });
-    for (unsigned int i = 0; i < threadCount_; ++i)
-    {
-        th[i]->join();
-        delete th[i];
-    }
+        threads.emplace_back([this, i, &ptc, &sol]
+                             {
+                                 threadSolve(i, ptc, &sol);
+                             });
+    for (auto &thread : threads)
+        thread.join();
 
     bool solved = false;
     bool approximate = false;
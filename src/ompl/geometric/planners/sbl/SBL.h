@@ -40,6 +40,7 @@
 #include "ompl/geometric/planners/PlannerIncludes.h"
 #include "ompl/base/ProjectionEvaluator.h"
 #include "ompl/datastructures/Grid.h"
+#include "ompl/datastructures/MotionPool.h"
 #include "ompl/datastructures/PDF.h"
 #include <vector>
 
@@ -221,13 +222,9 @@ namespace ompl
             /** \brief Free the memory allocated by the planner */
             void freeMemory()
             {
-                freeGridMotions(tStart_.grid);
-                freeGridMotions(tGoal_.grid);
+                motionPool_.clear();
             }
 
-            /** \brief Free the memory used by the motions contained in a grid */
-            void freeGridMotions(Grid<MotionInfo> &grid);
-
             /** \brief Add a motion to a tree */
             void addMotion(TreeData &tree, Motion *motion);
 
@@ -260,6 +257,9 @@ namespace ompl
             /** \brief The goal tree */
             TreeData tGoal_;
 
+            /** \brief The memory of the motions in both trees, kept across calls to clear() */
+            MotionPool<Motion> motionPool_;
+
             /** \brief The maximum length of a motion to be added in the tree */
             double maxDistance_{0.};
 
@@ -265,6 +265,12 @@ namespace ompl
 
             unsigned int threadCount_;
 
+            /** \brief The random number generator. Each thread draws from the stream of its seed selected by the
+                thread index, so the random numbers of a thread do not depend on the order in which the threads
+                start. All threads expand the same pair of trees, so runs are not reproducible even for a fixed
+                seed. */
+            RNG rng_;
+
             /** \brief The pair of states in each tree connected during planning.  Used for PlannerData computation */
             std::pair<base::State *, base::State *> connectionPoint_{nullptr, nullptr};
         };
@@ -40,7 +40,7 @@
 #include <limits>
 #include <cassert>
 
-ompl::geometric::SBL::SBL(const base::SpaceInformationPtr &si) : base::Planner(si, "SBL")
+ompl::geometric::SBL::SBL(const base::SpaceInformationPtr &si) : base::Planner(si, "SBL"), motionPool_(si)
 {
     specs_.recognizedGoal = base::GOAL_SAMPLEABLE_REGION;
 
@@ -63,19 +63,6 @@ void ompl::geometric::SBL::setup()
     tGoal_.grid.setDimension(projectionEvaluator_->getDimension());
 }
 
-void ompl::geometric::SBL::freeGridMotions(Grid<MotionInfo> &grid)
-{
-    for (const auto &it : grid)
-    {
-        for (unsigned int i = 0; i < it.second->data.size(); ++i)
-        {
-            if (it.second->data[i]->state)
-                si_->freeState(it.second->data[i]->state);
-            delete it.second->data[i];
-        }
-    }
-}
-
 ompl::base::PlannerStatus ompl::geometric::SBL::solve(const base::PlannerTerminationCondition &ptc)
 {
     checkValidity();
@@ -89,7 +76,7 @@ ompl::base::PlannerStatus ompl::geometric::SBL::solve(const base::PlannerTermina
 
     while (const base::State *st = pis_.nextStart())
     {
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, st);
         motion->valid = true;
         motion->root = motion->state;
@@ -132,7 +119,7 @@ ompl::base::PlannerStatus ompl::geometric::SBL::solve(const base::PlannerTermina
             const base::State *st = tGoal_.size == 0 ? pis_.nextGoal(ptc) : pis_.nextGoal();
             if (st)
             {
-                auto *motion = new Motion(si_);
+                auto *motion = motionPool_.allocate();
                 si_->copyState(motion->state, st);
                 motion->root = motion->state;
                 motion->valid = true;
@@ -151,7 +138,7 @@ ompl::base::PlannerStatus ompl::geometric::SBL::solve(const base::PlannerTermina
             continue;
 
         /* create a motion */
-        auto *motion = new Motion(si_);
+        auto *motion = motionPool_.allocate();
         si_->copyState(motion->state, xstate);
         motion->parent = existing;
         motion->root = existing->root;
@@ -194,7 +181,7 @@ bool ompl::geometric::SBL::checkSolution(bool start, TreeData &tree, TreeData &o
         if (pdef_->getGoal()->isStartGoalPairValid(start ? motion->root : connectOther->root,
                                                    start ? connectOther->root : motion->root))
         {
-            auto *connect = new Motion(si_);
+            auto *connect = motionPool_.allocate();
 
             si_->copyState(connect->state, connectOther->state);
             connect->parent = motion;
@@ -322,9 +309,7 @@ void ompl::geometric::SBL::removeMotion(TreeData &tree, Motion *motion)
         removeMotion(tree, i);
     }
 
-    if (motion->state)
-        si_->freeState(motion->state);
-    delete motion;
+    motionPool_.free(motion);
 }
 
 void ompl::geometric::SBL::addMotion(TreeData &tree, Motion *motion)
@@ -102,7 +102,7 @@ void ompl::geometric::pSBL::freeGridMotions(Grid<MotionInfo> &grid)
 void ompl::geometric::pSBL::threadSolve(unsigned int tid, const base::PlannerTerminationCondition &ptc,
                                         SolutionInfo *sol)
 {
-    RNG rng;
+    RNG rng(rng_.getLocalSeed(), tid + 1);
 
     std::vector<Motion *> solution;
     base::State *xstate = si_->allocState();
@@ -240,14 +240,13 @@ ompl::base::PlannerStatus ompl::geometric::pSBL::solve(const base::PlannerTermin
     sol.found = false;
     loopCounter_ = 0;
 
-    std::vector<std::thread *> th(threadCount_);
+    // every thread grows the trees until ptc is true, so each needs a thread of its own
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount_);
     for (unsigned int i = 0; i < threadCount_; ++i)
-        th[i] = new std::thread([this, i, &ptc, &sol] { threadSolve(i, ptc, &sol); });
-    for (unsigned int i = 0; i < threadCount_; ++i)
-    {
-        th[i]->join();
-        delete th[i];
-    }
+        threads.emplace_back([this, i, &ptc, &sol] { threadSolve(i, ptc, &sol); });
+    for (auto &thread : threads)
+        thread.join();
 
     OMPL_INFORM("%s: Created %u (%u start + %u goal) states in %u cells (%u start + %u goal)", getName().c_str(),
                 tStart_.size + tGoal_.size, tStart_.size, tGoal_.size, tStart_.grid.size() + tGoal_.grid.size(),
@@ -516,18 +516,10 @@ int ompl::geometric::PathGeometric::getClosestIndex(const base::State *state) co
     if (states_.empty())
         return -1;
 
-    int index = 0;
-    double min_d = si_->distance(states_[0], state);
-    for (std::size_t i = 1; i < states_.size(); ++i)
-    {
-        double d = si_->distance(states_[i], state);
-        if (d < min_d)
-        {
-            min_d = d;
-            index = i;
-        }
-    }
-    return index;
+    // all distances in one call, which spaces such as SE3StateSpace compute faster than one at a time
+    std::vector<double> distances(states_.size());
+    si_->getStateSpace()->distanceBatch(state, states_.data(), states_.size(), distances.data());
+    return std::min_element(distances.begin(), distances.end()) - distances.begin();
 }
 
 void ompl::geometric::PathGeometric::clear()
@@ -39,6 +39,7 @@
 
 #include "ompl/geometric/SimpleSetup.h"
 #include "ompl/control/SimpleSetup.h"
+#include "ompl/tools/benchmark/MachineSpecs.h"
 
 namespace ompl
 {
@@ -192,6 +193,36 @@ namespace ompl
 
                 /// \brief flag indicating whether simplification should be applied to path; true by default
                 bool simplify;
+
+                /// \brief the maximum number of runs of a planner that are executed at the same time; 1 by default.
+                /// If larger than 1, every run is executed in a forked child process, which also keeps the memory
+                /// measurements of concurrent runs apart. Events set for the runs (setPreRunEvent(),
+                /// setPostRunEvent()) are then called in the child process. This is only supported on POSIX
+                /// systems and when runCount > 0; otherwise runs are executed one at a time.
+                unsigned int parallelRuns{1};
+
+                /// \brief if not empty, the properties of every run are appended to this file as soon as the run
+                /// completes, so the results of an interrupted benchmark are not lost; empty by default
+                std::string runLogFile;
+
+                /// \brief flag indicating whether the runs already recorded in runLogFile (by an earlier,
+                /// interrupted execution of the same benchmark) are loaded instead of being executed again;
+                /// false by default. Only used when runCount > 0.
+                bool resume{false};
+
+                /// \brief flag indicating whether the hardware performance counters (cpu cycles, cpu instructions,
+                /// cache misses, branch misses) of every run are recorded; false by default. Only supported on Linux,
+                /// and only when the kernel allows access to the counters (see /proc/sys/kernel/perf_event_paranoid).
+                /// Work done by the threads of a thread pool that was started before the run is not counted.
+                bool collectPerfCounters{false};
+
+                /// \brief flag indicating whether the number of state validity checks, motion checks, samples,
+                /// nearest neighbor operations and state allocations of every run, and the time spent in them, are
+                /// recorded; false by default. See base::Instrumentation; an instrumentation already set on the
+                /// space information (base::Planner::setInstrumentation()) is used if there is one. Samples and
+                /// nearest neighbor operations are only recorded for planners that were not yet set up when the
+                /// benchmark started.
+                bool collectInstrumentation{false};
             };
 
             /** \brief Constructor needs the SimpleSetup instance needed for planning. Optionally, the experiment name
@@ -294,7 +325,9 @@ namespace ompl
                 each run. Since not all the memory for the previous
                 run was freed, the increase in usage may be close to
                 0. To get correct averages for memory usage, use \e
-                req.runCount = 1 and run the process multiple times.
+                req.runCount = 1 and run the process multiple times,
+                or set \e req.parallelRuns > 1, which executes every
+                run in its own process.
             */
             virtual void benchmark(const Request &req);
 
@@ -325,6 +358,19 @@ namespace ompl
             bool saveResultsToFile() const;
 
         protected:
+            /** \brief Prepare for and execute run \e runIndex of the planner with index \e planner, and collect the
+                properties of the run in \e properties and \e progressData. Return the time the planner used. */
+            double executeRun(unsigned int planner, unsigned int runIndex, const Request &req, double maxTime,
+                              machine::MemUsage_t memStart, machine::MemUsage_t maxMem, RunProperties &properties,
+                              RunProgressData &progressData);
+
+            /** \brief Execute the runs \e runs of the planner with index \e planner in up to req.parallelRuns
+                forked processes at the same time. \e record is called (in this process) as each run completes. */
+            void executeRunsInProcesses(
+                unsigned int planner, const std::vector<unsigned int> &runs, const Request &req,
+                machine::MemUsage_t maxMem,
+                const std::function<void(unsigned int, RunProperties &, RunProgressData &)> &record);
+
             /** \brief The instance of the problem to benchmark (if geometric planning) */
             geometric::SimpleSetup *gsetup_;
 
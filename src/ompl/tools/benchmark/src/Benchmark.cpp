@@ -43,14 +43,147 @@
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define OMPL_BENCHMARK_FORK 1
+#else
+#define OMPL_BENCHMARK_FORK 0
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define OMPL_BENCHMARK_PERF_COUNTERS 1
+#else
+#define OMPL_BENCHMARK_PERF_COUNTERS 0
+#endif
 
 /// @cond IGNORE
 namespace ompl
 {
     namespace tools
     {
+        /** \brief The hardware performance counters of the calling thread and of the threads it creates while the
+            counters are running (Linux perf events). Threads that already exist when the counters are opened, such
+            as the workers of a thread pool started earlier, are not counted, and the events of the created threads
+            are only included once these threads have terminated. */
+        class PerfCounters
+        {
+        public:
+            PerfCounters()
+            {
+#if OMPL_BENCHMARK_PERF_COUNTERS
+                static const std::pair<std::uint32_t, std::uint64_t> events[COUNTER_COUNT] = {
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+                for (unsigned int i = 0; i < COUNTER_COUNT; ++i)
+                {
+                    perf_event_attr attr{};
+                    attr.size = sizeof(attr);
+                    attr.type = events[i].first;
+                    attr.config = events[i].second;
+                    attr.disabled = 1;
+                    attr.inherit = 1;
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                    fd_[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+                    if (fd_[i] < 0)
+                    {
+                        static bool warned = false;
+                        if (!warned)
+                        {
+                            OMPL_WARN("Unable to open hardware performance counters: %s", std::strerror(errno));
+                            warned = true;
+                        }
+                    }
+                }
+#else
+                static bool warned = false;
+                if (!warned)
+                {
+                    OMPL_WARN("Hardware performance counters are not supported on this platform");
+                    warned = true;
+                }
+#endif
+            }
+
+            ~PerfCounters()
+            {
+#if OMPL_BENCHMARK_PERF_COUNTERS
+                for (int fd : fd_)
+                    if (fd >= 0)
+                        close(fd);
+#endif
+            }
+
+            PerfCounters(const PerfCounters &) = delete;
+            PerfCounters &operator=(const PerfCounters &) = delete;
+
+            void start()
+            {
+#if OMPL_BENCHMARK_PERF_COUNTERS
+                for (int fd : fd_)
+                    if (fd >= 0)
+                    {
+                        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                    }
+#endif
+            }
+
+            void stop()
+            {
+#if OMPL_BENCHMARK_PERF_COUNTERS
+                for (int fd : fd_)
+                    if (fd >= 0)
+                        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+            }
+
+            /** \brief Add the values of the counters that could be read to the properties of a run */
+            void getProperties(Benchmark::RunProperties &run) const
+            {
+#if OMPL_BENCHMARK_PERF_COUNTERS
+                static const char *names[COUNTER_COUNT] = {"cpu cycles INTEGER", "cpu instructions INTEGER",
+                                                           "cache misses INTEGER", "branch misses INTEGER"};
+                for (unsigned int i = 0; i < COUNTER_COUNT; ++i)
+                {
+                    // value, time enabled, time running
+                    std::uint64_t values[3];
+                    if (fd_[i] < 0 || read(fd_[i], values, sizeof(values)) != (ssize_t)sizeof(values))
+                        continue;
+                    // scale the value if the counter had to share the hardware with other counters
+                    if (values[2] > 0 && values[2] < values[1])
+                        values[0] = (std::uint64_t)((double)values[0] * (double)values[1] / (double)values[2]);
+                    run[names[i]] = std::to_string(values[0]);
+                }
+#else
+                (void)run;
+#endif
+            }
+
+        private:
+            static const unsigned int COUNTER_COUNT = 4;
+#if OMPL_BENCHMARK_PERF_COUNTERS
+            int fd_[COUNTER_COUNT];
+#endif
+        };
+
         /** \brief Propose a name for a file in which results should be saved, based on the date and hostname of the
          * experiment */
         static std::string getResultsFilename(const Benchmark::CompleteExperiment &exp)
@@ -65,6 +198,114 @@ namespace ompl
             return "ompl_" + exp.host + "_" + time::as_string(exp.startTime) + ".console";
         }
 
+        /** \brief Escape the characters that separate the fields of a run record */
+        static std::string escapeRecordField(const std::string &field)
+        {
+            std::string result;
+            for (char c : field)
+                switch (c)
+                {
+                    case '\\':
+                        result += "\\\\";
+                        break;
+                    case '\n':
+                        result += "\\n";
+                        break;
+                    case '\t':
+                        result += "\\t";
+                        break;
+                    default:
+                        result += c;
+                }
+            return result;
+        }
+
+        static std::string unescapeRecordField(const std::string &field)
+        {
+            std::string result;
+            for (std::size_t i = 0; i < field.size(); ++i)
+                if (field[i] == '\\' && i + 1 < field.size())
+                {
+                    ++i;
+                    result += field[i] == 'n' ? '\n' : field[i] == 't' ? '\t' : field[i];
+                }
+                else
+                    result += field[i];
+            return result;
+        }
+
+        /** \brief Write the properties of a run as a record of the run log (and of the data sent by the processes
+            executing runs). A record is
+            \verbatim
+            run <planner index> <planner name> <run index> <property count> <progress data count>
+            <key> <value>              (one line per property)
+            <entry count>              (for each progress data point:)
+            <key> <value>              (one line per entry)
+            end
+            \endverbatim
+            with tab-separated fields. */
+        static void writeRunRecord(std::ostream &out, unsigned int planner, const std::string &plannerName,
+                                   unsigned int run, const Benchmark::RunProperties &properties,
+                                   const Benchmark::RunProgressData &progressData)
+        {
+            out << "run\t" << planner << '\t' << escapeRecordField(plannerName) << '\t' << run << '\t'
+                << properties.size() << '\t' << progressData.size() << '\n';
+            for (const auto &property : properties)
+                out << escapeRecordField(property.first) << '\t' << escapeRecordField(property.second) << '\n';
+            for (const auto &point : progressData)
+            {
+                out << point.size() << '\n';
+                for (const auto &entry : point)
+                    out << escapeRecordField(entry.first) << '\t' << escapeRecordField(entry.second) << '\n';
+            }
+            out << "end\n";
+        }
+
+        /** \brief Read a record written by writeRunRecord(). Return false at the end of the input or if the
+            record is incomplete. */
+        static bool readRunRecord(std::istream &in, unsigned int &planner, std::string &plannerName,
+                                  unsigned int &run, Benchmark::RunProperties &properties,
+                                  Benchmark::RunProgressData &progressData)
+        {
+            std::string line;
+            if (!std::getline(in, line))
+                return false;
+            std::stringstream header(line);
+            std::string tag, name;
+            std::size_t propertyCount, pointCount;
+            if (!std::getline(header, tag, '\t') || tag != "run" || !(header >> planner) || header.get() != '\t' ||
+                !std::getline(header, name, '\t') || !(header >> run >> propertyCount >> pointCount))
+                return false;
+            plannerName = unescapeRecordField(name);
+
+            auto readEntry = [&in, &line](std::map<std::string, std::string> &entries)
+            {
+                if (!std::getline(in, line))
+                    return false;
+                std::size_t tab = line.find('\t');
+                if (tab == std::string::npos)
+                    return false;
+                entries[unescapeRecordField(line.substr(0, tab))] = unescapeRecordField(line.substr(tab + 1));
+                return true;
+            };
+
+            properties.clear();
+            for (std::size_t i = 0; i < propertyCount; ++i)
+                if (!readEntry(properties))
+                    return false;
+            progressData.assign(pointCount, std::map<std::string, std::string>());
+            for (auto &point : progressData)
+            {
+                std::size_t entryCount;
+                if (!std::getline(in, line) || !(std::stringstream(line) >> entryCount))
+                    return false;
+                for (std::size_t i = 0; i < entryCount; ++i)
+                    if (!readEntry(point))
+                        return false;
+            }
+            return std::getline(in, line) && line == "end";
+        }
+
         static bool terminationCondition(const machine::MemUsage_t maxMem, const time::point &endTime)
         {
             if (time::now() < endTime && machine::getProcessMemoryUsage() < maxMem)
@@ -387,6 +628,12 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
 
     exp_.startTime = time::now();
 
+    // the instrumentation needs to be in place before the planners allocate their datastructures in setup()
+    base::SpaceInformationPtr si = gsetup_ ? gsetup_->getSpaceInformation() : csetup_->getSpaceInformation();
+    base::InstrumentationPtr previousInstrumentation = si->getInstrumentation();
+    if (req.collectInstrumentation && !previousInstrumentation)
+        si->setInstrumentation(std::make_shared<base::Instrumentation>());
+
     OMPL_INFORM("Configuring planners ...");
 
     // clear previous experimental data
@@ -449,6 +696,45 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
     machine::MemUsage_t memStart = machine::getProcessMemoryUsage();
     auto maxMemBytes = (machine::MemUsage_t)(req.maxMem * 1024 * 1024);
 
+    // runs recorded by an earlier execution of this benchmark, indexed by planner and run
+    std::vector<std::map<unsigned int, std::pair<RunProperties, RunProgressData>>> recorded(planners_.size());
+    if (req.resume && !req.runLogFile.empty())
+    {
+        if (req.runCount == 0)
+            OMPL_WARN("Resuming a benchmark is only supported when the number of runs is specified");
+        else
+        {
+            std::ifstream in(req.runLogFile.c_str());
+            unsigned int planner, run;
+            std::string plannerName;
+            RunProperties properties;
+            RunProgressData progressData;
+            std::size_t count = 0;
+            while (readRunRecord(in, planner, plannerName, run, properties, progressData))
+                if (planner < planners_.size() && plannerName == exp_.planners[planner].name && run < req.runCount)
+                {
+                    recorded[planner][run] = std::make_pair(properties, progressData);
+                    ++count;
+                }
+            OMPL_INFORM("Resuming benchmark: loaded %u completed runs from '%s'", (unsigned int)count,
+                        req.runLogFile.c_str());
+        }
+    }
+    std::ofstream runLog;
+    if (!req.runLogFile.empty())
+    {
+        runLog.open(req.runLogFile.c_str(), req.resume ? std::ios::app : std::ios::trunc);
+        if (!runLog.good())
+            OMPL_ERROR("Unable to write runs to '%s'", req.runLogFile.c_str());
+    }
+
+    bool parallel = req.parallelRuns > 1 && req.runCount > 0;
+    if (parallel && !OMPL_BENCHMARK_FORK)
+    {
+        OMPL_WARN("Executing runs in parallel is not supported on this platform");
+        parallel = false;
+    }
+
     for (unsigned int i = 0; i < planners_.size(); ++i)
     {
         status_.activePlanner = exp_.planners[i].name;
@@ -486,10 +772,28 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
         }
         std::sort(exp_.planners[i].progressPropertyNames.begin(), exp_.planners[i].progressPropertyNames.end());
 
-        // run the planner
-        double maxTime = req.maxTime;
-        unsigned int j = 0;
-        while (true)
+        // Store the results of a completed run; with a fixed number of runs, the results are kept in run order
+        std::vector<std::pair<RunProperties, RunProgressData>> runs(req.runCount);
+        unsigned int completed = 0;
+        auto record = [this, i, &req, &runs, &runLog, &completed](unsigned int run, RunProperties &properties,
+                                                                 RunProgressData &progressData)
+        {
+            if (runLog.is_open())
+            {
+                writeRunRecord(runLog, i, exp_.planners[i].name, run, properties, progressData);
+                runLog.flush();
+            }
+            if (req.runCount)
+                runs[run] = std::make_pair(std::move(properties), std::move(progressData));
+            else
+            {
+                exp_.planners[i].runs.push_back(properties);
+                if (planners_[i]->getPlannerProgressProperties().size() > 0)
+                    exp_.planners[i].runsProgressData.push_back(progressData);
+            }
+            ++completed;
+        };
+        auto updateProgress = [this, i, &req, &progress](unsigned int j)
         {
             status_.activeRun = j;
             status_.progressPercentage = req.runCount ?
@@ -499,212 +803,495 @@ void ompl::tools::Benchmark::benchmark(const Request &req)
             if (req.displayProgress)
                 while (status_.progressPercentage > progress->count())
                     ++(*progress);
+        };
 
-            OMPL_INFORM("Preparing for run %d of %s", status_.activeRun, status_.activePlanner.c_str());
+        std::vector<unsigned int> pending;
+        for (unsigned int j = 0; j < req.runCount; ++j)
+        {
+            auto it = recorded[i].find(j);
+            if (it != recorded[i].end())
+            {
+                runs[j] = it->second;
+                ++completed;
+            }
+            else
+                pending.push_back(j);
+        }
 
-            // make sure all planning data structures are cleared
-            try
+        if (parallel)
+        {
+            updateProgress(completed);
+            executeRunsInProcesses(i, pending, req, maxMemBytes,
+                                   [&record, &updateProgress, &completed](unsigned int run, RunProperties &properties,
+                                                                          RunProgressData &progressData)
+                                   {
+                                       record(run, properties, progressData);
+                                       updateProgress(completed);
+                                   });
+        }
+        else
+        {
+            // run the planner
+            double maxTime = req.maxTime;
+            std::size_t next = 0;
+            while (req.runCount == 0 || next < pending.size())
             {
-                planners_[i]->clear();
-                if (gsetup_)
-                {
-                    gsetup_->getProblemDefinition()->clearSolutionPaths();
-                    gsetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
-                }
-                else
+                unsigned int j = req.runCount ? pending[next++] : completed;
+                updateProgress(req.runCount ? completed : j);
+
+                RunProperties properties;
+                RunProgressData progressData;
+                double timeUsed =
+                    executeRun(i, j, req, maxTime, memStart, maxMemBytes, properties, progressData);
+                record(j, properties, progressData);
+
+                if (req.runCount == 0)
                 {
-                    csetup_->getProblemDefinition()->clearSolutionPaths();
-                    csetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
+                    maxTime -= timeUsed;
+                    if (maxTime < 0.)
+                        break;
                 }
             }
-            catch (std::runtime_error &e)
-            {
-                std::stringstream es;
-                es << "There was an error while preparing for run " << status_.activeRun << " of planner "
-                   << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
-            }
+        }
+
+        for (auto &run : runs)
+        {
+            // the results of runs that failed to be extracted are not included
+            if (run.first.empty())
+                continue;
+            exp_.planners[i].runs.push_back(run.first);
+            // Add planner progress data from the planner progress
+            // collector if there was anything to report
+            if (planners_[i]->getPlannerProgressProperties().size() > 0)
+                exp_.planners[i].runsProgressData.push_back(run.second);
+        }
+    }
+
+    status_.running = false;
+    status_.progressPercentage = 100.0;
+    if (req.displayProgress)
+    {
+        while (status_.progressPercentage > progress->count())
+            ++(*progress);
+        std::cout << std::endl;
+    }
+
+    exp_.totalDuration = time::seconds(time::now() - exp_.startTime);
+
+    si->setInstrumentation(previousInstrumentation);
+
+    OMPL_INFORM("Benchmark complete");
+    msg::useOutputHandler(oh);
+    OMPL_INFORM("Benchmark complete");
+}
 
-            // execute pre-run event, if set
-            try
+
+double ompl::tools::Benchmark::executeRun(unsigned int planner, unsigned int runIndex, const Request &req,
+                                          double maxTime, machine::MemUsage_t memStart, machine::MemUsage_t maxMem,
+                                          RunProperties &properties, RunProgressData &progressData)
+{
+    const base::PlannerPtr &activePlanner = planners_[planner];
+    OMPL_INFORM("Preparing for run %d of %s", runIndex, exp_.planners[planner].name.c_str());
+
+    // make sure all planning data structures are cleared
+    try
+    {
+        activePlanner->clear();
+        if (gsetup_)
+        {
+            gsetup_->getProblemDefinition()->clearSolutionPaths();
+            gsetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
+        }
+        else
+        {
+            csetup_->getProblemDefinition()->clearSolutionPaths();
+            csetup_->getSpaceInformation()->getMotionValidator()->resetMotionCounter();
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error while preparing for run " << runIndex << " of planner "
+           << exp_.planners[planner].name << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
+
+    // execute pre-run event, if set
+    try
+    {
+        if (preRun_)
+        {
+            OMPL_INFORM("Executing pre-run event for run %d of planner %s ...", runIndex,
+                        exp_.planners[planner].name.c_str());
+            preRun_(activePlanner);
+            OMPL_INFORM("Completed execution of pre-run event");
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error executing the pre-run event for run " << runIndex << " of planner "
+           << exp_.planners[planner].name << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
+
+    base::InstrumentationPtr instrumentation =
+        req.collectInstrumentation ? activePlanner->getInstrumentation() : nullptr;
+    if (instrumentation)
+        instrumentation->clear();
+    std::unique_ptr<PerfCounters> perfCounters;
+    if (req.collectPerfCounters)
+    {
+        // opened for every run, so the counters are inherited by the thread the planner runs in
+        perfCounters.reset(new PerfCounters());
+        perfCounters->start();
+    }
+
+    RunPlanner rp(this);
+    rp.run(activePlanner, memStart, maxMem, maxTime, req.timeBetweenUpdates);
+
+    // collect the counters before the solution is checked and simplified below
+    RunProperties counters;
+    if (perfCounters)
+    {
+        perfCounters->stop();
+        perfCounters->getProperties(counters);
+    }
+    if (instrumentation)
+        for (int e = 0; e < base::Instrumentation::EVENT_COUNT; ++e)
+        {
+            auto event = static_cast<base::Instrumentation::Event>(e);
+            counters[std::string(base::Instrumentation::getEventPluralName(event)) + " INTEGER"] =
+                std::to_string(instrumentation->getCount(event));
+            counters[std::string(base::Instrumentation::getEventName(event)) + " time REAL"] =
+                ompl::toString(instrumentation->getTime(event));
+        }
+
+    bool solved = gsetup_ ? gsetup_->haveSolutionPath() : csetup_->haveSolutionPath();
+
+    // store results
+    try
+    {
+        RunProperties run;
+
+        run["time REAL"] = ompl::toString(rp.getTimeUsed());
+        run["memory REAL"] = ompl::toString((double)rp.getMemUsed() / (1024.0 * 1024.0));
+        run["status ENUM"] = std::to_string((int)static_cast<base::PlannerStatus::StatusType>(rp.getStatus()));
+        run.insert(counters.begin(), counters.end());
+        if (gsetup_)
+        {
+            run["solved BOOLEAN"] = std::to_string(gsetup_->haveExactSolutionPath());
+            run["valid segment fraction REAL"] =
+                ompl::toString(gsetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
+        }
+        else
+        {
+            run["solved BOOLEAN"] = std::to_string(csetup_->haveExactSolutionPath());
+            run["valid segment fraction REAL"] =
+                ompl::toString(csetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
+        }
+
+        if (solved)
+        {
+            if (gsetup_)
             {
-                if (preRun_)
+                run["approximate solution BOOLEAN"] =
+                    std::to_string(gsetup_->getProblemDefinition()->hasApproximateSolution());
+                run["solution difference REAL"] =
+                    ompl::toString(gsetup_->getProblemDefinition()->getSolutionDifference());
+                run["solution length REAL"] = ompl::toString(gsetup_->getSolutionPath().length());
+                run["solution smoothness REAL"] = ompl::toString(gsetup_->getSolutionPath().smoothness());
+                run["solution clearance REAL"] = ompl::toString(gsetup_->getSolutionPath().clearance());
+                run["solution segments INTEGER"] =
+                    std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
+                run["correct solution BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
+
+                unsigned int factor = gsetup_->getStateSpace()->getValidSegmentCountFactor();
+                gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
+                run["correct solution strict BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
+                gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
+
+                if (req.simplify)
                 {
-                    OMPL_INFORM("Executing pre-run event for run %d of planner %s ...", status_.activeRun,
-                                status_.activePlanner.c_str());
-                    preRun_(planners_[i]);
-                    OMPL_INFORM("Completed execution of pre-run event");
+                    // simplify solution
+                    time::point timeStart = time::now();
+                    gsetup_->simplifySolution();
+                    double timeUsed = time::seconds(time::now() - timeStart);
+                    run["simplification time REAL"] = ompl::toString(timeUsed);
+                    run["simplified solution length REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().length());
+                    run["simplified solution smoothness REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().smoothness());
+                    run["simplified solution clearance REAL"] =
+                        ompl::toString(gsetup_->getSolutionPath().clearance());
+                    run["simplified solution segments INTEGER"] =
+                        std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
+                    run["simplified correct solution BOOLEAN"] =
+                        std::to_string(gsetup_->getSolutionPath().check());
+                    gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
+                    run["simplified correct solution strict BOOLEAN"] =
+                        std::to_string(gsetup_->getSolutionPath().check());
+                    gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
                 }
             }
-            catch (std::runtime_error &e)
+            else
             {
-                std::stringstream es;
-                es << "There was an error executing the pre-run event for run " << status_.activeRun << " of planner "
-                   << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
+                run["approximate solution BOOLEAN"] =
+                    std::to_string(csetup_->getProblemDefinition()->hasApproximateSolution());
+                run["solution difference REAL"] =
+                    ompl::toString(csetup_->getProblemDefinition()->getSolutionDifference());
+                run["solution length REAL"] = ompl::toString(csetup_->getSolutionPath().length());
+                run["solution clearance REAL"] =
+                    ompl::toString(csetup_->getSolutionPath().asGeometric().clearance());
+                run["solution segments INTEGER"] = std::to_string(csetup_->getSolutionPath().getControlCount());
+                run["correct solution BOOLEAN"] = std::to_string(csetup_->getSolutionPath().check());
             }
+        }
+
+        base::PlannerData pd(gsetup_ ? gsetup_->getSpaceInformation() : csetup_->getSpaceInformation());
+        activePlanner->getPlannerData(pd);
+        run["graph states INTEGER"] = std::to_string(pd.numVertices());
+        run["graph motions INTEGER"] = std::to_string(pd.numEdges());
 
-            RunPlanner rp(this);
-            rp.run(planners_[i], memStart, maxMemBytes, maxTime, req.timeBetweenUpdates);
-            bool solved = gsetup_ ? gsetup_->haveSolutionPath() : csetup_->haveSolutionPath();
+        for (const auto &prop : pd.properties)
+            run[prop.first] = prop.second;
 
-            // store results
-            try
+        // execute post-run event, if set
+        try
+        {
+            if (postRun_)
             {
-                RunProperties run;
+                OMPL_INFORM("Executing post-run event for run %d of planner %s ...", runIndex,
+                            exp_.planners[planner].name.c_str());
+                postRun_(activePlanner, run);
+                OMPL_INFORM("Completed execution of post-run event");
+            }
+        }
+        catch (std::runtime_error &e)
+        {
+            std::stringstream es;
+            es << "There was an error in the execution of the post-run event for run " << runIndex
+               << " of planner " << exp_.planners[planner].name << std::endl;
+            es << "*** " << e.what() << std::endl;
+            std::cerr << es.str();
+            OMPL_ERROR(es.str().c_str());
+        }
 
-                run["time REAL"] = ompl::toString(rp.getTimeUsed());
-                run["memory REAL"] = ompl::toString((double)rp.getMemUsed() / (1024.0 * 1024.0));
-                run["status ENUM"] = std::to_string((int)static_cast<base::PlannerStatus::StatusType>(rp.getStatus()));
-                if (gsetup_)
-                {
-                    run["solved BOOLEAN"] = std::to_string(gsetup_->haveExactSolutionPath());
-                    run["valid segment fraction REAL"] =
-                        ompl::toString(gsetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
-                }
-                else
-                {
-                    run["solved BOOLEAN"] = std::to_string(csetup_->haveExactSolutionPath());
-                    run["valid segment fraction REAL"] =
-                        ompl::toString(csetup_->getSpaceInformation()->getMotionValidator()->getValidMotionFraction());
-                }
+        properties = run;
 
-                if (solved)
-                {
-                    if (gsetup_)
-                    {
-                        run["approximate solution BOOLEAN"] =
-                            std::to_string(gsetup_->getProblemDefinition()->hasApproximateSolution());
-                        run["solution difference REAL"] =
-                            ompl::toString(gsetup_->getProblemDefinition()->getSolutionDifference());
-                        run["solution length REAL"] = ompl::toString(gsetup_->getSolutionPath().length());
-                        run["solution smoothness REAL"] = ompl::toString(gsetup_->getSolutionPath().smoothness());
-                        run["solution clearance REAL"] = ompl::toString(gsetup_->getSolutionPath().clearance());
-                        run["solution segments INTEGER"] =
-                            std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
-                        run["correct solution BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
-
-                        unsigned int factor = gsetup_->getStateSpace()->getValidSegmentCountFactor();
-                        gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
-                        run["correct solution strict BOOLEAN"] = std::to_string(gsetup_->getSolutionPath().check());
-                        gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
-
-                        if (req.simplify)
-                        {
-                            // simplify solution
-                            time::point timeStart = time::now();
-                            gsetup_->simplifySolution();
-                            double timeUsed = time::seconds(time::now() - timeStart);
-                            run["simplification time REAL"] = ompl::toString(timeUsed);
-                            run["simplified solution length REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().length());
-                            run["simplified solution smoothness REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().smoothness());
-                            run["simplified solution clearance REAL"] =
-                                ompl::toString(gsetup_->getSolutionPath().clearance());
-                            run["simplified solution segments INTEGER"] =
-                                std::to_string(gsetup_->getSolutionPath().getStateCount() - 1);
-                            run["simplified correct solution BOOLEAN"] =
-                                std::to_string(gsetup_->getSolutionPath().check());
-                            gsetup_->getStateSpace()->setValidSegmentCountFactor(factor * 4);
-                            run["simplified correct solution strict BOOLEAN"] =
-                                std::to_string(gsetup_->getSolutionPath().check());
-                            gsetup_->getStateSpace()->setValidSegmentCountFactor(factor);
-                        }
-                    }
-                    else
-                    {
-                        run["approximate solution BOOLEAN"] =
-                            std::to_string(csetup_->getProblemDefinition()->hasApproximateSolution());
-                        run["solution difference REAL"] =
-                            ompl::toString(csetup_->getProblemDefinition()->getSolutionDifference());
-                        run["solution length REAL"] = ompl::toString(csetup_->getSolutionPath().length());
-                        run["solution clearance REAL"] =
-                            ompl::toString(csetup_->getSolutionPath().asGeometric().clearance());
-                        run["solution segments INTEGER"] = std::to_string(csetup_->getSolutionPath().getControlCount());
-                        run["correct solution BOOLEAN"] = std::to_string(csetup_->getSolutionPath().check());
-                    }
-                }
+        // Add planner progress data from the planner progress
+        // collector if there was anything to report
+        if (activePlanner->getPlannerProgressProperties().size() > 0)
+        {
+            progressData = rp.getRunProgressData();
+        }
+    }
+    catch (std::runtime_error &e)
+    {
+        std::stringstream es;
+        es << "There was an error in the extraction of planner results: planner = " << exp_.planners[planner].name
+           << ", run = " << exp_.planners[planner].name << std::endl;
+        es << "*** " << e.what() << std::endl;
+        std::cerr << es.str();
+        OMPL_ERROR(es.str().c_str());
+    }
 
-                base::PlannerData pd(gsetup_ ? gsetup_->getSpaceInformation() : csetup_->getSpaceInformation());
-                planners_[i]->getPlannerData(pd);
-                run["graph states INTEGER"] = std::to_string(pd.numVertices());
-                run["graph motions INTEGER"] = std::to_string(pd.numEdges());
+    return rp.getTimeUsed();
+}
+
+void ompl::tools::Benchmark::executeRunsInProcesses(
+    unsigned int planner, const std::vector<unsigned int> &runs, const Request &req, machine::MemUsage_t maxMem,
+    const std::function<void(unsigned int, RunProperties &, RunProgressData &)> &record)
+{
+#if OMPL_BENCHMARK_FORK
+    struct Worker
+    {
+        pid_t pid;
+        int fd;
+        unsigned int run;
+        time::point start;
+        std::string output;
+    };
+    std::vector<Worker> workers;
+    std::size_t next = 0;
+
+    // A run may take longer than maxTime, as the solution is checked and simplified after the planner stops.
+    // Processes that exceed this limit are assumed to hang, and are killed.
+    const time::duration timeLimit = time::seconds(2.0 * req.maxTime + 10.0);
+
+    while (next < runs.size() || !workers.empty())
+    {
+        // start as many runs as allowed
+        while (next < runs.size() && workers.size() < req.parallelRuns)
+        {
+            unsigned int run = runs[next++];
+            int fds[2];
+            if (pipe(fds) != 0)
+            {
+                OMPL_ERROR("Unable to create a pipe for run %d of planner %s; executing it in this process", run,
+                           exp_.planners[planner].name.c_str());
+                RunProperties properties;
+                RunProgressData progressData;
+                executeRun(planner, run, req, req.maxTime, machine::getProcessMemoryUsage(), maxMem, properties,
+                           progressData);
+                record(run, properties, progressData);
+                continue;
+            }
 
-                for (const auto &prop : pd.properties)
-                    run[prop.first] = prop.second;
+            // Each child reseeds all random number generators from a seed of its own, including those the
+            // planner already holds. Otherwise all children would generate the same random numbers.
+            const std::uint_fast32_t seed = RNG().getLocalSeed();
 
-                // execute post-run event, if set
+            // buffered output would otherwise be written by both processes
+            std::cout.flush();
+            std::cerr.flush();
+            std::fflush(nullptr);
+
+            pid_t pid = fork();
+            if (pid == 0)
+            {
+                close(fds[0]);
+                // an exception must not unwind into the run loop of the parent, which this process shares
                 try
                 {
-                    if (postRun_)
+                    RNG::reseedInstances(seed);
+                    status_.activeRun = run;
+                    RunProperties properties;
+                    RunProgressData progressData;
+                    executeRun(planner, run, req, req.maxTime, machine::getProcessMemoryUsage(), maxMem, properties,
+                               progressData);
+                    std::ostringstream out;
+                    writeRunRecord(out, planner, exp_.planners[planner].name, run, properties, progressData);
+                    const std::string data = out.str();
+                    std::size_t written = 0;
+                    while (written < data.size())
                     {
-                        OMPL_INFORM("Executing post-run event for run %d of planner %s ...", status_.activeRun,
-                                    status_.activePlanner.c_str());
-                        postRun_(planners_[i], run);
-                        OMPL_INFORM("Completed execution of post-run event");
+                        ssize_t n = write(fds[1], data.data() + written, data.size() - written);
+                        if (n < 0 && errno == EINTR)
+                            continue;
+                        if (n <= 0)
+                            break;
+                        written += n;
                     }
+                    close(fds[1]);
+                    std::cout.flush();
+                    std::fflush(nullptr);
+                    // do not run the destructors and exit handlers of the parent's objects
+                    _exit(written == data.size() ? 0 : 1);
                 }
-                catch (std::runtime_error &e)
+                catch (...)
                 {
-                    std::stringstream es;
-                    es << "There was an error in the execution of the post-run event for run " << status_.activeRun
-                       << " of planner " << status_.activePlanner << std::endl;
-                    es << "*** " << e.what() << std::endl;
-                    std::cerr << es.str();
-                    OMPL_ERROR(es.str().c_str());
+                    _exit(1);
                 }
+            }
+            close(fds[1]);
+            if (pid < 0)
+            {
+                close(fds[0]);
+                OMPL_ERROR("Unable to fork for run %d of planner %s; executing it in this process", run,
+                           exp_.planners[planner].name.c_str());
+                RunProperties properties;
+                RunProgressData progressData;
+                executeRun(planner, run, req, req.maxTime, machine::getProcessMemoryUsage(), maxMem, properties,
+                           progressData);
+                record(run, properties, progressData);
+                continue;
+            }
+            workers.push_back(Worker{pid, fds[0], run, time::now(), std::string()});
+        }
+        if (workers.empty())
+            continue;
+
+        // collect the output of the running processes, waiting at most until the earliest deadline
+        std::vector<pollfd> fds(workers.size());
+        time::point now = time::now();
+        int timeout = std::numeric_limits<int>::max();
+        for (std::size_t k = 0; k < workers.size(); ++k)
+        {
+            fds[k].fd = workers[k].fd;
+            fds[k].events = POLLIN;
+            fds[k].revents = 0;
+            double left = time::seconds(workers[k].start + timeLimit - now);
+            timeout = std::min(timeout, std::max(0, (int)std::ceil(left * 1000.0)));
+        }
+        if (poll(fds.data(), fds.size(), timeout) < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw Exception("Unable to wait for the benchmark runs");
+        }
 
-                exp_.planners[i].runs.push_back(run);
-
-                // Add planner progress data from the planner progress
-                // collector if there was anything to report
-                if (planners_[i]->getPlannerProgressProperties().size() > 0)
+        now = time::now();
+        for (std::size_t k = workers.size(); k > 0; --k)
+        {
+            Worker &worker = workers[k - 1];
+            bool expired = now >= worker.start + timeLimit;
+            if (fds[k - 1].revents == 0 && !expired)
+                continue;
+            if (fds[k - 1].revents != 0)
+            {
+                char buffer[4096];
+                ssize_t n = read(worker.fd, buffer, sizeof(buffer));
+                if (n > 0 || (n < 0 && errno == EINTR))
                 {
-                    exp_.planners[i].runsProgressData.push_back(rp.getRunProgressData());
+                    if (n > 0)
+                        worker.output.append(buffer, n);
+                    if (!expired)
+                        continue;
                 }
-            }
-            catch (std::runtime_error &e)
-            {
-                std::stringstream es;
-                es << "There was an error in the extraction of planner results: planner = " << status_.activePlanner
-                   << ", run = " << status_.activePlanner << std::endl;
-                es << "*** " << e.what() << std::endl;
-                std::cerr << es.str();
-                OMPL_ERROR(es.str().c_str());
+                else
+                    // the output is complete, so the process finished in time
+                    expired = false;
             }
 
-            ++j;
-            if (req.runCount == 0)
+            // the process is done, or did not finish in time
+            if (expired)
             {
-                maxTime -= rp.getTimeUsed();
-                if (maxTime < 0.)
-                    break;
+                OMPL_ERROR("Run %d of planner %s did not finish within %g seconds; stopping it", worker.run,
+                           exp_.planners[planner].name.c_str(), time::seconds(timeLimit));
+                kill(worker.pid, SIGKILL);
             }
-            else
+            close(worker.fd);
+            int status = 0;
+            while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR)
+                ;
+
+            unsigned int recordedPlanner, recordedRun;
+            std::string plannerName;
+            RunProperties properties;
+            RunProgressData progressData;
+            std::istringstream in(worker.output);
+            if (!readRunRecord(in, recordedPlanner, plannerName, recordedRun, properties, progressData) ||
+                recordedPlanner != planner || recordedRun != worker.run)
             {
-                if (j >= req.runCount)
-                    break;
+                // the process crashed or was killed before it could report the run
+                if (!expired)
+                    OMPL_ERROR("Run %d of planner %s did not complete (process status %d)", worker.run,
+                               exp_.planners[planner].name.c_str(), status);
+                properties.clear();
+                progressData.clear();
+                properties["time REAL"] = ompl::toString(time::seconds(time::now() - worker.start));
+                properties["status ENUM"] = std::to_string(
+                    (int)(expired ? base::PlannerStatus::TIMEOUT : base::PlannerStatus::CRASH));
+                properties["solved BOOLEAN"] = std::to_string(false);
             }
+            record(worker.run, properties, progressData);
+            workers.erase(workers.begin() + (k - 1));
         }
     }
-
-    status_.running = false;
-    status_.progressPercentage = 100.0;
-    if (req.displayProgress)
+#else
+    // not reached: benchmark() only executes runs in processes where this is supported
+    for (unsigned int run : runs)
     {
-        while (status_.progressPercentage > progress->count())
-            ++(*progress);
-        std::cout << std::endl;
+        RunProperties properties;
+        RunProgressData progressData;
+        executeRun(planner, run, req, req.maxTime, machine::getProcessMemoryUsage(), maxMem, properties,
+                   progressData);
+        record(run, properties, progressData);
     }
-
-    exp_.totalDuration = time::seconds(time::now() - exp_.startTime);
-
-    OMPL_INFORM("Benchmark complete");
-    msg::useOutputHandler(oh);
-    OMPL_INFORM("Benchmark complete");
+#endif
 }
@@ -103,6 +103,10 @@ namespace ompl
         /** \brief Default number of close solutions to choose from a path experience database
             (library) for further filtering used in the Lightning Framework */
         static const unsigned int NEAREST_K_RECALL_SOLUTIONS = 10;
+
+        /** \brief Default maximum number of recalled paths that the Lightning Framework repairs
+            at the same time */
+        static const unsigned int NUM_PARALLEL_REPAIRS = 4;
     }
 }
 
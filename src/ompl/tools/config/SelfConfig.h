@@ -44,6 +44,7 @@
 #include "ompl/datastructures/NearestNeighborsSqrtApprox.h"
 #include "ompl/datastructures/NearestNeighborsGNAT.h"
 #include "ompl/datastructures/NearestNeighborsGNATNoThreadSafety.h"
+#include "ompl/datastructures/NearestNeighborsInstrumented.h"
 #include <mutex>
 #include <iostream>
 #include <string>
@@ -101,19 +102,31 @@ namespace ompl
              *   then the default is ompl::NearestNeighborsGNAT.
              * - If the space is a not a metric space,
              *   then the default is ompl::NearestNeighborsSqrtApprox.
+             *
+             * If the planner's space information has an instrumentation set, the datastructure is wrapped in an
+             * ompl::NearestNeighborsInstrumented that records the queries.
              */
             template <typename _T>
             static NearestNeighbors<_T> *getDefaultNearestNeighbors(const base::Planner *planner)
             {
                 const base::StateSpacePtr &space = planner->getSpaceInformation()->getStateSpace();
                 const base::PlannerSpecs &specs = planner->getSpecs();
+                NearestNeighbors<_T> *nn;
                 if (space->isMetricSpace())
                 {
                     if (specs.multithreaded)
-                        return new NearestNeighborsGNAT<_T>();
-                    return new NearestNeighborsGNATNoThreadSafety<_T>();
+                        nn = new NearestNeighborsGNAT<_T>();
+                    else
+                        nn = new NearestNeighborsGNATNoThreadSafety<_T>();
                 }
-                return new NearestNeighborsSqrtApprox<_T>();
+                else
+                    nn = new NearestNeighborsSqrtApprox<_T>();
+
+                // record the queries if the planner's space information is instrumented
+                if (const base::InstrumentationPtr &instrumentation =
+                        planner->getSpaceInformation()->getInstrumentation())
+                    return new NearestNeighborsInstrumented<_T>(nn, instrumentation);
+                return nn;
             }
 
             /** \brief Given a goal specification, decide on a planner for that goal */
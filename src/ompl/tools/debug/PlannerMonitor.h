@@ -49,7 +49,8 @@ namespace ompl
     namespace tools
     {
         /** \brief Monitor the properties a planner exposes, as the planner is running.
-            Dump the planner properties to a stream, periodically. */
+            Dump the planner properties to a stream, periodically. If the planner has an instrumentation set
+            (base::Planner::setInstrumentation()), the counts and times it recorded are dumped as well. */
         class PlannerMonitor
         {
         public:
@@ -52,14 +52,41 @@
 
 #if ENABLE_PROFILING
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <iostream>
 #include <thread>
 #include <mutex>
+#include <vector>
 
 #include "ompl/util/Time.h"
 
+/// @cond IGNORE
+#define OMPL_PROFILER_CONCAT_(a, b) a##b
+#define OMPL_PROFILER_CONCAT(a, b) OMPL_PROFILER_CONCAT_(a, b)
+/// @endcond
+
+/** \brief Count the time spent in the enclosing scope as the block \e name (a string literal) of
+    ompl::tools::Profiler::Instance(). The name is interned once per call site, so this costs two clock reads and a
+    few stores to thread-local memory, without any locking. Expands to nothing if ENABLE_PROFILING is 0. */
+#define OMPL_PROFILE_BLOCK(name)                                                                                       \
+    static const unsigned int OMPL_PROFILER_CONCAT(omplProfilerId, __LINE__) = ompl::tools::Profiler::intern(name);    \
+    ompl::tools::Profiler::ScopedBlock OMPL_PROFILER_CONCAT(omplProfilerBlock, __LINE__)(                              \
+        OMPL_PROFILER_CONCAT(omplProfilerId, __LINE__))
+
+/** \brief Count one occurrence of the event \e name (a string literal) in ompl::tools::Profiler::Instance(). Expands
+    to nothing if ENABLE_PROFILING is 0. */
+#define OMPL_PROFILE_EVENT(name)                                                                                       \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static const unsigned int omplProfilerId = ompl::tools::Profiler::intern(name);                                \
+        ompl::tools::Profiler::Instance().event(omplProfilerId);                                                       \
+    } while (false)
+
 namespace ompl
 {
     namespace tools
@@ -68,7 +95,18 @@ namespace ompl
             spent in various chunks of code. This is different from
             external profiling tools in that it allows the user to count
             time spent in various bits of code (sub-function granularity)
-            or count how many times certain pieces of code are executed.*/
+            or count how many times certain pieces of code are executed.
+
+            Names of blocks and events are interned to integer ids
+            (intern()). Every thread records into its own memory, so
+            begin(), end(), event() and average() do not take any locks;
+            the calls that take names only add a lookup of the id in a
+            thread-local table. Besides the totals, the most recent
+            blocks and events of every thread are kept in a ring buffer
+            (TRACE_CAPACITY entries per thread), which can be exported in
+            the Chrome trace event format (exportTrace()) to view the
+            timeline of the profiled code, e.g., in chrome://tracing or
+            Perfetto. */
         class Profiler
         {
         public:
@@ -76,24 +114,34 @@ namespace ompl
             Profiler(const Profiler &) = delete;
             Profiler &operator=(const Profiler &) = delete;
 
+            /** \brief The number of blocks and events kept per thread for exportTrace() */
+            static const unsigned int TRACE_CAPACITY = 1u << 14;
+
             /** \brief This instance will call Profiler::begin() when constructed and Profiler::end() when it goes out
              * of scope. */
             class ScopedBlock
             {
             public:
                 /** \brief Start counting time for the block named \e name of the profiler \e prof */
-                ScopedBlock(const std::string &name, Profiler &prof = Profiler::Instance()) : name_(name), prof_(prof)
+                ScopedBlock(const std::string &name, Profiler &prof = Profiler::Instance())
+                  : id_(intern(name)), prof_(prof)
                 {
-                    prof_.begin(name);
+                    prof_.begin(id_);
+                }
+
+                /** \brief Start counting time for the block with interned id \e id of the profiler \e prof */
+                ScopedBlock(unsigned int id, Profiler &prof = Profiler::Instance()) : id_(id), prof_(prof)
+                {
+                    prof_.begin(id_);
                 }
 
                 ~ScopedBlock()
                 {
-                    prof_.end(name_);
+                    prof_.end(id_);
                 }
 
             private:
-                std::string name_;
+                unsigned int id_;
                 Profiler &prof_;
             };
 
@@ -126,19 +174,18 @@ namespace ompl
 
             /** \brief Constructor. It is allowed to separately instantiate this
                 class (not only as a singleton) */
-            Profiler(bool printOnDestroy = false, bool autoStart = false)
-              : running_(false), printOnDestroy_(printOnDestroy)
-            {
-                if (autoStart)
-                    start();
-            }
+            Profiler(bool printOnDestroy = false, bool autoStart = false);
 
             /** \brief Destructor */
-            ~Profiler()
-            {
-                if (printOnDestroy_ && !data_.empty())
-                    status();
-            }
+            ~Profiler();
+
+            /** \brief Get the id of the block or event named \e name. The
+                same name always maps to the same id, for all instances of
+                the class. */
+            static unsigned int intern(const std::string &name);
+
+            /** \brief Get the name of the block or event with id \e id */
+            static std::string getName(unsigned int id);
 
             /** \brief Start counting time */
             static void Start()
@@ -164,7 +211,9 @@ namespace ompl
             /** \brief Stop counting time */
             void stop();
 
-            /** \brief Clear counted time and events */
+            /** \brief Clear counted time and events. The data of other
+                threads is discarded the next time these threads record
+                something. */
             void clear();
 
             /** \brief Count a specific event for a number of times */
@@ -174,7 +223,19 @@ namespace ompl
             }
 
             /** \brief Count a specific event for a number of times */
-            void event(const std::string &name, const unsigned int times = 1);
+            void event(const std::string &name, const unsigned int times = 1)
+            {
+                event(localIntern(name), times);
+            }
+
+            /** \brief Count the event with interned id \e id for a number of times */
+            void event(unsigned int id, const unsigned int times = 1)
+            {
+                PerThread &t = thread();
+                Stats &s = t.stats(id);
+                add(s.events, times);
+                t.trace(id, now(), INSTANT);
+            }
 
             /** \brief Maintain the average of a specific value */
             static void Average(const std::string &name, const double value)
@@ -183,7 +244,20 @@ namespace ompl
             }
 
             /** \brief Maintain the average of a specific value */
-            void average(const std::string &name, const double value);
+            void average(const std::string &name, const double value)
+            {
+                average(localIntern(name), value);
+            }
+
+            /** \brief Maintain the average of the value with interned id \e id */
+            void average(unsigned int id, const double value)
+            {
+                Stats &s = thread().stats(id);
+                s.total.store(s.total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+                s.totalSqr.store(s.totalSqr.load(std::memory_order_relaxed) + value * value,
+                                 std::memory_order_relaxed);
+                add(s.avgParts, 1);
+            }
 
             /** \brief Begin counting time for a specific chunk of code */
             static void Begin(const std::string &name)
@@ -198,10 +272,38 @@ namespace ompl
             }
 
             /** \brief Begin counting time for a specific chunk of code */
-            void begin(const std::string &name);
+            void begin(const std::string &name)
+            {
+                begin(localIntern(name));
+            }
 
             /** \brief Stop counting time for a specific chunk of code */
-            void end(const std::string &name);
+            void end(const std::string &name)
+            {
+                end(localIntern(name));
+            }
+
+            /** \brief Begin counting time for the chunk of code with interned id \e id */
+            void begin(unsigned int id)
+            {
+                thread().stats(id).start = now();
+            }
+
+            /** \brief Stop counting time for the chunk of code with interned id \e id */
+            void end(unsigned int id)
+            {
+                std::uint64_t stop = now();
+                PerThread &t = thread();
+                Stats &s = t.stats(id);
+                std::uint64_t dt = stop - s.start;
+                add(s.time, dt);
+                add(s.timeParts, 1);
+                if (dt < s.shortest.load(std::memory_order_relaxed))
+                    s.shortest.store(dt, std::memory_order_relaxed);
+                if (dt > s.longest.load(std::memory_order_relaxed))
+                    s.longest.store(dt, std::memory_order_relaxed);
+                t.trace(id, s.start, dt);
+            }
 
             /** \brief Print the status of the profiled code chunks and
                 events. Optionally, computation done by different threads
@@ -227,6 +329,18 @@ namespace ompl
                 events to the console (using msg::Console) */
             void console();
 
+            /** \brief Write the most recent blocks and events of all threads in the Chrome trace event format */
+            static void ExportTrace(std::ostream &out)
+            {
+                Instance().exportTrace(out);
+            }
+
+            /** \brief Write the most recent blocks and events of all
+                threads in the Chrome trace event format. Blocks or events
+                recorded while the trace is written may be missing or
+                partially written. */
+            void exportTrace(std::ostream &out);
+
             /** \brief Check if the profiler is counting time or not */
             bool running() const
             {
@@ -295,8 +409,8 @@ namespace ompl
                 unsigned long int parts;
             };
 
-            /** \brief Information to be maintained for each thread */
-            struct PerThread
+            /** \brief The data of a thread, combined by name, as it is printed */
+            struct ThreadInfo
             {
                 /** \brief The stored events */
                 std::map<std::string, unsigned long int> events;
@@ -308,10 +422,156 @@ namespace ompl
                 std::map<std::string, TimeInfo> time;
             };
 
-            void printThreadInfo(std::ostream &out, const PerThread &data);
+            /** \brief The counts of a block, event or average in one thread. Only the thread itself writes to
+                these; the atomics allow other threads to read them while they are updated. */
+            struct Stats
+            {
+                std::atomic<std::uint64_t> events{0};
+                std::atomic<double> total{0.0};
+                std::atomic<double> totalSqr{0.0};
+                std::atomic<std::uint64_t> avgParts{0};
+                std::atomic<std::uint64_t> time{0};
+                std::atomic<std::uint64_t> shortest{UINT64_MAX};
+                std::atomic<std::uint64_t> longest{0};
+                std::atomic<std::uint64_t> timeParts{0};
+
+                /** \brief The time the block was last started; only accessed by the thread itself */
+                std::uint64_t start{0};
+            };
+
+            /** \brief A block or event in the ring buffer of a thread */
+            struct TraceEntry
+            {
+                std::atomic<std::uint64_t> id{0};
+                std::atomic<std::uint64_t> start{0};
+                std::atomic<std::uint64_t> duration{0};
+            };
+
+            /** \brief The duration of an event in the ring buffer */
+            static const std::uint64_t INSTANT = UINT64_MAX;
+
+            /** \brief The ids are grouped in chunks of this size, allocated as they are used */
+            static const unsigned int CHUNK_SIZE = 64;
+
+            /** \brief The maximum number of chunks of ids */
+            static const unsigned int MAX_CHUNKS = 256;
+
+            /** \brief Information to be maintained for each thread */
+            struct PerThread
+            {
+                PerThread(std::thread::id threadId, unsigned int index, std::uint64_t generation);
+                ~PerThread();
+
+                /** \brief Get the counts for \e id, allocating them if needed. Only called by the thread itself. */
+                Stats &stats(unsigned int id)
+                {
+                    Stats *chunk = chunks[id / CHUNK_SIZE].load(std::memory_order_relaxed);
+                    if (chunk == nullptr)
+                        chunk = allocateChunk(id / CHUNK_SIZE);
+                    return chunk[id % CHUNK_SIZE];
+                }
+
+                /** \brief Get the counts for \e id if they were allocated; called by any thread */
+                const Stats *findStats(unsigned int id) const
+                {
+                    const Stats *chunk = chunks[id / CHUNK_SIZE].load(std::memory_order_acquire);
+                    return chunk ? chunk + id % CHUNK_SIZE : nullptr;
+                }
+
+                /** \brief Add a block (or an event, if \e duration is INSTANT) to the ring buffer */
+                void trace(unsigned int id, std::uint64_t start, std::uint64_t duration)
+                {
+                    std::uint64_t head = traceHead.load(std::memory_order_relaxed);
+                    TraceEntry &entry = traceEntries[head % TRACE_CAPACITY];
+                    entry.id.store(id, std::memory_order_relaxed);
+                    entry.start.store(start, std::memory_order_relaxed);
+                    entry.duration.store(duration, std::memory_order_relaxed);
+                    traceHead.store(head + 1, std::memory_order_release);
+                }
+
+                Stats *allocateChunk(unsigned int chunk);
+
+                /** \brief Discard all recorded data */
+                void reset(std::uint64_t newGeneration);
+
+                std::thread::id threadId;
+                unsigned int index;
+                /** \brief Whether the thread is running; once it exits, this memory is reused by the next thread
+                    that records, which continues its counts. Only accessed with lock_ held. */
+                bool active{true};
+                std::atomic<std::uint64_t> generation;
+                std::atomic<Stats *> chunks[MAX_CHUNKS];
+                std::unique_ptr<TraceEntry[]> traceEntries;
+                std::atomic<std::uint64_t> traceHead{0};
+            };
+
+            /** \brief The data of the calling thread for the profiler it last recorded to */
+            struct ThreadCache
+            {
+                /** \brief Give the memory of the thread back to the profilers it recorded to */
+                ~ThreadCache();
+
+                std::uint64_t profiler{0};
+                PerThread *data{nullptr};
+                std::map<std::string, unsigned int> ids;
+                /** \brief The unique ids of all the profilers the thread recorded to */
+                std::vector<std::uint64_t> profilers;
+            };
+
+            static thread_local ThreadCache threadCache_;
+
+            /** \brief The current time in nanoseconds */
+            static std::uint64_t now()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+            }
+
+            /** \brief Add to a counter that is only written by the calling thread */
+            static void add(std::atomic<std::uint64_t> &counter, std::uint64_t value)
+            {
+                counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+            }
+
+            /** \brief Get the data of the calling thread */
+            PerThread &thread()
+            {
+                ThreadCache &cache = threadCache_;
+                if (cache.profiler != uid_)
+                    registerThread(cache);
+                PerThread &t = *cache.data;
+                std::uint64_t generation = generation_.load(std::memory_order_relaxed);
+                if (t.generation.load(std::memory_order_relaxed) != generation)
+                    t.reset(generation);
+                return t;
+            }
+
+            /** \brief Intern \e name, looking it up in the thread-local table first */
+            static unsigned int localIntern(const std::string &name);
+
+            void registerThread(ThreadCache &cache);
+
+            /** \brief Mark the memory of the thread \e threadId as unused, as the thread exits */
+            void releaseThread(std::thread::id threadId);
+
+            /** \brief Add the data of a thread to \e info; \e names are the interned names, indexed by id */
+            void getThreadInfo(const PerThread &data, const std::vector<std::string> &names, ThreadInfo &info) const;
+
+            void printThreadInfo(std::ostream &out, const ThreadInfo &data);
+
+            /** \brief The unique id of this instance, to recognize it in the thread-local data */
+            const std::uint64_t uid_;
+
+            /** \brief Incremented by clear(), to have the threads discard their data */
+            std::atomic<std::uint64_t> generation_{0};
+
+            /** \brief The time the trace timestamps are relative to */
+            std::atomic<std::uint64_t> epoch_;
 
             std::mutex lock_;
-            std::map<std::thread::id, PerThread> data_;
+            /** \brief The memory of the threads that recorded, indexed by PerThread::index */
+            std::vector<std::unique_ptr<PerThread>> data_;
             TimeInfo tinfo_;
             bool running_;
             bool printOnDestroy_;
@@ -324,6 +584,9 @@ namespace ompl
 #include <string>
 #include <iostream>
 
+#define OMPL_PROFILE_BLOCK(name)
+#define OMPL_PROFILE_EVENT(name)
+
 /* If profiling is disabled, provide empty implementations for the
    public functions */
 namespace ompl
@@ -340,6 +603,10 @@ namespace ompl
                 {
                 }
 
+                ScopedBlock(unsigned int, Profiler & = Profiler::Instance())
+                {
+                }
+
                 ~ScopedBlock() = default;
             };
 
@@ -361,6 +628,16 @@ namespace ompl
 
             ~Profiler() = default;
 
+            static unsigned int intern(const std::string &)
+            {
+                return 0;
+            }
+
+            static std::string getName(unsigned int)
+            {
+                return std::string();
+            }
+
             static void Start()
             {
             }
@@ -393,6 +670,10 @@ namespace ompl
             {
             }
 
+            void event(unsigned int, const unsigned int = 1)
+            {
+            }
+
             static void Average(const std::string &, const double)
             {
             }
@@ -401,6 +682,10 @@ namespace ompl
             {
             }
 
+            void average(unsigned int, const double)
+            {
+            }
+
             static void Begin(const std::string &)
             {
             }
@@ -417,6 +702,14 @@ namespace ompl
             {
             }
 
+            void begin(unsigned int)
+            {
+            }
+
+            void end(unsigned int)
+            {
+            }
+
             static void Status(std::ostream & = std::cout, bool = true)
             {
             }
@@ -433,6 +726,14 @@ namespace ompl
             {
             }
 
+            static void ExportTrace(std::ostream &)
+            {
+            }
+
+            void exportTrace(std::ostream &)
+            {
+            }
+
             bool running() const
             {
                 return false;
@@ -86,6 +86,11 @@ void ompl::tools::PlannerMonitor::threadFunction()
         {
             out_ << "    \t * " << prop.first << " \t : " << prop.second() << std::endl;
         }
+        if (const base::InstrumentationPtr &instrumentation = planner_->getInstrumentation())
+        {
+            out_ << std::endl << "Instrumentation:" << std::endl;
+            instrumentation->print(out_);
+        }
         out_ << std::endl;
         out_.flush();
         lastOutputTime = time::now();
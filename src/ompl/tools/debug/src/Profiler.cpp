@@ -46,9 +46,227 @@ ompl::tools::Profiler &ompl::tools::Profiler::Instance()
 #if ENABLE_PROFILING
 
 #include "ompl/util/Console.h"
+#include "ompl/util/Exception.h"
 #include <vector>
 #include <algorithm>
+#include <iomanip>
 #include <sstream>
+#include <unordered_map>
+
+thread_local ompl::tools::Profiler::ThreadCache ompl::tools::Profiler::threadCache_;
+
+/// @cond IGNORE
+namespace
+{
+    /** \brief The names interned by all profilers */
+    struct NameRegistry
+    {
+        std::mutex lock;
+        std::vector<std::string> names;
+        std::unordered_map<std::string, unsigned int> ids;
+    };
+
+    NameRegistry &getNameRegistry()
+    {
+        // not destroyed, as profilers may still print their data during static destruction
+        static auto *registry = new NameRegistry();
+        return *registry;
+    }
+
+    std::vector<std::string> getInternedNames()
+    {
+        NameRegistry &registry = getNameRegistry();
+        std::lock_guard<std::mutex> lock(registry.lock);
+        return registry.names;
+    }
+
+    std::atomic<std::uint64_t> nextProfilerUid(1);
+
+    /** \brief The profilers that exist, by unique id, for the threads to find them as they exit */
+    struct LiveProfilers
+    {
+        std::mutex lock;
+        std::unordered_map<std::uint64_t, ompl::tools::Profiler *> profilers;
+    };
+
+    LiveProfilers &getLiveProfilers()
+    {
+        // not destroyed, as threads may exit during static destruction
+        static auto *live = new LiveProfilers();
+        return *live;
+    }
+
+    void writeJsonString(std::ostream &out, const std::string &s)
+    {
+        out << '"';
+        for (char c : s)
+        {
+            if (c == '"' || c == '\\')
+                out << '\\' << c;
+            else if ((unsigned char)c < 0x20)
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)c << std::dec
+                    << std::setfill(' ');
+            else
+                out << c;
+        }
+        out << '"';
+    }
+}
+/// @endcond
+
+ompl::tools::Profiler::Profiler(bool printOnDestroy, bool autoStart)
+  : uid_(nextProfilerUid.fetch_add(1)), epoch_(now()), running_(false), printOnDestroy_(printOnDestroy)
+{
+    LiveProfilers &live = getLiveProfilers();
+    {
+        std::lock_guard<std::mutex> lock(live.lock);
+        live.profilers[uid_] = this;
+    }
+    if (autoStart)
+        start();
+}
+
+ompl::tools::Profiler::~Profiler()
+{
+    LiveProfilers &live = getLiveProfilers();
+    {
+        std::lock_guard<std::mutex> lock(live.lock);
+        live.profilers.erase(uid_);
+    }
+    if (printOnDestroy_ && !data_.empty())
+        status();
+}
+
+unsigned int ompl::tools::Profiler::intern(const std::string &name)
+{
+    NameRegistry &registry = getNameRegistry();
+    std::lock_guard<std::mutex> lock(registry.lock);
+    auto it = registry.ids.find(name);
+    if (it != registry.ids.end())
+        return it->second;
+    if (registry.names.size() >= CHUNK_SIZE * MAX_CHUNKS)
+        throw Exception("Profiler", "Too many distinct names of profiled blocks and events");
+    auto id = (unsigned int)registry.names.size();
+    registry.names.push_back(name);
+    registry.ids[name] = id;
+    return id;
+}
+
+std::string ompl::tools::Profiler::getName(unsigned int id)
+{
+    NameRegistry &registry = getNameRegistry();
+    std::lock_guard<std::mutex> lock(registry.lock);
+    return id < registry.names.size() ? registry.names[id] : std::string();
+}
+
+unsigned int ompl::tools::Profiler::localIntern(const std::string &name)
+{
+    std::map<std::string, unsigned int> &ids = threadCache_.ids;
+    auto it = ids.find(name);
+    if (it != ids.end())
+        return it->second;
+    unsigned int id = intern(name);
+    ids[name] = id;
+    return id;
+}
+
+ompl::tools::Profiler::PerThread::PerThread(std::thread::id threadId, unsigned int index, std::uint64_t generation)
+  : threadId(threadId), index(index), generation(generation), traceEntries(new TraceEntry[TRACE_CAPACITY])
+{
+    for (auto &chunk : chunks)
+        chunk.store(nullptr, std::memory_order_relaxed);
+}
+
+ompl::tools::Profiler::PerThread::~PerThread()
+{
+    for (auto &chunk : chunks)
+        delete[] chunk.load(std::memory_order_relaxed);
+}
+
+ompl::tools::Profiler::Stats *ompl::tools::Profiler::PerThread::allocateChunk(unsigned int chunk)
+{
+    auto *stats = new Stats[CHUNK_SIZE];
+    chunks[chunk].store(stats, std::memory_order_release);
+    return stats;
+}
+
+void ompl::tools::Profiler::PerThread::reset(std::uint64_t newGeneration)
+{
+    for (auto &chunk : chunks)
+    {
+        Stats *stats = chunk.load(std::memory_order_relaxed);
+        if (stats == nullptr)
+            continue;
+        for (unsigned int i = 0; i < CHUNK_SIZE; ++i)
+        {
+            stats[i].events.store(0, std::memory_order_relaxed);
+            stats[i].total.store(0.0, std::memory_order_relaxed);
+            stats[i].totalSqr.store(0.0, std::memory_order_relaxed);
+            stats[i].avgParts.store(0, std::memory_order_relaxed);
+            stats[i].time.store(0, std::memory_order_relaxed);
+            stats[i].shortest.store(UINT64_MAX, std::memory_order_relaxed);
+            stats[i].longest.store(0, std::memory_order_relaxed);
+            stats[i].timeParts.store(0, std::memory_order_relaxed);
+        }
+    }
+    traceHead.store(0, std::memory_order_relaxed);
+    generation.store(newGeneration, std::memory_order_release);
+}
+
+ompl::tools::Profiler::ThreadCache::~ThreadCache()
+{
+    LiveProfilers &live = getLiveProfilers();
+    std::lock_guard<std::mutex> lock(live.lock);
+    for (std::uint64_t uid : profilers)
+    {
+        auto it = live.profilers.find(uid);
+        if (it != live.profilers.end())
+            it->second->releaseThread(std::this_thread::get_id());
+    }
+}
+
+void ompl::tools::Profiler::registerThread(ThreadCache &cache)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    const std::thread::id threadId = std::this_thread::get_id();
+    PerThread *data = nullptr;
+    for (const auto &d : data_)
+        if (d->active && d->threadId == threadId)
+        {
+            data = d.get();
+            break;
+        }
+    if (data == nullptr)
+    {
+        // reuse the memory of a thread that exited, if any
+        for (const auto &d : data_)
+            if (!d->active)
+            {
+                data = d.get();
+                data->threadId = threadId;
+                data->active = true;
+                break;
+            }
+        if (data == nullptr)
+        {
+            data_.emplace_back(new PerThread(threadId, (unsigned int)data_.size(),
+                                             generation_.load(std::memory_order_relaxed)));
+            data = data_.back().get();
+        }
+        if (std::find(cache.profilers.begin(), cache.profilers.end(), uid_) == cache.profilers.end())
+            cache.profilers.push_back(uid_);
+    }
+    cache.profiler = uid_;
+    cache.data = data;
+}
+
+void ompl::tools::Profiler::releaseThread(std::thread::id threadId)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    for (const auto &data : data_)
+        if (data->active && data->threadId == threadId)
+            data->active = false;
+}
 
 void ompl::tools::Profiler::start()
 {
@@ -75,47 +293,53 @@ void ompl::tools::Profiler::stop()
 void ompl::tools::Profiler::clear()
 {
     lock_.lock();
-    data_.clear();
+    generation_.fetch_add(1);
+    epoch_.store(now());
     tinfo_ = TimeInfo();
     if (running_)
         tinfo_.set();
     lock_.unlock();
 }
 
-void ompl::tools::Profiler::event(const std::string &name, const unsigned int times)
-{
-    lock_.lock();
-    data_[std::this_thread::get_id()].events[name] += times;
-    lock_.unlock();
-}
-
-void ompl::tools::Profiler::average(const std::string &name, const double value)
-{
-    lock_.lock();
-    AvgInfo &a = data_[std::this_thread::get_id()].avg[name];
-    a.total += value;
-    a.totalSqr += value * value;
-    a.parts++;
-    lock_.unlock();
-}
-
-void ompl::tools::Profiler::begin(const std::string &name)
-{
-    lock_.lock();
-    data_[std::this_thread::get_id()].time[name].set();
-    lock_.unlock();
-}
-
-void ompl::tools::Profiler::end(const std::string &name)
+void ompl::tools::Profiler::getThreadInfo(const PerThread &data, const std::vector<std::string> &names,
+                                          ThreadInfo &info) const
 {
-    lock_.lock();
-    data_[std::this_thread::get_id()].time[name].update();
-    lock_.unlock();
+    // the data of threads that did not record anything since the last clear() is discarded
+    if (data.generation.load(std::memory_order_acquire) != generation_.load())
+        return;
+    for (unsigned int id = 0; id < names.size(); ++id)
+    {
+        const Stats *stats = data.findStats(id);
+        if (stats == nullptr)
+            continue;
+        if (std::uint64_t events = stats->events.load(std::memory_order_relaxed))
+            info.events[names[id]] += events;
+        if (std::uint64_t parts = stats->avgParts.load(std::memory_order_relaxed))
+        {
+            AvgInfo &a = info.avg[names[id]];
+            a.total += stats->total.load(std::memory_order_relaxed);
+            a.totalSqr += stats->totalSqr.load(std::memory_order_relaxed);
+            a.parts += parts;
+        }
+        if (std::uint64_t parts = stats->timeParts.load(std::memory_order_relaxed))
+        {
+            TimeInfo &t = info.time[names[id]];
+            auto toDuration = [](std::uint64_t ns)
+            {
+                return std::chrono::duration_cast<time::duration>(std::chrono::nanoseconds(ns));
+            };
+            t.total = t.total + toDuration(stats->time.load(std::memory_order_relaxed));
+            t.parts += parts;
+            t.shortest = std::min(t.shortest, toDuration(stats->shortest.load(std::memory_order_relaxed)));
+            t.longest = std::max(t.longest, toDuration(stats->longest.load(std::memory_order_relaxed)));
+        }
+    }
 }
 
 void ompl::tools::Profiler::status(std::ostream &out, bool merge)
 {
     stop();
+    std::vector<std::string> names = getInternedNames();
     lock_.lock();
     printOnDestroy_ = false;
 
@@ -124,38 +348,18 @@ void ompl::tools::Profiler::status(std::ostream &out, bool merge)
 
     if (merge)
     {
-        PerThread combined;
-        for (std::map<std::thread::id, PerThread>::const_iterator it = data_.begin(); it != data_.end(); ++it)
-        {
-            for (std::map<std::string, unsigned long int>::const_iterator iev = it->second.events.begin();
-                 iev != it->second.events.end(); ++iev)
-                combined.events[iev->first] += iev->second;
-            for (std::map<std::string, AvgInfo>::const_iterator iavg = it->second.avg.begin();
-                 iavg != it->second.avg.end(); ++iavg)
-            {
-                combined.avg[iavg->first].total += iavg->second.total;
-                combined.avg[iavg->first].totalSqr += iavg->second.totalSqr;
-                combined.avg[iavg->first].parts += iavg->second.parts;
-            }
-            for (std::map<std::string, TimeInfo>::const_iterator itm = it->second.time.begin();
-                 itm != it->second.time.end(); ++itm)
-            {
-                TimeInfo &tc = combined.time[itm->first];
-                tc.total = tc.total + itm->second.total;
-                tc.parts = tc.parts + itm->second.parts;
-                if (tc.shortest > itm->second.shortest)
-                    tc.shortest = itm->second.shortest;
-                if (tc.longest < itm->second.longest)
-                    tc.longest = itm->second.longest;
-            }
-        }
+        ThreadInfo combined;
+        for (const auto &data : data_)
+            getThreadInfo(*data, names, combined);
         printThreadInfo(out, combined);
     }
     else
-        for (std::map<std::thread::id, PerThread>::const_iterator it = data_.begin(); it != data_.end(); ++it)
+        for (const auto &data : data_)
         {
-            out << "Thread " << it->first << ":" << std::endl;
-            printThreadInfo(out, it->second);
+            ThreadInfo info;
+            getThreadInfo(*data, names, info);
+            out << "Thread " << data->threadId << ":" << std::endl;
+            printThreadInfo(out, info);
         }
     lock_.unlock();
 }
@@ -168,6 +372,62 @@ void ompl::tools::Profiler::console()
     OMPL_INFORM(ss.str().c_str());
 }
 
+void ompl::tools::Profiler::exportTrace(std::ostream &out)
+{
+    std::vector<std::string> names = getInternedNames();
+    std::lock_guard<std::mutex> lock(lock_);
+    std::uint64_t epoch = epoch_.load();
+    std::uint64_t generation = generation_.load();
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+    out << std::fixed << std::setprecision(3);
+
+    // timestamps and durations are in microseconds
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto &data : data_)
+    {
+        const PerThread &t = *data;
+        std::stringstream threadName;
+        threadName << "thread " << t.threadId;
+        out << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << t.index
+            << ",\"args\":{\"name\":";
+        writeJsonString(out, threadName.str());
+        out << "}}";
+        first = false;
+
+        if (t.generation.load(std::memory_order_acquire) != generation)
+            continue;
+        std::uint64_t head = t.traceHead.load(std::memory_order_acquire);
+        std::uint64_t count = std::min<std::uint64_t>(head, TRACE_CAPACITY);
+        // the oldest entry of a full buffer may be overwritten by the thread at this moment
+        if (count == TRACE_CAPACITY)
+            --count;
+        for (std::uint64_t i = head - count; i < head; ++i)
+        {
+            const TraceEntry &entry = t.traceEntries[i % TRACE_CAPACITY];
+            std::uint64_t id = entry.id.load(std::memory_order_relaxed);
+            std::uint64_t start = entry.start.load(std::memory_order_relaxed);
+            std::uint64_t duration = entry.duration.load(std::memory_order_relaxed);
+            // skip blocks started before the last clear()
+            if (id >= names.size() || start < epoch)
+                continue;
+            out << ",\n{\"name\":";
+            writeJsonString(out, names[id]);
+            out << ",\"cat\":\"ompl\",\"pid\":1,\"tid\":" << t.index << ",\"ts\":" << (double)(start - epoch) / 1000.0;
+            if (duration == INSTANT)
+                out << ",\"ph\":\"i\",\"s\":\"t\"}";
+            else
+                out << ",\"ph\":\"X\",\"dur\":" << (double)duration / 1000.0 << "}";
+        }
+    }
+    out << "\n],\"displayTimeUnit\":\"ns\"}" << std::endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
 /// @cond IGNORE
 namespace ompl
 {
@@ -201,7 +461,7 @@ namespace ompl
 }
 /// @endcond
 
-void ompl::tools::Profiler::printThreadInfo(std::ostream &out, const PerThread &data)
+void ompl::tools::Profiler::printThreadInfo(std::ostream &out, const ThreadInfo &data)
 {
     double total = time::seconds(tinfo_.total);
 
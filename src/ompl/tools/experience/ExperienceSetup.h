@@ -113,6 +113,8 @@ namespace ompl
                 bool too_short{false};
                 bool insertion_failed{false};
                 // Lightning properties
+                // Similarity of a repaired path to the recalled one, infinite if the paths are too different for
+                // the score to be computed completely
                 double score{0.0};
                 // Thunder (SPARS) properties
                 std::size_t num_vertices{0};
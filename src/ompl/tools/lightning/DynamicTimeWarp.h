@@ -42,7 +42,8 @@
 #include <ompl/geometric/PathGeometric.h>
 #include <ompl/base/SpaceInformation.h>
 
-#include <Eigen/Core>
+#include <limits>
+#include <vector>
 
 namespace ompl
 {
@@ -62,13 +63,39 @@ namespace ompl
         public:
             explicit DynamicTimeWarp(base::SpaceInformationPtr si);
 
+            /**
+             * \brief Restrict the warping to a Sakoe-Chiba band around the (scaled) diagonal of the cost table
+             * \param fraction - half width of the band, as a fraction of the number of states of the longer path.
+             *        A value of 1 (the default) does not restrict the warping. The band is always wide enough for
+             *        the paths to be matched
+             */
+            void setBandWidth(double fraction)
+            {
+                bandWidth_ = fraction;
+            }
+
+            /** \brief Get the half width of the Sakoe-Chiba band, as a fraction of the length of the longer path */
+            double getBandWidth() const
+            {
+                return bandWidth_;
+            }
+
             /**
              * \brief Use Dynamic Timewarping to score two paths
              * \param path1
              * \param path2
+             * \param maxCost - the computation is abandoned, and infinity returned, as soon as every warping path
+             *        is known to cost at least this much
              * \return score
              */
-            double calcDTWDistance(const og::PathGeometric &path1, const og::PathGeometric &path2) const;
+            double calcDTWDistance(const og::PathGeometric &path1, const og::PathGeometric &path2,
+                                   double maxCost = std::numeric_limits<double>::infinity()) const;
+
+            /**
+             * \brief A lower bound on calcDTWDistance(): every warping path matches the two first states and the
+             *        two last states. The bound does not change when the paths are interpolated
+             */
+            double lowerBound(const og::PathGeometric &path1, const og::PathGeometric &path2) const;
 
             /**
              * \brief Use dynamic time warping to compare the similarity of two paths
@@ -77,19 +104,25 @@ namespace ompl
              *        start and goals are property aligned (and match better)
              * \param path1
              * \param path2
+             * \param maxScore - if the score is at least this value, infinity may be returned instead. Paths
+             *        whose lowerBound() already exceeds it are rejected without interpolating them
              * \return score
              */
-            double getPathsScore(const og::PathGeometric &path1, const og::PathGeometric &path2) const;
+            double getPathsScore(const og::PathGeometric &path1, const og::PathGeometric &path2,
+                                 double maxScore = std::numeric_limits<double>::infinity()) const;
 
         private:
+            /** \brief The number of states \e path has after PathGeometric::interpolate() */
+            std::size_t interpolatedStateCount(const og::PathGeometric &path) const;
+
             /** \brief The created space information */
             base::SpaceInformationPtr si_;
 
-            /** \brief Distance matrix */
-            mutable Eigen::MatrixXd table_;
+            /** \brief Half width of the Sakoe-Chiba band, relative to the length of the longer path */
+            double bandWidth_{1.0};
 
-        public:
-            EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+            /** \brief The previous and the current row of the cost table */
+            mutable std::vector<double> prevRow_, row_;
         };  // end of class
 
     }  // namespace tools
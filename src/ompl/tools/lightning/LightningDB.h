@@ -49,7 +49,7 @@
 #include "ompl/base/PlannerDataStorage.h"
 #include "ompl/base/State.h"
 #include "ompl/base/SpaceInformation.h"
-#include "ompl/datastructures/NearestNeighbors.h"
+#include "ompl/datastructures/NearestNeighborsGNAT.h"
 
 namespace ompl
 {
@@ -83,7 +83,9 @@ namespace ompl
             virtual ~LightningDB();
 
             /**
-             * \brief Load database from file
+             * \brief Load database from file. If the file contains the nearest neighbor index written by save(),
+             *        and the database is empty, the index is restored as is; otherwise it is bulk-built from the
+             *        loaded paths
              * \param fileName - name of database file
              * \return true if file loaded successfully
              */
@@ -107,7 +109,7 @@ namespace ompl
             bool saveIfChanged(const std::string &fileName);
 
             /**
-             * \brief Save loaded database to file
+             * \brief Save loaded database to file, followed by the structure of the nearest neighbor index
              * \param fileName - name of database file
              * \return true if file saved successfully
              */
@@ -147,7 +149,9 @@ namespace ompl
 
         private:
             /**
-             * \brief Add the distance between both path's starts and the distance between both path's ends together
+             * \brief Add the distance between both path's starts and the distance between both path's ends together.
+             *        The smaller of the sums for both orientations of \e b is used, which is a metric on unordered
+             *        (start, goal) pairs, so the paths can be indexed with a GNAT
              */
             double distanceFunction(const ompl::base::PlannerDataPtr &a, const ompl::base::PlannerDataPtr &b) const;
 
@@ -159,7 +163,7 @@ namespace ompl
             ompl::base::PlannerDataStorage plannerDataStorage_;
 
             // A nearest-neighbors datastructure containing the tree of start/goal states combined
-            std::shared_ptr<NearestNeighbors<ompl::base::PlannerDataPtr>> nn_;
+            std::shared_ptr<NearestNeighborsGNAT<ompl::base::PlannerDataPtr>> nn_;
 
             // Reusable plannerData instance for filling in start and goal and performing searches on the tree
             ompl::base::PlannerDataPtr nnSearchKey_;
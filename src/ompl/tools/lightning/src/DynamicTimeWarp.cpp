@@ -37,6 +37,8 @@
 
 #include <ompl/tools/lightning/DynamicTimeWarp.h>
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 namespace  // anonymous
@@ -50,57 +52,104 @@ namespace  // anonymous
     }
 }  // namespace
 
-ompl::tools::DynamicTimeWarp::DynamicTimeWarp(base::SpaceInformationPtr si) : si_(std::move(si)), table_(1, 1)
+ompl::tools::DynamicTimeWarp::DynamicTimeWarp(base::SpaceInformationPtr si) : si_(std::move(si))
 {
-    table_(0, 0) = 0.;
 }
 
-double ompl::tools::DynamicTimeWarp::calcDTWDistance(const og::PathGeometric &path1,
-                                                     const og::PathGeometric &path2) const
+double ompl::tools::DynamicTimeWarp::calcDTWDistance(const og::PathGeometric &path1, const og::PathGeometric &path2,
+                                                     double maxCost) const
 {
+    const double inf = std::numeric_limits<double>::infinity();
+
     // Get lengths
     std::size_t n = path1.getStateCount();
     std::size_t m = path2.getStateCount();
-    std::size_t nrows = table_.rows(), ncols = table_.cols();
+    if (n == 0 || m == 0)
+        return n == m ? 0. : inf;
 
-    // Intialize table
-    if (nrows <= n || ncols <= m)
-    {
-        table_.resize(n + 1, m + 1);
-        for (std::size_t i = nrows; i <= n; ++i)
-            table_(i, 0) = std::numeric_limits<double>::infinity();
-        for (std::size_t i = ncols; i <= m; ++i)
-            table_(0, i) = std::numeric_limits<double>::infinity();
-    }
+    // Half width of the band around the diagonal; it needs to cover m / n columns for the rows to be connected
+    const double slope = (double)m / (double)n;
+    const auto width = (long)std::ceil(std::max(bandWidth_ * (double)std::max(n, m), slope));
+
+    // Only two rows of the table are kept. Entries outside the band are infinite; as the band only moves right,
+    // it is enough to reset the entries just left and right of it.
+    prevRow_.assign(m + 1, inf);
+    row_.assign(m + 1, inf);
+    prevRow_[0] = 0.;
 
-    // Do calculations
-    double cost;
     for (std::size_t i = 1; i <= n; ++i)
-        for (std::size_t j = 1; j <= m; ++j)
+    {
+        const double center = slope * (double)i;
+        const auto lo = (std::size_t)std::max(1L, (long)std::floor(center) - width);
+        const auto hi = (std::size_t)std::min((long)m, (long)std::ceil(center) + width);
+
+        row_[lo - 1] = inf;
+        double rowMin = inf;
+        for (std::size_t j = lo; j <= hi; ++j)
         {
-            cost = si_->distance(path1.getState(i - 1), path2.getState(j - 1));
-            table_(i, j) = cost + min3(table_(i - 1, j), table_(i, j - 1), table_(i - 1, j - 1));
+            double cost = si_->distance(path1.getState(i - 1), path2.getState(j - 1));
+            row_[j] = cost + min3(prevRow_[j], row_[j - 1], prevRow_[j - 1]);
+            rowMin = std::min(rowMin, row_[j]);
         }
+        if (hi < m)
+            row_[hi + 1] = inf;
+
+        // Every warping path crosses this row and costs are non-negative
+        if (rowMin >= maxCost)
+            return inf;
+        prevRow_.swap(row_);
+    }
 
-    return table_(n, m);
+    return prevRow_[m];
 }
 
-double ompl::tools::DynamicTimeWarp::getPathsScore(const og::PathGeometric &path1, const og::PathGeometric &path2) const
+double ompl::tools::DynamicTimeWarp::lowerBound(const og::PathGeometric &path1, const og::PathGeometric &path2) const
 {
-    // Copy the path but not the states
-    og::PathGeometric newPath1 = path1;
-    og::PathGeometric newPath2 = path2;
+    std::size_t n = path1.getStateCount();
+    std::size_t m = path2.getStateCount();
+    if (n == 0 || m == 0)
+        return 0.;
+    double bound = si_->distance(path1.getState(0), path2.getState(0));
+    // the last states are matched by a different cell, unless both paths consist of a single state
+    if (n > 1 || m > 1)
+        bound += si_->distance(path1.getState(n - 1), path2.getState(m - 1));
+    return bound;
+}
 
-    // Interpolate both paths so that we have an even discretization of samples
-    newPath1.interpolate();
-    newPath2.interpolate();
+std::size_t ompl::tools::DynamicTimeWarp::interpolatedStateCount(const og::PathGeometric &path) const
+{
+    std::size_t n = path.getStateCount();
+    if (n == 0)
+        return 0;
+    // PathGeometric::interpolate() inserts validSegmentCount() - 1 states in each segment
+    std::size_t count = 1;
+    for (std::size_t i = 1; i < n; ++i)
+        count += si_->getStateSpace()->validSegmentCount(path.getState(i - 1), path.getState(i));
+    return count;
+}
 
+double ompl::tools::DynamicTimeWarp::getPathsScore(const og::PathGeometric &path1, const og::PathGeometric &path2,
+                                                   double maxScore) const
+{
     // compute the DTW between two vectors and divide by total path length of the longer path
-    double max_states = std::max(newPath1.getStateCount(), newPath2.getStateCount());
+    double max_states = std::max(interpolatedStateCount(path1), interpolatedStateCount(path2));
 
     // Prevent division by zero
     if (max_states == 0)
         return std::numeric_limits<double>::max();  // the worse score possible
 
-    return calcDTWDistance(newPath1, newPath2) / max_states;
+    // Reject paths that are too different before paying for the interpolation
+    double maxCost = maxScore * max_states;
+    if (lowerBound(path1, path2) >= maxCost)
+        return std::numeric_limits<double>::infinity();
+
+    // Copy the path but not the states
+    og::PathGeometric newPath1 = path1;
+    og::PathGeometric newPath2 = path2;
+
+    // Interpolate both paths so that we have an even discretization of samples
+    newPath1.interpolate();
+    newPath2.interpolate();
+
+    return calcDTWDistance(newPath1, newPath2, maxCost) / max_states;
 }
@@ -262,10 +262,13 @@ ompl::base::PlannerStatus ompl::tools::Lightning::solve(const base::PlannerTermi
                 // Reverse path2 if necessary so that it matches path1 better
                 reversePathIfNecessary(solutionPath, chosenRecallPath);
 
-                double score = dtw_->getPathsScore(solutionPath, chosenRecallPath);
+                // Only whether the score is below the threshold matters, so the scoring can stop early. The score
+                // is then infinite, in the log as well
+                const double similarityThreshold = 4.;
+                double score = dtw_->getPathsScore(solutionPath, chosenRecallPath, similarityThreshold);
                 log.score = score;
 
-                if (score < 4)
+                if (score < similarityThreshold)
                 {
                     OMPL_INFORM("NOT saving to database because best solution was from database and is too similar "
                                 "(score %f)",
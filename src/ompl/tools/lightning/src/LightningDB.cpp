@@ -44,12 +44,25 @@
 // Boost
 #include <boost/filesystem.hpp>
 
+// C++
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+/// @cond IGNORE
+namespace
+{
+    // Written between the paths and the structure of the nearest neighbor index
+    const char NN_INDEX_TAG[] = "LDBGNAT1";
+}
+/// @endcond
+
 ompl::tools::LightningDB::LightningDB(const base::StateSpacePtr &space)
 {
     si_ = std::make_shared<base::SpaceInformation>(space);
 
     // Set nearest neighbor type
-    nn_ = std::make_shared<ompl::NearestNeighborsSqrtApprox<ompl::base::PlannerDataPtr>>();
+    nn_ = std::make_shared<ompl::NearestNeighborsGNAT<ompl::base::PlannerDataPtr>>();
 
     // Use our custom distance function for nearest neighbor tree
     nn_->setDistanceFunction([this](const ompl::base::PlannerDataPtr &a, const ompl::base::PlannerDataPtr &b)
@@ -101,6 +114,7 @@ bool ompl::tools::LightningDB::load(const std::string &fileName)
     }
 
     // Start loading all the PlannerDatas
+    std::vector<ompl::base::PlannerDataPtr> plannerDatas;
     for (std::size_t i = 0; i < numPaths; ++i)
     {
         // Create a new planner data instance
@@ -109,9 +123,21 @@ bool ompl::tools::LightningDB::load(const std::string &fileName)
         // Note: the StateStorage class checks if the states match for us
         plannerDataStorage_.load(iStream, *plannerData.get());
 
-        // Add to nearest neighbor tree
-        nn_->add(plannerData);
+        plannerDatas.push_back(plannerData);
+    }
+
+    // Restore the nearest neighbor tree saved after the paths. Databases saved without it (or that cannot use it
+    // because they already contain paths) get the tree built from all loaded paths at once.
+    char tag[sizeof(NN_INDEX_TAG)];
+    bool restored = false;
+    if (nn_->size() == 0 && iStream.read(tag, sizeof(tag)) && std::memcmp(tag, NN_INDEX_TAG, sizeof(tag)) == 0)
+    {
+        restored = nn_->loadStructure(iStream, plannerDatas);
+        if (!restored)
+            OMPL_WARN("The nearest neighbor index stored in the database is invalid. Rebuilding it.");
     }
+    if (!restored)
+        nn_->add(plannerDatas);
 
     // Close file
     iStream.close();
@@ -188,13 +214,26 @@ bool ompl::tools::LightningDB::save(const std::string &fileName)
     outStream << numPaths;
 
     // Start saving each planner data object
+    std::unordered_map<const ompl::base::PlannerData *, std::size_t> index;
     for (std::size_t i = 0; i < numPaths; ++i)
     {
         ompl::base::PlannerData &pd = *plannerDatas[i].get();
 
         // Save a single planner data
         plannerDataStorage_.store(pd, outStream);
+        index[&pd] = i;
+    }
+
+    // Save the structure of the nearest neighbor tree, referring to the paths by their position in the file. The
+    // tree cannot be saved while it has removed elements; load() then builds it from the paths.
+    std::ostringstream structure;
+    if (nn_->saveStructure(structure, [&index](const ompl::base::PlannerDataPtr &pd) { return index.at(pd.get()); }))
+    {
+        outStream.write(NN_INDEX_TAG, sizeof(NN_INDEX_TAG));
+        outStream << structure.str();
     }
+    else
+        OMPL_DEBUG("LightningDB: Not saving the nearest neighbor index, which has pending removals");
 
     // Close file
     outStream.close();
@@ -582,6 +582,18 @@ namespace ompl
             /** \brief Clear all past edge state information about in collision or not */
             void clearEdgeCollisionStates();
 
+            /** \brief Bring this roadmap, a copy of \e roadmap, up to date: add the vertices and edges that were
+                added to \e roadmap since the last call, and the collision states of the edges of \e roadmap that
+                were checked since then. The first call copies the whole roadmap. This roadmap must not be
+                changed in any other way, apart from queries, so its vertices keep the indices they have in
+                \e roadmap. Returns false, without changing this roadmap, if vertices or edges were removed from
+                \e roadmap; the copy then has to be made again. */
+            bool updateFrom(const SPARSdb &roadmap);
+
+            /** \brief Set the collision states of the edges checked by queries on this roadmap since the last
+                call in \e roadmap, of which this roadmap is a copy made by updateFrom() */
+            void mergeCheckedEdgesInto(SPARSdb &roadmap);
+
         protected:
             /** \brief Free all the memory allocated by the planner */
             void freeMemory();
@@ -745,6 +757,25 @@ namespace ompl
             /** \brief Access to the collision checking state of each Edge */
             EdgeCollisionStateMap edgeCollisionStateProperty_;
 
+            /** \brief An edge whose collision state was determined by a query */
+            struct CheckedEdge
+            {
+                Vertex v1;
+                Vertex v2;
+                EdgeCollisionState state;
+            };
+
+            /** \brief The edges checked by queries, in the order they were checked. Used to pass the collision
+                states to the copies of this roadmap and back (see updateFrom()) */
+            std::vector<CheckedEdge> checkedEdges_;
+
+            /** \brief For a copy made by updateFrom(), the number of edges of the original roadmap copied so far */
+            std::size_t copiedEdges_{0};
+
+            /** \brief For a copy made by updateFrom(), the number of checkedEdges_ of the original roadmap copied
+                so far */
+            std::size_t copiedCheckedEdges_{0};
+
             /** \brief Access to the internal base::state at each Vertex */
             boost::property_map<Graph, vertex_state_t>::type stateProperty_;
 
@@ -47,6 +47,13 @@
 #include <ompl/datastructures/NearestNeighbors.h>
 #include <ompl/tools/thunder/SPARSdb.h>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace ompl
 {
     namespace tools
@@ -66,7 +73,15 @@ namespace ompl
         /** \class ompl::geometric::ThunderDBPtr
             \brief A shared pointer wrapper for ompl::tools::ThunderDB */
 
-        /** \brief Save and load entire paths from file */
+        /** \brief Save and load entire paths from file.
+
+            Paths can be inserted while queries are answered: addPathAsync() hands the path to a background thread
+            that integrates it into the roadmap, while findNearestStartGoal() runs on copies of the roadmap. Each
+            query takes a copy no other query is using, and a new copy is made if there is none, so queries run
+            concurrently. Once a batch of paths has been integrated, the copies are brought up to date by adding
+            only the new vertices and edges. At that point, the collision states of the edges checked by queries
+            are also written back to the roadmap, and passed on to the other copies. The state validity checker is
+            called from several threads at once in this mode, so it has to be thread-safe. */
         class ThunderDB
         {
         public:
@@ -94,6 +109,17 @@ namespace ompl
              */
             bool addPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime);
 
+            /**
+             * \brief Queue a copy of a solution path for insertion by a background thread and return immediately.
+             *        The first call switches queries to copies of the roadmap (see class description)
+             * \param new path
+             * \return false if saving is disabled
+             */
+            bool addPathAsync(const ompl::geometric::PathGeometric &solutionPath);
+
+            /** \brief Block until all paths queued by addPathAsync() have been inserted and published */
+            void waitForInsertions();
+
             /**
              * \brief Save loaded database to file, except skips saving if no paths have been added
              * \param fileName - name of database file
@@ -116,7 +142,8 @@ namespace ompl
             /** \brief Create the database structure for saving experiences */
             void setSPARSdb(ompl::tools::SPARSdbPtr &prm);
 
-            /** \brief Hook for debugging */
+            /** \brief Hook for debugging. This is the roadmap paths are inserted into; it must not be accessed
+                while paths queued by addPathAsync() are being inserted */
             ompl::tools::SPARSdbPtr &getSPARSdb();
 
             /** \brief Find the k nearest paths to our queries one */
@@ -150,12 +177,37 @@ namespace ompl
              * \brief Check if anything has been loaded into DB
              * \return true if has no nodes
              */
-            bool isEmpty()
-            {
-                return spars_->getNumVertices() == 0u;
-            }
+            bool isEmpty();
 
         protected:
+            /** \brief A copy of spars_ that queries run on */
+            struct Replica
+            {
+                ompl::tools::SPARSdbPtr roadmap;
+
+                /** \brief Held by the query using the copy */
+                std::mutex mutex;
+            };
+
+            /** \brief Lock a copy of spars_ no other query is using, making a new one if necessary */
+            std::unique_lock<std::mutex> lockReplica(std::shared_ptr<Replica> &replica);
+
+            /** \brief Make a new copy of spars_. The caller must hold writeMutex_ */
+            ompl::tools::SPARSdbPtr copyRoadmap() const;
+
+            /** \brief Write the collision states found by queries back to spars_. The caller must hold
+                writeMutex_ */
+            void mergeCheckedEdges();
+
+            /** \brief Bring the copies of spars_ up to date. The caller must hold writeMutex_ */
+            void updateReplicas();
+
+            /** \brief Insert a path into spars_. The caller must hold writeMutex_ */
+            bool insertPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime);
+
+            /** \brief The body of the background thread started by addPathAsync() */
+            void insertionLoop();
+
             /// The created space information
             base::SpaceInformationPtr si_;  // TODO: is this even necessary?
 
@@ -171,6 +223,34 @@ namespace ompl
             // Allow the database to save to file (new experiences)
             bool saving_enabled_;
 
+            // Set once paths are inserted in the background; queries then run on replicas_ instead of spars_
+            std::atomic<bool> useReplicas_{false};
+
+            // Copies of spars_ that queries run on once paths are inserted in the background
+            std::vector<std::shared_ptr<Replica>> replicas_;
+
+            // Protects the list replicas_, but not the copies themselves
+            std::mutex replicasMutex_;
+
+            // Serializes access to spars_: insertion, loading, saving, and queries while useReplicas_ is false
+            mutable std::mutex writeMutex_;
+
+            // Paths waiting to be inserted by the background thread
+            std::deque<ompl::geometric::PathGeometric> pendingPaths_;
+
+            // Number of paths taken from pendingPaths_ but not published yet
+            std::size_t pathsInProgress_{0};
+
+            // Set to stop the background thread once pendingPaths_ is empty
+            bool stopInsertion_{false};
+
+            // Protects pendingPaths_, pathsInProgress_ and stopInsertion_
+            std::mutex pendingMutex_;
+            std::condition_variable pendingCondition_;
+
+            // The background thread inserting paths
+            std::thread insertionThread_;
+
         };  // end of class ThunderDB
 
     }  // end of namespace
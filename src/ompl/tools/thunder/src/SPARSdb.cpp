@@ -44,6 +44,7 @@
 #include <boost/graph/astar_search.hpp>
 #include <boost/graph/incremental_components.hpp>
 #include <boost/property_map/vector_property_map.hpp>
+#include <iterator>
 #include <random>
 
 // Allow hooks for visualizing planner
@@ -186,6 +187,9 @@ void ompl::geometric::SPARSdb::freeMemory()
         stateProperty_[v] = nullptr;
     }
     g_.clear();
+    checkedEdges_.clear();
+    copiedEdges_ = 0;
+    copiedCheckedEdges_ = 0;
 
     if (nn_)
         nn_->clear();
@@ -525,6 +529,9 @@ bool ompl::geometric::SPARSdb::lazyCollisionCheck(std::vector<Vertex> &vertexPat
                 // Mark edge as free so we no longer need to check for collision
                 edgeCollisionStateProperty_[thisEdge] = FREE;
             }
+            // Remember the result for the copies of this roadmap (see updateFrom())
+            auto state = static_cast<EdgeCollisionState>(edgeCollisionStateProperty_[thisEdge]);
+            checkedEdges_.push_back(CheckedEdge{fromVertex, toVertex, state});
         }
 
         // Check final result
@@ -1837,3 +1844,50 @@ void ompl::geometric::SPARSdb::clearEdgeCollisionStates()
     foreach (const Edge e, boost::edges(g_))
         edgeCollisionStateProperty_[e] = NOT_CHECKED;  // each edge has an unknown state
 }
+
+bool ompl::geometric::SPARSdb::updateFrom(const SPARSdb &roadmap)
+{
+    if (boost::num_vertices(roadmap.g_) < boost::num_vertices(g_) || boost::num_edges(roadmap.g_) < copiedEdges_ ||
+        roadmap.checkedEdges_.size() < copiedCheckedEdges_)
+        return false;
+
+    // Vertex 0 is the query vertex of both roadmaps, and vertices are never removed, so the new vertices are the
+    // ones with the largest indices
+    checkQueryStateInitialization();
+    for (std::size_t v = boost::num_vertices(g_); v < boost::num_vertices(roadmap.g_); ++v)
+        addGuard(si_->cloneState(roadmap.stateProperty_[v]), roadmap.colorProperty_[v]);
+
+    // The edges of an undirected graph are listed in the order they were added. The edge iterator is not
+    // bidirectional, but the list it iterates over is.
+    using EdgeIterator = boost::graph_traits<Graph>::edge_iterator;
+    const EdgeIterator end = boost::edges(roadmap.g_).second;
+    for (EdgeIterator it(std::prev(end.base(), boost::num_edges(roadmap.g_) - copiedEdges_)); it != end; ++it)
+    {
+        const Vertex v1 = boost::source(*it, roadmap.g_);
+        const Vertex v2 = boost::target(*it, roadmap.g_);
+        connectGuards(v1, v2);
+        edgeCollisionStateProperty_[boost::edge(v1, v2, g_).first] = roadmap.edgeCollisionStateProperty_[*it];
+    }
+    copiedEdges_ = boost::num_edges(roadmap.g_);
+
+    for (; copiedCheckedEdges_ < roadmap.checkedEdges_.size(); ++copiedCheckedEdges_)
+    {
+        const CheckedEdge &checked = roadmap.checkedEdges_[copiedCheckedEdges_];
+        edgeCollisionStateProperty_[boost::edge(checked.v1, checked.v2, g_).first] = checked.state;
+    }
+    return true;
+}
+
+void ompl::geometric::SPARSdb::mergeCheckedEdgesInto(SPARSdb &roadmap)
+{
+    for (const CheckedEdge &checked : checkedEdges_)
+    {
+        const Edge e = boost::edge(checked.v1, checked.v2, roadmap.g_).first;
+        if (roadmap.edgeCollisionStateProperty_[e] == NOT_CHECKED)
+        {
+            roadmap.edgeCollisionStateProperty_[e] = checked.state;
+            roadmap.checkedEdges_.push_back(checked);
+        }
+    }
+    checkedEdges_.clear();
+}
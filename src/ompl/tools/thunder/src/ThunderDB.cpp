@@ -45,6 +45,9 @@
 // Boost
 #include <boost/filesystem.hpp>
 
+#include <map>
+#include <memory>
+
 ompl::tools::ThunderDB::ThunderDB(const base::StateSpacePtr &space) : numPathsInserted_(0), saving_enabled_(true)
 {
     // Set space information
@@ -53,6 +56,17 @@ ompl::tools::ThunderDB::ThunderDB(const base::StateSpacePtr &space) : numPathsIn
 
 ompl::tools::ThunderDB::~ThunderDB()
 {
+    // Let the background thread insert the remaining paths, so they can still be saved
+    if (insertionThread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex_);
+            stopInsertion_ = true;
+        }
+        pendingCondition_.notify_all();
+        insertionThread_.join();
+    }
+
     if (numPathsInserted_)
         OMPL_WARN("The database is being unloaded with unsaved experiences");
 }
@@ -78,6 +92,7 @@ bool ompl::tools::ThunderDB::load(const std::string &fileName)
 
     // Load database from file, track loading time
     time::point start = time::now();
+    std::lock_guard<std::mutex> lock(writeMutex_);
 
     OMPL_INFORM("Loading database from file: %s", fileName.c_str());
 
@@ -118,6 +133,10 @@ bool ompl::tools::ThunderDB::load(const std::string &fileName)
     // Output the number of connected components
     OMPL_INFORM("  %d connected components", spars_->getNumConnectedComponents());
 
+    // Queries should see the loaded data as well
+    if (useReplicas_)
+        updateReplicas();
+
     // Close file
     iStream.close();
 
@@ -143,9 +162,18 @@ bool ompl::tools::ThunderDB::addPath(ompl::geometric::PathGeometric &solutionPat
         return false;
     }
 
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    bool result = insertPath(solutionPath, insertionTime);
+    if (useReplicas_)
+        updateReplicas();
+    return result;
+}
+
+bool ompl::tools::ThunderDB::insertPath(ompl::geometric::PathGeometric &solutionPath, double &insertionTime)
+{
     bool result;
     double seconds = 120;  // 10; // a large number, should never need to use this
-    ompl::base::PlannerTerminationCondition ptc = ompl::base::timedPlannerTerminationCondition(seconds, 0.1);
+    ompl::base::PlannerTerminationCondition ptc = ompl::base::timedPlannerTerminationCondition(seconds);
 
     // Benchmark runtime
     time::point startTime = time::now();
@@ -162,6 +190,157 @@ bool ompl::tools::ThunderDB::addPath(ompl::geometric::PathGeometric &solutionPat
     return result;
 }
 
+bool ompl::tools::ThunderDB::addPathAsync(const ompl::geometric::PathGeometric &solutionPath)
+{
+    // Error check
+    if (!spars_)
+    {
+        OMPL_ERROR("SPARSdb planner has not been passed into the ThunderDB yet");
+        return false;
+    }
+
+    // Prevent inserting into database
+    if (!saving_enabled_)
+    {
+        OMPL_WARN("ThunderDB: Saving is disabled so not adding path");
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (!insertionThread_.joinable())
+        {
+            // From now on, queries run on copies of the roadmap
+            useReplicas_ = true;
+            insertionThread_ = std::thread([this] { insertionLoop(); });
+        }
+        pendingPaths_.push_back(solutionPath);
+    }
+    pendingCondition_.notify_all();
+    return true;
+}
+
+void ompl::tools::ThunderDB::waitForInsertions()
+{
+    std::unique_lock<std::mutex> lock(pendingMutex_);
+    pendingCondition_.wait(lock, [this] { return pendingPaths_.empty() && pathsInProgress_ == 0; });
+}
+
+void ompl::tools::ThunderDB::insertionLoop()
+{
+    std::unique_lock<std::mutex> lock(pendingMutex_);
+    while (true)
+    {
+        pendingCondition_.wait(lock, [this] { return stopInsertion_ || !pendingPaths_.empty(); });
+        if (pendingPaths_.empty())
+            return;
+
+        // Insert all the paths queued so far, and publish them together
+        std::deque<ompl::geometric::PathGeometric> paths;
+        paths.swap(pendingPaths_);
+        pathsInProgress_ = paths.size();
+        lock.unlock();
+        {
+            std::lock_guard<std::mutex> wlock(writeMutex_);
+            for (auto &path : paths)
+            {
+                double insertionTime;
+                insertPath(path, insertionTime);
+                OMPL_INFORM("ThunderDB: Inserted experience path in the background in %f seconds", insertionTime);
+            }
+            updateReplicas();
+        }
+        lock.lock();
+        pathsInProgress_ = 0;
+        pendingCondition_.notify_all();
+    }
+}
+
+std::unique_lock<std::mutex> ompl::tools::ThunderDB::lockReplica(std::shared_ptr<Replica> &replica)
+{
+    {
+        std::lock_guard<std::mutex> lock(replicasMutex_);
+        for (const auto &r : replicas_)
+        {
+            std::unique_lock<std::mutex> rlock(r->mutex, std::try_to_lock);
+            if (rlock.owns_lock())
+            {
+                replica = r;
+                return rlock;
+            }
+        }
+    }
+
+    // All copies are in use by other queries
+    auto r(std::make_shared<Replica>());
+    std::unique_lock<std::mutex> rlock(r->mutex);
+    {
+        std::lock_guard<std::mutex> wlock(writeMutex_);
+        r->roadmap = copyRoadmap();
+        std::lock_guard<std::mutex> lock(replicasMutex_);
+        replicas_.push_back(r);
+        OMPL_INFORM("ThunderDB: Made copy %d of the roadmap for concurrent queries", replicas_.size());
+    }
+    replica = r;
+    return rlock;
+}
+
+ompl::tools::SPARSdbPtr ompl::tools::ThunderDB::copyRoadmap() const
+{
+    // A new roadmap with the same settings, filled with the vertices and edges of spars_
+    auto roadmap(std::make_shared<ompl::geometric::SPARSdb>(spars_->getSpaceInformation()));
+    std::map<std::string, std::string> params;
+    spars_->params().getParams(params);
+    roadmap->params().setParams(params);
+    roadmap->setProblemDefinition(spars_->getProblemDefinition());
+    roadmap->setup();
+    roadmap->updateFrom(*spars_);
+    return roadmap;
+}
+
+void ompl::tools::ThunderDB::mergeCheckedEdges()
+{
+    std::vector<std::shared_ptr<Replica>> replicas;
+    {
+        std::lock_guard<std::mutex> lock(replicasMutex_);
+        replicas = replicas_;
+    }
+    for (auto &replica : replicas)
+    {
+        std::lock_guard<std::mutex> rlock(replica->mutex);
+        replica->roadmap->mergeCheckedEdgesInto(*spars_);
+    }
+}
+
+void ompl::tools::ThunderDB::updateReplicas()
+{
+    time::point start = time::now();
+
+    // Collect the collision states first, so every copy gets the ones found on the others
+    mergeCheckedEdges();
+
+    std::vector<std::shared_ptr<Replica>> replicas;
+    {
+        std::lock_guard<std::mutex> lock(replicasMutex_);
+        replicas = replicas_;
+    }
+    for (auto &replica : replicas)
+    {
+        // Waits for the query running on this copy, if any
+        std::lock_guard<std::mutex> rlock(replica->mutex);
+        if (!replica->roadmap->updateFrom(*spars_))
+            replica->roadmap = copyRoadmap();
+    }
+    OMPL_INFORM("ThunderDB: Updated %d copies of the roadmap to %d vertices in %f sec", replicas.size(),
+                spars_->getNumVertices(), time::seconds(time::now() - start));
+}
+
+bool ompl::tools::ThunderDB::isEmpty()
+{
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    return spars_->getNumVertices() == 0u;
+}
+
 bool ompl::tools::ThunderDB::saveIfChanged(const std::string &fileName)
 {
     if (numPathsInserted_)
@@ -194,6 +373,8 @@ bool ompl::tools::ThunderDB::save(const std::string &fileName)
 
     // Save database from file, track saving time
     time::point start = time::now();
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    mergeCheckedEdges();
 
     OMPL_INFORM("Saving database to file: %s", fileName.c_str());
 
@@ -269,7 +450,10 @@ void ompl::tools::ThunderDB::getAllPlannerDatas(std::vector<ompl::base::PlannerD
     }
 
     auto data(std::make_shared<base::PlannerData>(si_));
-    spars_->getPlannerData(*data);
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        spars_->getPlannerData(*data);
+    }
     plannerDatas.push_back(data);
 
     // OMPL_DEBUG("ThunderDB::getAllPlannerDatas: Number of planner databases found: %d", plannerDatas.size());
@@ -279,7 +463,18 @@ bool ompl::tools::ThunderDB::findNearestStartGoal(int nearestK, const base::Stat
                                                   ompl::geometric::SPARSdb::CandidateSolution &candidateSolution,
                                                   const base::PlannerTerminationCondition &ptc)
 {
-    bool result = spars_->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    bool result;
+    if (useReplicas_)
+    {
+        std::shared_ptr<Replica> replica;
+        std::unique_lock<std::mutex> lock = lockReplica(replica);
+        result = replica->roadmap->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    }
+    else
+    {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        result = spars_->getSimilarPaths(nearestK, start, goal, candidateSolution, ptc);
+    }
 
     if (!result)
     {
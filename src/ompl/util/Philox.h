@@ -0,0 +1,158 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_UTIL_PHILOX_
+#define OMPL_UTIL_PHILOX_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace ompl
+{
+    /** \brief The Philox4x32-10 counter-based random number engine.
+
+        The output is a bijective function of a 128-bit counter and a 64-bit key, so the state is only a
+        few words (instead of the 5KB of the Mersenne Twister), jumping ahead by any number of values takes
+        constant time, and independent streams are obtained by simply using different keys. The engine
+        satisfies the requirements of a uniform random bit generator and can be used with the standard
+        distributions.
+
+        @par J. K. Salmon, M. A. Moraes, R. O. Dror, D. E. Shaw, "Parallel random numbers: as easy as 1, 2, 3,"
+        in Proc. Intl. Conf. for High Performance Computing, Networking, Storage and Analysis (SC), 2011.
+        DOI: <a href="https://doi.org/10.1145/2063384.2063405">10.1145/2063384.2063405</a>. */
+    class Philox4x32
+    {
+    public:
+        using result_type = std::uint32_t;
+
+        /** \brief Constructor. The key is formed from \e seed and \e stream. */
+        explicit Philox4x32(std::uint32_t seed = 0, std::uint32_t stream = 0)
+        {
+            this->seed(seed, stream);
+        }
+
+        static constexpr result_type min()
+        {
+            return 0;
+        }
+
+        static constexpr result_type max()
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /** \brief Restart the engine at the beginning of the stream identified by \e seed and \e stream */
+        void seed(std::uint32_t seed = 0, std::uint32_t stream = 0)
+        {
+            key_ = {{seed, stream}};
+            counter_ = 0;
+            index_ = 4;
+        }
+
+        /** \brief Generate the next 32 random bits */
+        result_type operator()()
+        {
+            if (index_ == 4)
+            {
+                output_ = block(counter_++, key_);
+                index_ = 0;
+            }
+            return output_[index_++];
+        }
+
+        /** \brief Skip the next \e z values of the stream in constant time */
+        void discard(unsigned long long z)
+        {
+            // position of the next value, counted from the start of the block that produced output_
+            unsigned long long position = index_ + z;
+            if (index_ == 4)
+                position -= 4;
+            else
+                --counter_;
+            counter_ += position / 4;
+            index_ = position % 4;
+            if (index_ == 0)
+                index_ = 4;
+            else
+                output_ = block(counter_++, key_);
+        }
+
+        /** \brief Compute the four 32-bit words of the block at position \e counter in the stream with key \e key.
+            The upper 64 bits of the counter are always zero. */
+        static std::array<std::uint32_t, 4> block(std::uint64_t counter, std::array<std::uint32_t, 2> key)
+        {
+            std::array<std::uint32_t, 4> x{{static_cast<std::uint32_t>(counter),
+                                            static_cast<std::uint32_t>(counter >> 32), 0u, 0u}};
+            for (unsigned int r = 0; r < 10; ++r)
+            {
+                if (r > 0)
+                {
+                    key[0] += 0x9E3779B9u;
+                    key[1] += 0xBB67AE85u;
+                }
+                const std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * x[0];
+                const std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * x[2];
+                x = {{static_cast<std::uint32_t>(p1 >> 32) ^ x[1] ^ key[0], static_cast<std::uint32_t>(p1),
+                      static_cast<std::uint32_t>(p0 >> 32) ^ x[3] ^ key[1], static_cast<std::uint32_t>(p0)}};
+            }
+            return x;
+        }
+
+        bool operator==(const Philox4x32 &other) const
+        {
+            return key_ == other.key_ && counter_ == other.counter_ && index_ == other.index_;
+        }
+
+        bool operator!=(const Philox4x32 &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        /** \brief The key identifying the stream */
+        std::array<std::uint32_t, 2> key_;
+
+        /** \brief The position of the next block in the stream */
+        std::uint64_t counter_;
+
+        /** \brief The most recently generated block */
+        std::array<std::uint32_t, 4> output_;
+
+        /** \brief The index of the next unused word in output_ (4 if none is left) */
+        unsigned int index_;
+    };
+}  // namespace ompl
+
+#endif
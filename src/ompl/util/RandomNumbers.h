@@ -44,6 +44,7 @@
 #include <algorithm>
 
 #include "ompl/config.h"
+#include "ompl/util/Philox.h"
 #include "ompl/util/ProlateHyperspheroid.h"
 
 namespace ompl
@@ -57,18 +58,46 @@ namespace ompl
     class RNG
     {
     public:
+#if OMPL_RNG_COUNTER_BASED
+        /** \brief The underlying random number engine */
+        using Engine = Philox4x32;
+#else
+        /** \brief The underlying random number engine */
+        using Engine = std::mt19937;
+#endif
+
         /** \brief Constructor. Always sets a different random seed */
         RNG();
 
         /** \brief Constructor. Set to the specified instance seed. */
         RNG(std::uint_fast32_t localSeed);
 
+        /** \brief Constructor. Set to the specified instance seed and select one of the independent streams
+            derived from it. This is meant for worker threads: an RNG constructed as RNG(rng.getLocalSeed(), tid)
+            produces the same numbers no matter in which order the threads are started. Stream 0 is the
+            sequence generated by RNG(localSeed). */
+        RNG(std::uint_fast32_t localSeed, std::uint_fast32_t stream);
+
+        /** \brief Copy constructor. The copy continues the sequence of \e other. If \e other was seeded by RNG(),
+            the copy is reseeded by reseedInstances() as well. */
+        RNG(const RNG &other);
+
+        /** \brief Assignment. As for the copy constructor, this instance is reseeded by reseedInstances() if and
+            only if \e other is. */
+        RNG &operator=(const RNG &other);
+
+        ~RNG();
+
         /** \brief Generate a random real between 0 and 1 */
         double uniform01()
         {
             return uniDist_(generator_);
         }
 
+        /** \brief Fill \e values with \e count random reals between 0 and 1. This does not generate the same
+            numbers as calling uniform01() repeatedly. */
+        void uniform01(double *values, std::size_t count);
+
         /** \brief Generate a random real within given bounds: [\e lower_bound, \e upper_bound) */
         double uniformReal(double lower_bound, double upper_bound)
         {
@@ -95,6 +124,10 @@ namespace ompl
             return normalDist_(generator_);
         }
 
+        /** \brief Fill \e values with \e count random reals using a normal distribution with mean 0 and
+            variance 1. This does not generate the same numbers as calling gaussian01() repeatedly. */
+        void gaussian01(double *values, std::size_t count);
+
         /** \brief Generate a random real using a normal distribution with given mean and variance */
         double gaussian(double mean, double stddev)
         {
@@ -131,6 +164,12 @@ namespace ompl
             (repeatable) behaviour across multiple instances of RNG. Useful for debugging. */
         static std::uint_fast32_t getSeed();
 
+        /** \brief Seed the generator of instance seeds with \e seed, and give every existing instance that was
+            seeded by RNG() a new seed from it. Instances given a seed explicitly keep it. This is meant for a process
+            created by fork(), which would otherwise generate the same random numbers as its parent and as the other
+            processes forked from the same state. No instance may be in use by another thread during this call. */
+        static void reseedInstances(std::uint_fast32_t seed);
+
         /** \brief Set the seed used for the instance of a RNG. Use this function to ensure that an instance of
             an RNG generates the same deterministic sequence of numbers. This function resets the member generators*/
         void setLocalSeed(std::uint_fast32_t localSeed);
@@ -144,6 +183,16 @@ namespace ompl
             return localSeed_;
         }
 
+        /** \brief Get the stream of the local seed this instance generates numbers from */
+        std::uint_fast32_t getLocalStream() const
+        {
+            return localStream_;
+        }
+
+        /** \brief Skip the next \e count raw values of the underlying engine. This takes constant time when
+            the counter-based engine is used (OMPL_RNG_COUNTER_BASED) and linear time otherwise. */
+        void discard(unsigned long long count);
+
         /** \brief Uniform random sampling of a unit-length vector. I.e., the surface of an n-ball. The return variable
          * \e value is expected to already exist. */
         void uniformNormalVector(std::vector<double> &v);
@@ -186,9 +235,17 @@ namespace ompl
          * dimension. */
         class SphericalData;
 
+        /** \brief Seed the generator from localSeed_ and localStream_ */
+        void seedGenerator();
+
+        /** \brief Set localSeed_ and reset the generator and the distributions */
+        void resetLocalSeed(std::uint_fast32_t localSeed);
+
         /** \brief The seed used for the instance of a RNG */
         std::uint_fast32_t localSeed_;
-        std::mt19937 generator_;
+        /** \brief The stream of localSeed_ used by this instance */
+        std::uint_fast32_t localStream_{0};
+        Engine generator_;
         std::uniform_real_distribution<> uniDist_{0, 1};
         std::normal_distribution<> normalDist_{0, 1};
         // A structure holding boost::uniform_on_sphere distributions and the associated boost::variate_generators for
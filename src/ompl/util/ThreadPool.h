@@ -0,0 +1,156 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#ifndef OMPL_UTIL_THREAD_POOL_
+#define OMPL_UTIL_THREAD_POOL_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace ompl
+{
+    /** \brief A set of worker threads that are created once and reused for running tasks.
+
+        Components that need to do work in parallel submit tasks to a pool instead of starting (and
+        joining) their own threads every time they are called. Most code should use the process-wide
+        pool returned by ThreadPool::global(), so that several components running at the same time
+        share the same workers instead of oversubscribing the machine.
+
+        Every worker has its own queue. Tasks submitted by a worker go to the front of that worker's
+        queue, tasks submitted by other threads are distributed over the queues, and a worker that runs
+        out of tasks steals from the back of the other queues. */
+    class ThreadPool
+    {
+    public:
+        /** \brief Constructor. Start \e numThreads workers; if \e numThreads is 0, one worker per
+            hardware thread is started. If \e pinThreads is true, worker i is bound to CPU i (modulo the
+            number of CPUs); this is only supported on Linux and ignored elsewhere. */
+        explicit ThreadPool(unsigned int numThreads = 0, bool pinThreads = false);
+
+        /** \brief Destructor. Waits for the queued tasks to finish. */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /** \brief The pool shared by the whole process. After fork(), the child process creates a new pool
+            when it first uses it. */
+        static ThreadPool &global();
+
+        /** \brief Set the arguments the global pool is constructed with. This only has an effect if called
+            before the first call to global(). If the environment variable OMPL_NUM_THREADS is set, it is
+            used as the default number of threads of the global pool. */
+        static void configureGlobal(unsigned int numThreads, bool pinThreads = false);
+
+        /** \brief The number of worker threads */
+        unsigned int size() const
+        {
+            return workers_.size();
+        }
+
+        /** \brief Queue \e fn for execution by one of the workers. The returned future holds the result
+            of the call, or the exception it threw. Waiting on the future from inside a task can deadlock
+            if all workers are busy; use run() for work that is waited on by tasks. */
+        template <typename F>
+        std::future<typename std::result_of<F()>::type> submit(F &&fn)
+        {
+            using R = typename std::result_of<F()>::type;
+            auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+            std::future<R> result = task->get_future();
+            post([task] { (*task)(); });
+            return result;
+        }
+
+        /** \brief Execute all \e tasks and return when they have finished. The calling thread executes
+            tasks as well, so this never waits for a worker to become available: if all workers are
+            busy (or run() is called from a task), the tasks are simply executed with less parallelism.
+            Tasks are started in order, and the calling thread always starts the first one.
+            If a task throws, the first exception is rethrown here after all tasks have finished.
+            Because the tasks may run one after the other, this is meant for bounded work; tasks that
+            loop until a termination condition is true (e.g., the threads of a parallel planner) need
+            threads of their own, as otherwise the first one uses up the whole time budget. */
+        void run(const std::vector<std::function<void()>> &tasks);
+
+    private:
+        /** \brief The queue of one worker */
+        struct Queue
+        {
+            std::deque<std::function<void()>> jobs;
+            std::mutex mutex;
+        };
+
+        /** \brief Add a job to a queue and wake up a worker */
+        void post(std::function<void()> job);
+
+        /** \brief Take a job from the queue of worker \e index, or steal one from another worker */
+        bool take(std::size_t index, std::function<void()> &job);
+
+        /** \brief The loop executed by worker \e index */
+        void work(std::size_t index);
+
+        /** \brief Bind the calling thread to CPU \e cpu */
+        static void pin(unsigned int cpu);
+
+        /** \brief The worker threads */
+        std::vector<std::thread> workers_;
+
+        /** \brief One queue per worker */
+        std::vector<std::unique_ptr<Queue>> queues_;
+
+        /** \brief The queue the next job from outside the pool goes to */
+        std::atomic<std::size_t> nextQueue_{0};
+
+        /** \brief The number of queued jobs */
+        std::atomic<std::size_t> pending_{0};
+
+        /** \brief Used by idle workers to wait for jobs */
+        std::mutex sleepMutex_;
+
+        /** \brief Signaled when jobs are added or the pool is stopped */
+        std::condition_variable condition_;
+
+        /** \brief Flag set when the pool is destroyed */
+        bool stop_{false};
+    };
+}
+
+#endif
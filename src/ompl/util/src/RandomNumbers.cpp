@@ -37,8 +37,12 @@
 #include "ompl/util/RandomNumbers.h"
 #include "ompl/util/Exception.h"
 #include "ompl/util/Console.h"
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <boost/math/constants/constants.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/random/uniform_on_sphere.hpp>
@@ -104,6 +108,15 @@ namespace
             return sDist_(sGen_);
         }
 
+        /// Seed the generator without the checks of setSeed(), for RNG::reseedInstances()
+        void reseed(std::uint_fast32_t seed)
+        {
+            std::lock_guard<std::mutex> slock(rngMutex_);
+            someSeedsGenerated_ = true;
+            sGen_.seed(seed);
+            sDist_.reset();
+        }
+
     private:
         bool someSeedsGenerated_{false};
         std::uint_fast32_t firstSeed_;
@@ -125,6 +138,50 @@ namespace
         std::call_once(g_once, &initRNGSeedGenerator);
         return *g_RNGSeedGenerator;
     }
+
+    /// The instances seeded by RNG(), with the order in which they were created,
+    /// so RNG::reseedInstances() gives them their seeds in a repeatable order
+    struct RNGInstances
+    {
+        std::mutex mutex;
+        std::unordered_map<ompl::RNG *, std::uint64_t> order;
+        std::uint64_t created{0};
+    };
+
+    RNGInstances &getRNGInstances()
+    {
+        // never destroyed, as instances with static storage duration may unregister after exit() started
+        static auto *instances = new RNGInstances();
+        return *instances;
+    }
+
+    void registerRNGInstance(ompl::RNG *rng)
+    {
+        RNGInstances &instances = getRNGInstances();
+        std::lock_guard<std::mutex> lock(instances.mutex);
+        instances.order[rng] = instances.created++;
+    }
+
+    void unregisterRNGInstance(ompl::RNG *rng)
+    {
+        RNGInstances &instances = getRNGInstances();
+        std::lock_guard<std::mutex> lock(instances.mutex);
+        instances.order.erase(rng);
+    }
+
+    /// Register \e rng if and only if \e other is registered, for copies of \e other
+    void copyRNGInstanceRegistration(const ompl::RNG *other, ompl::RNG *rng)
+    {
+        RNGInstances &instances = getRNGInstances();
+        std::lock_guard<std::mutex> lock(instances.mutex);
+        if (instances.order.count(const_cast<ompl::RNG *>(other)) > 0)
+        {
+            if (instances.order.count(rng) == 0)
+                instances.order[rng] = instances.created++;
+        }
+        else
+            instances.order.erase(rng);
+    }
 }  // namespace
 /// @endcond
 
@@ -139,10 +196,10 @@ public:
     using spherical_dist_t = boost::uniform_on_sphere<double, container_type_t>;
 
     /** \brief The resulting variate generator type. */
-    using variate_generator_t = boost::variate_generator<std::mt19937 *, spherical_dist_t>;
+    using variate_generator_t = boost::variate_generator<Engine *, spherical_dist_t>;
 
     /** \brief Constructor */
-    SphericalData(std::mt19937 *generatorPtr) : generatorPtr_(generatorPtr){};
+    SphericalData(Engine *generatorPtr) : generatorPtr_(generatorPtr){};
 
     /** \brief The generator for a specified dimension. Will create if not existent */
     container_type_t generate(unsigned int dim)
@@ -177,7 +234,7 @@ private:
     std::vector<dist_gen_pair_t> dimVector_;
 
     /** \brief A pointer to the generator owned by the outer class. Needed for creating new variate_generators */
-    std::mt19937 *generatorPtr_;
+    Engine *generatorPtr_;
 
     /** \brief Grow the vector until it contains an (empty) entry for the specified dimension. */
     void growVector(unsigned int dim)
@@ -215,11 +272,28 @@ void ompl::RNG::setSeed(std::uint_fast32_t seed)
     getRNGSeedGenerator().setSeed(seed);
 }
 
+void ompl::RNG::reseedInstances(std::uint_fast32_t seed)
+{
+    RNGSeedGenerator &generator = getRNGSeedGenerator();
+    generator.reseed(seed);
+
+    RNGInstances &instances = getRNGInstances();
+    std::lock_guard<std::mutex> lock(instances.mutex);
+    std::vector<std::pair<std::uint64_t, RNG *>> sorted;
+    sorted.reserve(instances.order.size());
+    for (const auto &instance : instances.order)
+        sorted.emplace_back(instance.second, instance.first);
+    std::sort(sorted.begin(), sorted.end());
+    for (const auto &instance : sorted)
+        instance.second->resetLocalSeed(generator.nextSeed());
+}
+
 ompl::RNG::RNG()
   : localSeed_(getRNGSeedGenerator().nextSeed())
   , generator_(localSeed_)
   , sphericalDataPtr_(std::make_shared<SphericalData>(&generator_))
 {
+    registerRNGInstance(this);
 }
 
 ompl::RNG::RNG(std::uint_fast32_t localSeed)
@@ -227,13 +301,73 @@ ompl::RNG::RNG(std::uint_fast32_t localSeed)
 {
 }
 
+ompl::RNG::RNG(std::uint_fast32_t localSeed, std::uint_fast32_t stream)
+  : localSeed_(localSeed), localStream_(stream), sphericalDataPtr_(std::make_shared<SphericalData>(&generator_))
+{
+    seedGenerator();
+}
+
+ompl::RNG::RNG(const RNG &other)
+  : localSeed_(other.localSeed_)
+  , localStream_(other.localStream_)
+  , generator_(other.generator_)
+  , uniDist_(other.uniDist_)
+  , normalDist_(other.normalDist_)
+  , sphericalDataPtr_(std::make_shared<SphericalData>(&generator_))
+{
+    copyRNGInstanceRegistration(&other, this);
+}
+
+ompl::RNG &ompl::RNG::operator=(const RNG &other)
+{
+    if (this == &other)
+        return *this;
+    localSeed_ = other.localSeed_;
+    localStream_ = other.localStream_;
+    generator_ = other.generator_;
+    uniDist_ = other.uniDist_;
+    normalDist_ = other.normalDist_;
+    // the spherical distributions refer to the generator of their instance, so they are not copied
+    sphericalDataPtr_ = std::make_shared<SphericalData>(&generator_);
+    copyRNGInstanceRegistration(&other, this);
+    return *this;
+}
+
+ompl::RNG::~RNG()
+{
+    unregisterRNGInstance(this);
+}
+
+void ompl::RNG::seedGenerator()
+{
+#if OMPL_RNG_COUNTER_BASED
+    // Streams are simply different keys of the counter-based engine
+    generator_.seed(localSeed_, localStream_);
+#else
+    if (localStream_ == 0)
+        generator_.seed(localSeed_);
+    else
+    {
+        std::seed_seq seq{localSeed_, localStream_};
+        generator_.seed(seq);
+    }
+#endif
+}
+
 void ompl::RNG::setLocalSeed(std::uint_fast32_t localSeed)
+{
+    // an explicitly seeded instance is not reseeded by reseedInstances()
+    unregisterRNGInstance(this);
+    resetLocalSeed(localSeed);
+}
+
+void ompl::RNG::resetLocalSeed(std::uint_fast32_t localSeed)
 {
     // Store the seed
     localSeed_ = localSeed;
 
     // Change the generator's seed
-    generator_.seed(localSeed_);
+    seedGenerator();
 
     // Reset the distributions used by the variate generators, as they can cache values
     uniDist_.reset();
@@ -241,6 +375,38 @@ void ompl::RNG::setLocalSeed(std::uint_fast32_t localSeed)
     sphericalDataPtr_->reset();
 }
 
+void ompl::RNG::uniform01(double *values, std::size_t count)
+{
+    // 53 random bits per value, taken from two 32-bit outputs of the engine
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto a = static_cast<std::uint32_t>(generator_()) >> 5;
+        const auto b = static_cast<std::uint32_t>(generator_()) >> 6;
+        values[i] = (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
+}
+
+void ompl::RNG::gaussian01(double *values, std::size_t count)
+{
+    // Box-Muller transform of pairs of uniform values, so every two uniform values give two normal values
+    const std::size_t even = count - count % 2;
+    uniform01(values, even);
+    for (std::size_t i = 0; i < even; i += 2)
+    {
+        const double r = std::sqrt(-2.0 * std::log(1.0 - values[i]));
+        const double t = 2.0 * boost::math::constants::pi<double>() * values[i + 1];
+        values[i] = r * std::cos(t);
+        values[i + 1] = r * std::sin(t);
+    }
+    if (even < count)
+        values[even] = normalDist_(generator_);
+}
+
+void ompl::RNG::discard(unsigned long long count)
+{
+    generator_.discard(count);
+}
+
 double ompl::RNG::halfNormalReal(double r_min, double r_max, double focus)
 {
     assert(r_min <= r_max);
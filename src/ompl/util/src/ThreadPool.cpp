@@ -0,0 +1,277 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#include "ompl/util/ThreadPool.h"
+#include "ompl/util/Console.h"
+#include <algorithm>
+#include <cstdlib>
+#include <exception>
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace
+{
+    /* The arguments for the global pool, set by ThreadPool::configureGlobal(), and the pool itself */
+    struct GlobalPoolConfig
+    {
+        unsigned int numThreads{0};
+        bool pinThreads{false};
+        bool created{false};
+        std::atomic<ompl::ThreadPool *> pool{nullptr};
+        std::mutex mutex;
+    };
+
+    GlobalPoolConfig &globalPoolConfig()
+    {
+        static GlobalPoolConfig config;
+        return config;
+    }
+
+    /* The index of the worker running on this thread in the pool it belongs to */
+    thread_local const ompl::ThreadPool *currentPool = nullptr;
+    thread_local std::size_t currentWorker = 0;
+}
+
+ompl::ThreadPool::ThreadPool(unsigned int numThreads, bool pinThreads)
+{
+    if (numThreads == 0)
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned int i = 0; i < numThreads; ++i)
+        queues_.emplace_back(new Queue());
+    workers_.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+        workers_.emplace_back([this, i, pinThreads]
+                              {
+                                  if (pinThreads)
+                                      pin(i);
+                                  work(i);
+                              });
+}
+
+ompl::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_ = true;
+    }
+    condition_.notify_all();
+    for (auto &worker : workers_)
+        worker.join();
+}
+
+ompl::ThreadPool &ompl::ThreadPool::global()
+{
+    GlobalPoolConfig &config = globalPoolConfig();
+    ThreadPool *pool = config.pool;
+    if (pool != nullptr)
+        return *pool;
+
+    std::lock_guard<std::mutex> lock(config.mutex);
+    if (config.pool == nullptr)
+    {
+        unsigned int numThreads = config.numThreads;
+        if (numThreads == 0)
+            if (const char *env = std::getenv("OMPL_NUM_THREADS"))
+                numThreads = std::strtoul(env, nullptr, 10);
+#if defined(__unix__) || defined(__APPLE__)
+        // A forked child only has the thread that called fork(), so it gets a new pool. The workers of the
+        // old pool do not exist in the child, so the old pool is abandoned rather than destroyed.
+        if (!config.created)
+            pthread_atfork([] { globalPoolConfig().mutex.lock(); }, [] { globalPoolConfig().mutex.unlock(); },
+                           []
+                           {
+                               globalPoolConfig().pool = nullptr;
+                               globalPoolConfig().mutex.unlock();
+                           });
+#endif
+        config.created = true;
+        // never destroyed, so the pool can be used until the process exits
+        config.pool = new ThreadPool(numThreads, config.pinThreads);
+    }
+    return *config.pool;
+}
+
+void ompl::ThreadPool::configureGlobal(unsigned int numThreads, bool pinThreads)
+{
+    GlobalPoolConfig &config = globalPoolConfig();
+    std::lock_guard<std::mutex> lock(config.mutex);
+    if (config.created)
+    {
+        OMPL_WARN("ThreadPool: The global pool is already running; its configuration cannot be changed");
+        return;
+    }
+    config.numThreads = numThreads;
+    config.pinThreads = pinThreads;
+}
+
+void ompl::ThreadPool::pin(unsigned int cpu)
+{
+#if defined(__linux__)
+    unsigned int cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu % cpus, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+        OMPL_WARN("ThreadPool: Unable to pin worker thread to CPU %u", cpu % cpus);
+#else
+    (void)cpu;
+#endif
+}
+
+void ompl::ThreadPool::post(std::function<void()> job)
+{
+    // Workers keep their own jobs local; other threads spread them over all queues
+    std::size_t index = currentPool == this ? currentWorker : nextQueue_++ % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        queues_[index]->jobs.push_front(std::move(job));
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        ++pending_;
+    }
+    condition_.notify_one();
+}
+
+bool ompl::ThreadPool::take(std::size_t index, std::function<void()> &job)
+{
+    for (std::size_t i = 0; i < queues_.size(); ++i)
+    {
+        Queue &queue = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.jobs.empty())
+            continue;
+        // the owner takes its most recent job, thieves take the oldest one
+        if (i == 0)
+        {
+            job = std::move(queue.jobs.front());
+            queue.jobs.pop_front();
+        }
+        else
+        {
+            job = std::move(queue.jobs.back());
+            queue.jobs.pop_back();
+        }
+        --pending_;
+        return true;
+    }
+    return false;
+}
+
+void ompl::ThreadPool::work(std::size_t index)
+{
+    currentPool = this;
+    currentWorker = index;
+    while (true)
+    {
+        std::function<void()> job;
+        if (take(index, job))
+        {
+            job();
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        condition_.wait(lock, [this] { return stop_ || pending_ > 0; });
+        if (stop_ && pending_ == 0)
+            return;
+    }
+}
+
+namespace
+{
+    /* Shared by the caller of ThreadPool::run() and the helper jobs it posts. Helpers may start after
+       run() has returned; they then find no task left to claim and only touch this state. */
+    struct RunState
+    {
+        const std::vector<std::function<void()>> *tasks;
+        std::size_t count;
+        std::atomic<std::size_t> next{0};
+        std::size_t finished{0};
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable condition;
+
+        void execute(std::size_t index)
+        {
+            std::exception_ptr e;
+            try
+            {
+                (*tasks)[index]();
+            }
+            catch (...)
+            {
+                e = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (e && !error)
+                error = e;
+            if (++finished == count)
+                condition.notify_all();
+        }
+
+        void executeRemaining()
+        {
+            std::size_t index;
+            while ((index = next++) < count)
+                execute(index);
+        }
+    };
+}
+
+void ompl::ThreadPool::run(const std::vector<std::function<void()>> &tasks)
+{
+    if (tasks.empty())
+        return;
+
+    auto state = std::make_shared<RunState>();
+    state->tasks = &tasks;
+    state->count = tasks.size();
+    state->next = 1;
+
+    // the calling thread takes a share of the tasks, so one helper fewer is needed
+    std::size_t helpers = std::min<std::size_t>(tasks.size() - 1, workers_.size());
+    for (std::size_t i = 0; i < helpers; ++i)
+        post([state] { state->executeRemaining(); });
+    state->execute(0);
+    state->executeRemaining();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state] { return state->finished == state->count; });
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
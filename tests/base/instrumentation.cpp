@@ -0,0 +1,107 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "Instrumentation"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/base/Instrumentation.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/SimpleSetup.h"
+#include "ompl/geometric/planners/rrt/RRT.h"
+
+using namespace ompl;
+
+static geometric::SimpleSetupPtr makeSetup()
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto setup(std::make_shared<geometric::SimpleSetup>(space));
+    // a wall with a gap at the top
+    setup->setStateValidityChecker([](const base::State *state)
+                                   {
+                                       const double *x = state->as<base::RealVectorStateSpace::StateType>()->values;
+                                       return x[0] < 0.45 || x[0] > 0.55 || x[1] > 0.9;
+                                   });
+    base::ScopedState<> start(space), goal(space);
+    start[0] = 0.1;
+    start[1] = 0.1;
+    goal[0] = 0.9;
+    goal[1] = 0.1;
+    setup->setStartAndGoalStates(start, goal);
+    setup->setPlanner(std::make_shared<geometric::RRT>(setup->getSpaceInformation()));
+    return setup;
+}
+
+BOOST_AUTO_TEST_CASE(InstrumentedPlanner)
+{
+    geometric::SimpleSetupPtr setup = makeSetup();
+    auto instrumentation(std::make_shared<base::Instrumentation>());
+    setup->getPlanner()->setInstrumentation(instrumentation);
+    BOOST_CHECK(setup->getPlanner()->getInstrumentation() == instrumentation);
+    BOOST_CHECK(setup->getSpaceInformation()->getInstrumentation() == instrumentation);
+
+    BOOST_REQUIRE(setup->solve(5.0));
+    for (auto event : {base::Instrumentation::VALIDITY_CHECK, base::Instrumentation::MOTION_CHECK,
+                       base::Instrumentation::STATE_SAMPLE, base::Instrumentation::NEAREST_NEIGHBOR_QUERY,
+                       base::Instrumentation::NEAREST_NEIGHBOR_INSERTION, base::Instrumentation::STATE_ALLOCATION})
+    {
+        BOOST_CHECK_MESSAGE(instrumentation->getCount(event) > 0, base::Instrumentation::getEventName(event));
+        BOOST_CHECK(instrumentation->getTime(event) >= 0.0);
+    }
+    // every node of the tree except the start state is added after a query for its nearest neighbor
+    std::uint64_t queries = instrumentation->getCount(base::Instrumentation::NEAREST_NEIGHBOR_QUERY);
+    BOOST_CHECK(instrumentation->getCount(base::Instrumentation::NEAREST_NEIGHBOR_INSERTION) <= queries + 1);
+    BOOST_CHECK(instrumentation->getCount(base::Instrumentation::MOTION_CHECK) <= queries);
+
+    setup->clear();
+    instrumentation->clear();
+    for (int e = 0; e < base::Instrumentation::EVENT_COUNT; ++e)
+        BOOST_CHECK_EQUAL(instrumentation->getCount(static_cast<base::Instrumentation::Event>(e)), 0u);
+
+    // detaching the instrumentation stops the recording
+    setup->getPlanner()->setInstrumentation(base::InstrumentationPtr());
+    setup->getSpaceInformation()->isValid(setup->getProblemDefinition()->getStartState(0));
+    BOOST_CHECK_EQUAL(instrumentation->getCount(base::Instrumentation::VALIDITY_CHECK), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(EventNames)
+{
+    BOOST_CHECK_EQUAL(std::string(base::Instrumentation::getEventName(base::Instrumentation::VALIDITY_CHECK)),
+                      "validity check");
+    BOOST_CHECK_EQUAL(
+        std::string(base::Instrumentation::getEventPluralName(base::Instrumentation::NEAREST_NEIGHBOR_QUERY)),
+        "nearest neighbor queries");
+    BOOST_CHECK_EQUAL(std::string(base::Instrumentation::getEventPluralName(base::Instrumentation::EVENT_COUNT)),
+                      "unknown");
+}
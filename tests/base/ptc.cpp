@@ -36,6 +36,7 @@
 
 #define BOOST_TEST_MODULE "PlannerTerminationCondition"
 #include <boost/test/unit_test.hpp>
+#include <atomic>
 #include <iostream>
 #include <thread>
 
@@ -86,6 +87,50 @@ BOOST_AUTO_TEST_CASE(TestThreadedTermination)
   BOOST_CHECK(ptc_long());
 }
 
+BOOST_AUTO_TEST_CASE(TestConcurrentConditions)
+{
+  // several conditions evaluated periodically, one of them slow, while several deadlines expire
+  std::atomic<bool> stop(false);
+  std::atomic<unsigned int> slowCalls(0);
+  std::vector<base::PlannerTerminationCondition> periodic;
+  for (unsigned int i = 0; i < 4; ++i)
+    periodic.emplace_back([&stop] { return stop.load(); }, 0.01);
+  base::PlannerTerminationCondition slow([&slowCalls]
+                                         {
+                                           ++slowCalls;
+                                           std::this_thread::sleep_for(ompl::time::seconds(0.3));
+                                           return false;
+                                         }, 0.01);
+
+  time::point start = time::now();
+  std::vector<base::PlannerTerminationCondition> timed;
+  for (unsigned int i = 1; i <= 5; ++i)
+    timed.push_back(base::timedPlannerTerminationCondition(0.05 * i));
+
+  // the slow condition does not delay the deadlines
+  for (unsigned int i = 0; i < timed.size(); ++i)
+  {
+    while (!timed[i])
+      std::this_thread::sleep_for(ompl::time::seconds(0.001));
+    double elapsed = time::seconds(time::now() - start);
+    BOOST_CHECK_GE(elapsed, 0.05 * (i + 1));
+    BOOST_CHECK_LT(elapsed, 0.05 * (i + 1) + 0.1);
+  }
+  for (const auto &ptc : periodic)
+    BOOST_CHECK(!ptc);
+
+  // all the periodic conditions see the change
+  stop = true;
+  for (const auto &ptc : periodic)
+  {
+    time::point waitStart = time::now();
+    while (!ptc && time::seconds(time::now() - waitStart) < 5.0)
+      std::this_thread::sleep_for(ompl::time::seconds(0.001));
+    BOOST_CHECK(ptc);
+  }
+  BOOST_CHECK(slowCalls > 0u);
+}
+
 BOOST_AUTO_TEST_CASE(TestIterationTermination)
 {
   base::IterationTerminationCondition iptc(10);
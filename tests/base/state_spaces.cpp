@@ -37,6 +37,7 @@
 #define BOOST_TEST_MODULE "StateSpaces"
 #include <boost/test/unit_test.hpp>
 #include <iostream>
+#include <thread>
 
 #include "ompl/base/ScopedState.h"
 #include "ompl/base/SpaceInformation.h"
@@ -47,6 +48,8 @@
 #include "ompl/base/spaces/SO3StateSpace.h"
 #include "ompl/base/spaces/SE2StateSpace.h"
 #include "ompl/base/spaces/SE3StateSpace.h"
+#include "ompl/base/spaces/FixedSE2StateSpace.h"
+#include "ompl/base/spaces/FixedSE3StateSpace.h"
 #include "ompl/base/spaces/DiscreteStateSpace.h"
 #include "ompl/base/spaces/ReedsSheppStateSpace.h"
 #include "ompl/base/spaces/DubinsStateSpace.h"
@@ -98,6 +101,158 @@ BOOST_AUTO_TEST_CASE(ReedsShepp_Simple)
     d->sanityChecks();
 }
 
+template <typename Space>
+void testDistanceLookupTable(const std::shared_ptr<Space> &space)
+{
+    base::RealVectorBounds bounds2(2);
+    bounds2.setLow(-3);
+    bounds2.setHigh(3);
+    space->setBounds(bounds2);
+    space->setup();
+
+    base::ScopedState<base::SE2StateSpace> s1(space), s2(space), s3(space), s4(space);
+    std::vector<std::pair<base::ScopedState<base::SE2StateSpace>, base::ScopedState<base::SE2StateSpace>>> pairs;
+    std::vector<double> exact;
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        s1.random();
+        s2.random();
+        pairs.emplace_back(s1, s2);
+        exact.push_back(space->distance(s1.get(), s2.get()));
+    }
+
+    const double tolerance = 1e-2;
+    const bool metric = space->isMetricSpace();
+    space->setLookupTable(24, 8., tolerance);
+    BOOST_REQUIRE(space->hasLookupTable());
+    // the approximated distance is not a metric
+    BOOST_CHECK(!space->isMetricSpace());
+    BOOST_CHECK(space->getLookupTable()->getSafeFraction() > 0.1);
+    for (unsigned int i = 0; i < pairs.size(); ++i)
+        BOOST_OMPL_EXPECT_NEAR(space->distance(pairs[i].first.get(), pairs[i].second.get()), exact[i],
+                               2. * tolerance);
+
+    // a path cached by a query in one direction is not reused for the other
+    for (auto &p : pairs)
+    {
+        space->interpolate(p.first.get(), p.second.get(), .5, s3.get());
+        space->distance(p.second.get(), p.first.get());
+        space->interpolate(p.first.get(), p.second.get(), .5, s4.get());
+        BOOST_CHECK_EQUAL(s3, s4);
+    }
+
+    space->setLookupTable(0);
+    BOOST_CHECK(!space->hasLookupTable());
+    BOOST_CHECK_EQUAL(space->isMetricSpace(), metric);
+}
+
+BOOST_AUTO_TEST_CASE(SE2_DistanceLookupTable)
+{
+    testDistanceLookupTable(std::make_shared<base::DubinsStateSpace>());
+    testDistanceLookupTable(std::make_shared<base::DubinsStateSpace>(1., true));
+    testDistanceLookupTable(std::make_shared<base::ReedsSheppStateSpace>(.5));
+}
+
+class MotionContextSpace : public base::RealVectorStateSpace
+{
+public:
+    MotionContextSpace() : base::RealVectorStateSpace(2)
+    {
+    }
+
+    using base::RealVectorStateSpace::getMotionContext;
+    using base::RealVectorStateSpace::setMotionContext;
+};
+
+BOOST_AUTO_TEST_CASE(MotionContext)
+{
+    std::vector<std::shared_ptr<MotionContextSpace>> spaces;
+    for (unsigned int i = 0; i < 10; ++i)
+        spaces.push_back(std::make_shared<MotionContextSpace>());
+
+    // contexts are kept per space and thread
+    BOOST_CHECK(spaces[0]->getMotionContext() == nullptr);
+    base::StateSpace::MotionContext *context =
+        spaces[0]->setMotionContext(std::unique_ptr<base::StateSpace::MotionContext>(new base::StateSpace::MotionContext));
+    BOOST_CHECK(spaces[0]->getMotionContext() == context);
+    BOOST_CHECK(spaces[1]->getMotionContext() == nullptr);
+    base::StateSpace::MotionContext *other = context;
+    std::thread([&] { other = spaces[0]->getMotionContext(); }).join();
+    BOOST_CHECK(other == nullptr);
+
+    // only the contexts of the spaces that stored one most recently are kept
+    for (auto &space : spaces)
+        space->setMotionContext(std::unique_ptr<base::StateSpace::MotionContext>(new base::StateSpace::MotionContext));
+    BOOST_CHECK(spaces[0]->getMotionContext() == nullptr);
+    BOOST_CHECK(spaces.back()->getMotionContext() != nullptr);
+
+    // interpolation along a cached steering solution is unaffected by aliasing
+    for (const base::StateSpacePtr &space : {base::StateSpacePtr(std::make_shared<base::DubinsStateSpace>(.5, true)),
+                                             base::StateSpacePtr(std::make_shared<base::ReedsSheppStateSpace>(.5))})
+    {
+        base::RealVectorBounds bounds(2);
+        bounds.setLow(-3);
+        bounds.setHigh(3);
+        space->as<base::SE2StateSpace>()->setBounds(bounds);
+        space->setup();
+        base::ScopedState<> from(space), to(space), expected(space), state(space);
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            from.random();
+            to.random();
+            space->interpolate(from.get(), to.get(), .3, expected.get());
+            state = from;
+            space->interpolate(state.get(), to.get(), .3, state.get());
+            BOOST_CHECK_EQUAL(state, expected);
+        }
+    }
+}
+
+class OwnContextDubinsStateSpace : public base::DubinsStateSpace
+{
+public:
+    struct OwnContext : public MotionContext
+    {
+        double value{0.};
+    };
+
+    OwnContextDubinsStateSpace() : base::DubinsStateSpace(.5)
+    {
+    }
+
+    void storeOwnContext() const
+    {
+        setMotionContext(std::unique_ptr<MotionContext>(new OwnContext()));
+    }
+};
+
+BOOST_AUTO_TEST_CASE(MotionContext_Derived)
+{
+    // a context stored by a derived space is replaced, not misinterpreted, by the base space
+    auto space(std::make_shared<OwnContextDubinsStateSpace>());
+    auto reference(std::make_shared<base::DubinsStateSpace>(.5));
+    base::RealVectorBounds bounds(2);
+    bounds.setLow(-3);
+    bounds.setHigh(3);
+    space->setBounds(bounds);
+    space->setup();
+    reference->setBounds(bounds);
+    reference->setup();
+
+    base::ScopedState<> from(space), to(space), state(space), expected(reference);
+    for (unsigned int i = 0; i < 100; ++i)
+    {
+        from.random();
+        to.random();
+        space->storeOwnContext();
+        BOOST_CHECK_EQUAL(space->distance(from.get(), to.get()), reference->distance(from.get(), to.get()));
+        space->storeOwnContext();
+        space->interpolate(from.get(), to.get(), .3, state.get());
+        reference->interpolate(from.get(), to.get(), .3, expected.get());
+        BOOST_CHECK(space->equalStates(state.get(), expected.get()));
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Discrete_Simple)
 {
     auto d(std::make_shared<base::DiscreteStateSpace>(0, 2));
@@ -244,6 +399,92 @@ BOOST_AUTO_TEST_CASE(SO3_Simple)
     BOOST_CHECK_EQUAL(proj->getDimension(), 3u);
 }
 
+BOOST_AUTO_TEST_CASE(SE3_Batch)
+{
+    auto m(std::make_shared<base::SE3StateSpace>());
+    base::RealVectorBounds bounds(3);
+    bounds.setLow(-1);
+    bounds.setHigh(1);
+    m->setBounds(bounds);
+    m->setup();
+
+    const std::size_t n = 100;
+    std::vector<base::State *> states(n);
+    for (auto &state : states)
+        state = m->allocState();
+    base::ScopedState<base::SE3StateSpace> from(m), to(m), expected(m);
+
+    base::StateSamplerPtr ss = m->allocStateSampler();
+    ss->sampleUniformBatch(states.data(), n);
+    from.random();
+
+    std::vector<double> distances(n);
+    m->distanceBatch(from.get(), states.data(), n, distances.data());
+    for (std::size_t i = 0; i < n; ++i)
+        BOOST_OMPL_EXPECT_NEAR(distances[i], m->distance(from.get(), states[i]), 2.2e-8);
+
+    std::vector<double> times(n);
+    for (std::size_t i = 0; i < n; ++i)
+        times[i] = (double)i / (double)(n - 1);
+
+    // Far apart (slerp) and very close (nlerp) rotations
+    for (double d : {1.0, 1e-3})
+    {
+        ss->sampleUniformNear(to.get(), from.get(), d);
+        m->interpolateBatch(from.get(), to.get(), times.data(), n, states.data());
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m->interpolate(from.get(), to.get(), times[i], expected.get());
+            const auto *state = states[i]->as<base::SE3StateSpace::StateType>();
+            BOOST_OMPL_EXPECT_NEAR(state->getX(), expected->getX(), 1e-12);
+            BOOST_OMPL_EXPECT_NEAR(state->getY(), expected->getY(), 1e-12);
+            BOOST_OMPL_EXPECT_NEAR(state->getZ(), expected->getZ(), 1e-12);
+            BOOST_OMPL_EXPECT_NEAR(state->rotation().x, expected->rotation().x, 2e-8);
+            BOOST_OMPL_EXPECT_NEAR(state->rotation().y, expected->rotation().y, 2e-8);
+            BOOST_OMPL_EXPECT_NEAR(state->rotation().z, expected->rotation().z, 2e-8);
+            BOOST_OMPL_EXPECT_NEAR(state->rotation().w, expected->rotation().w, 2e-8);
+            BOOST_OMPL_EXPECT_NEAR(m->getSubspace(1)->as<base::SO3StateSpace>()->norm(&state->rotation()), 1.0,
+                                   1e-12);
+        }
+    }
+
+    for (auto &state : states)
+        m->freeState(state);
+}
+
+BOOST_AUTO_TEST_CASE(SE3_BatchSubclass)
+{
+    // a space that overrides interpolate() is not bypassed by the batch interpolation of its base class
+    class SnappingSE3StateSpace : public base::SE3StateSpace
+    {
+    public:
+        void interpolate(const base::State *from, const base::State *to, double t, base::State *state) const override
+        {
+            copyState(state, t < 0.5 ? from : to);
+        }
+    };
+
+    auto m(std::make_shared<SnappingSE3StateSpace>());
+    base::RealVectorBounds bounds(3);
+    bounds.setLow(-1);
+    bounds.setHigh(1);
+    m->setBounds(bounds);
+
+    base::SpaceInformation si(m);
+    si.setStateValidityChecker([](const base::State *) { return true; });
+    si.setup();
+
+    base::ScopedState<base::SE3StateSpace> from(m), to(m);
+    from.random();
+    to.random();
+    std::vector<base::State *> states;
+    unsigned int count = si.getMotionStates(from.get(), to.get(), states, 9, true, true);
+    BOOST_CHECK_EQUAL(count, 11u);
+    for (unsigned int i = 0; i < count; ++i)
+        BOOST_CHECK(m->equalStates(states[i], i < 5 ? from.get() : to.get()));
+    si.freeStates(states);
+}
+
 BOOST_AUTO_TEST_CASE(RealVector_Bounds)
 {
     base::RealVectorBounds bounds1(1);
@@ -309,6 +550,66 @@ BOOST_AUTO_TEST_CASE(RealVector_Simple)
     BOOST_CHECK_EQUAL(m2->getDimension(), 1u);
 }
 
+BOOST_AUTO_TEST_CASE(Fixed_Simple)
+{
+    auto m(std::make_shared<base::FixedRealVectorStateSpace<6>>());
+    m->setBounds(-1, 1);
+    m->setup();
+    m->sanityChecks();
+
+    StateSpaceTest mt(m, 1000, 1e-12);
+    mt.test();
+
+    auto m2(std::make_shared<base::FixedRealVectorStateSpace<2>>());
+    m2->setBounds(-1, 1);
+    m2->addDimension(-1, 1);
+    BOOST_CHECK_THROW(m2->setup(), ompl::Exception);
+
+    base::RealVectorBounds bounds(3);
+    bounds.setLow(-1);
+    bounds.setHigh(1);
+    base::StateSpacePtr se2(std::make_shared<base::SE2StateSpace>());
+    base::StateSpacePtr fse2(std::make_shared<base::FixedSE2StateSpace>());
+    base::StateSpacePtr se3(std::make_shared<base::SE3StateSpace>());
+    base::StateSpacePtr fse3(std::make_shared<base::FixedSE3StateSpace>());
+    bounds.resize(2);
+    se2->as<base::SE2StateSpace>()->setBounds(bounds);
+    fse2->as<base::SE2StateSpace>()->setBounds(bounds);
+    bounds.resize(3);
+    se3->as<base::SE3StateSpace>()->setBounds(bounds);
+    fse3->as<base::SE3StateSpace>()->setBounds(bounds);
+
+    // the fixed spaces must behave exactly like the spaces they specialize
+    for (const auto &spaces : {std::make_pair(se2, fse2), std::make_pair(se3, fse3)})
+    {
+        const base::StateSpacePtr &regular = spaces.first;
+        const base::StateSpacePtr &fixed = spaces.second;
+        regular->setup();
+        fixed->setup();
+        fixed->sanityChecks();
+        BOOST_CHECK_EQUAL(fixed->getDimension(), regular->getDimension());
+        BOOST_OMPL_EXPECT_NEAR(fixed->getMaximumExtent(), regular->getMaximumExtent(), 1e-12);
+
+        base::ScopedState<> a(regular), b(regular), c(regular);
+        base::ScopedState<> fa(fixed), fb(fixed), fc(fixed);
+        for (int i = 0; i < 100; ++i)
+        {
+            a.random();
+            b.random();
+            fa = a.reals();
+            fb = b.reals();
+            BOOST_OMPL_EXPECT_NEAR(fixed->distance(fa.get(), fb.get()), regular->distance(a.get(), b.get()), 1e-12);
+            regular->interpolate(a.get(), b.get(), 0.3, c.get());
+            fixed->interpolate(fa.get(), fb.get(), 0.3, fc.get());
+            std::vector<double> expected = c.reals(), actual = fc.reals();
+            for (std::size_t j = 0; j < expected.size(); ++j)
+                BOOST_OMPL_EXPECT_NEAR(actual[j], expected[j], 1e-12);
+            fixed->copyState(fc.get(), fa.get());
+            BOOST_CHECK(fixed->equalStates(fc.get(), fa.get()));
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Time_Bounds)
 {
     base::TimeStateSpace t;
@@ -419,6 +720,50 @@ BOOST_AUTO_TEST_CASE(Compound_Simple)
     BOOST_CHECK(t->includes(t));
 }
 
+BOOST_AUTO_TEST_CASE(Compound_SampleBatch)
+{
+    auto se3(std::make_shared<base::SE3StateSpace>());
+    base::RealVectorBounds bounds(3);
+    bounds.setLow(-1);
+    bounds.setHigh(2);
+    se3->setBounds(bounds);
+    base::StateSpacePtr m = se3 + std::make_shared<base::SO2StateSpace>();
+
+    base::SpaceInformation si(m);
+    // only half of the space is valid
+    si.setStateValidityChecker(
+        [](const base::State *state)
+        {
+            return state->as<base::CompoundState>()->as<base::SE3StateSpace::StateType>(0)->getX() > 0.5;
+        });
+    si.setup();
+
+    const std::size_t n = 1000;
+    std::vector<base::State *> states(n);
+    si.allocStates(states);
+
+    base::StateSamplerPtr ss = si.allocStateSampler();
+    ss->sampleUniformBatch(states.data(), n);
+    std::size_t valid = 0;
+    for (auto &state : states)
+    {
+        BOOST_CHECK(si.satisfiesBounds(state));
+        const auto *se3State = state->as<base::CompoundState>()->as<base::SE3StateSpace::StateType>(0);
+        BOOST_OMPL_EXPECT_NEAR(se3->getSubspace(1)->as<base::SO3StateSpace>()->norm(&se3State->rotation()), 1.0,
+                               1e-12);
+        if (si.isValid(state))
+            ++valid;
+    }
+    BOOST_CHECK(valid > n / 3 && valid < 2 * n / 3);
+
+    base::ValidStateSamplerPtr vs = si.allocValidStateSampler();
+    BOOST_CHECK_EQUAL(vs->sampleBatch(states.data(), n), n);
+    for (auto &state : states)
+        BOOST_CHECK(si.isValid(state));
+
+    si.freeStates(states);
+}
+
 BOOST_AUTO_TEST_CASE(Torus_Simple)
 {
     auto m(std::make_shared<base::TorusStateSpace>());
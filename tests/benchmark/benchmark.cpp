@@ -0,0 +1,132 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "Benchmark"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/tools/benchmark/Benchmark.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/planners/rrt/RRT.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <set>
+
+using namespace ompl;
+
+namespace
+{
+    geometric::SimpleSetupPtr setupProblem()
+    {
+        auto space(std::make_shared<base::RealVectorStateSpace>(2));
+        space->setBounds(0.0, 1.0);
+        auto ss(std::make_shared<geometric::SimpleSetup>(space));
+        ss->setStateValidityChecker([](const base::State *) { return true; });
+        base::ScopedState<> start(space), goal(space);
+        start[0] = start[1] = 0.1;
+        goal[0] = goal[1] = 0.9;
+        ss->setStartAndGoalStates(start, goal);
+        return ss;
+    }
+
+    tools::Benchmark::Request makeRequest(unsigned int runCount, const std::string &runLogFile)
+    {
+        tools::Benchmark::Request req(1.0, 1000.0, runCount, 0.05, false, false, false);
+        req.runLogFile = runLogFile;
+        return req;
+    }
+
+    /* The runs of planner 0 recorded in a run log, by index, checking that none is recorded twice */
+    std::set<unsigned int> loggedRuns(const std::string &runLogFile)
+    {
+        std::ifstream in(runLogFile.c_str());
+        std::set<unsigned int> runs;
+        std::string line;
+        while (std::getline(in, line))
+        {
+            std::istringstream fields(line);
+            std::string tag, name;
+            unsigned int planner, run;
+            if (!std::getline(fields, tag, '\t') || tag != "run")
+                continue;
+            fields >> planner;
+            fields.get();
+            std::getline(fields, name, '\t');
+            fields >> run;
+            BOOST_CHECK_EQUAL(planner, 0u);
+            BOOST_CHECK_EQUAL(name, "geometric_RRT");
+            BOOST_CHECK(runs.insert(run).second);
+        }
+        return runs;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ParallelRunsAndResume)
+{
+    const std::string runLogFile =
+        (boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("ompl_runs_%%%%%%.log")).string();
+
+    {
+        geometric::SimpleSetupPtr ss = setupProblem();
+        tools::Benchmark b(*ss, "parallel");
+        b.addPlanner(std::make_shared<geometric::RRT>(ss->getSpaceInformation()));
+        tools::Benchmark::Request req = makeRequest(4, runLogFile);
+        req.parallelRuns = 3;
+        b.benchmark(req);
+
+        const tools::Benchmark::CompleteExperiment &exp = b.getRecordedExperimentData();
+        BOOST_REQUIRE_EQUAL(exp.planners.size(), 1u);
+        BOOST_CHECK_EQUAL(exp.planners[0].runs.size(), 4u);
+        for (const auto &run : exp.planners[0].runs)
+            BOOST_CHECK_EQUAL(run.at("solved BOOLEAN"), "1");
+        BOOST_CHECK(loggedRuns(runLogFile) == std::set<unsigned int>({0, 1, 2, 3}));
+    }
+
+    {
+        // only the runs missing from the log are executed
+        geometric::SimpleSetupPtr ss = setupProblem();
+        tools::Benchmark b(*ss, "resumed");
+        b.addPlanner(std::make_shared<geometric::RRT>(ss->getSpaceInformation()));
+        unsigned int executed = 0;
+        b.setPreRunEvent([&executed](const base::PlannerPtr &) { ++executed; });
+        tools::Benchmark::Request req = makeRequest(6, runLogFile);
+        req.resume = true;
+        b.benchmark(req);
+
+        BOOST_CHECK_EQUAL(executed, 2u);
+        BOOST_CHECK_EQUAL(b.getRecordedExperimentData().planners[0].runs.size(), 6u);
+        BOOST_CHECK(loggedRuns(runLogFile) == std::set<unsigned int>({0, 1, 2, 3, 4, 5}));
+    }
+
+    boost::filesystem::remove(runLogFile);
+}
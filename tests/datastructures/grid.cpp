@@ -197,3 +197,83 @@ BOOST_AUTO_TEST_CASE(GridN_Simple)
     BOOST_CHECK_EQUAL((unsigned int)2, g.components().size());
     BOOST_CHECK_EQUAL(g.components()[0].size() + g.components()[1].size(), g.size());
 }
+
+BOOST_AUTO_TEST_CASE(GridN_DenseIndex)
+{
+    // the same sequence of operations on a hashed and a dense grid must give the same results,
+    // including for cells outside the range of the dense index
+    GridN<int> hashed(3);
+    GridN<int> dense(3);
+    GridN<int>::Coord low(3), high(3);
+    low << -2, 0, -1;
+    high << 3, 4, 2;
+    BOOST_CHECK(dense.setDenseBounds(low, high));
+    BOOST_CHECK(dense.hasDenseIndex());
+    BOOST_CHECK_EQUAL(hashed.hasDenseIndex(), false);
+
+    GridN<int>::Coord coord(3);
+    int data = 0;
+    for (int x = -3; x <= 4; ++x)
+        for (int y = -1; y <= 5; y += 2)
+            for (int z = -2; z <= 3; ++z)
+            {
+                if ((x + y + z) % 3 == 0)
+                    continue;
+                coord << x, y, z;
+                auto *c1 = hashed.createCell(coord);
+                auto *c2 = dense.createCell(coord);
+                c1->data = c2->data = data++;
+                hashed.add(c1);
+                dense.add(c2);
+            }
+    BOOST_CHECK_EQUAL(hashed.size(), dense.size());
+
+    // remove a few cells, both inside and outside the dense range
+    for (int x = -3; x <= 4; x += 3)
+    {
+        coord << x, 1, 0;
+        auto *c1 = hashed.getCell(coord);
+        auto *c2 = dense.getCell(coord);
+        BOOST_REQUIRE(c1 != nullptr && c2 != nullptr);
+        BOOST_CHECK(hashed.remove(c1));
+        BOOST_CHECK(dense.remove(c2));
+        hashed.destroyCell(c1);
+        dense.destroyCell(c2);
+        BOOST_CHECK_EQUAL(dense.has(coord), false);
+    }
+    BOOST_CHECK_EQUAL(hashed.size(), dense.size());
+
+    GridN<int>::CellArray n1, n2;
+    for (int x = -4; x <= 5; ++x)
+        for (int y = -2; y <= 6; ++y)
+            for (int z = -3; z <= 4; ++z)
+            {
+                coord << x, y, z;
+                auto *c1 = hashed.getCell(coord);
+                auto *c2 = dense.getCell(coord);
+                BOOST_REQUIRE_EQUAL(c1 == nullptr, c2 == nullptr);
+                if (c1)
+                {
+                    BOOST_CHECK_EQUAL(c1->data, c2->data);
+                    BOOST_CHECK_EQUAL(c1->neighbors, c2->neighbors);
+                }
+                n1.clear();
+                n2.clear();
+                hashed.neighbors(coord, n1);
+                dense.neighbors(coord, n2);
+                BOOST_REQUIRE_EQUAL(n1.size(), n2.size());
+                for (std::size_t i = 0; i < n1.size(); ++i)
+                    BOOST_CHECK_EQUAL(n1[i]->data, n2[i]->data);
+            }
+
+    dense.clear();
+    BOOST_CHECK(dense.empty());
+    coord << 0, 1, 1;
+    BOOST_CHECK_EQUAL(dense.has(coord), false);
+
+    // ranges that do not match the dimension are rejected
+    GridN<int>::Coord bad(2);
+    bad << 0, 0;
+    BOOST_CHECK_EQUAL(dense.setDenseBounds(bad, bad), false);
+    BOOST_CHECK_EQUAL(dense.hasDenseIndex(), false);
+}
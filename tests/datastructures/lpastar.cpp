@@ -0,0 +1,168 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "LPAstarOnGraph"
+#include <boost/test/unit_test.hpp>
+#include "ompl/datastructures/LPAstarOnGraph.h"
+#include "ompl/util/RandomNumbers.h"
+
+#include <boost/graph/dijkstra_shortest_paths.hpp>
+#include <limits>
+#include <list>
+#include <vector>
+
+using namespace ompl;
+
+using Graph = boost::adjacency_list<boost::vecS, boost::vecS, boost::bidirectionalS, boost::no_property,
+                                    boost::property<boost::edge_weight_t, double>>;
+
+struct ZeroHeuristic
+{
+    double operator()(std::size_t /*u*/) const
+    {
+        return 0.;
+    }
+};
+
+static double dijkstra(const Graph &graph, std::size_t source, std::size_t target)
+{
+    std::vector<double> distances(boost::num_vertices(graph));
+    boost::dijkstra_shortest_paths(
+        graph, source, boost::distance_map(distances.data()).distance_inf(std::numeric_limits<double>::infinity()));
+    return distances[target];
+}
+
+/* Check that a path returned by the search goes from source to target and has the given cost */
+static void checkPath(const Graph &graph, const std::list<std::size_t> &path, std::size_t source, std::size_t target,
+                      double cost)
+{
+    if (cost == std::numeric_limits<double>::infinity())
+    {
+        BOOST_CHECK(path.empty());
+        return;
+    }
+    BOOST_REQUIRE(!path.empty());
+    BOOST_CHECK_EQUAL(path.front(), source);
+    BOOST_CHECK_EQUAL(path.back(), target);
+    double length = 0.;
+    for (auto u = path.begin(), v = std::next(u); v != path.end(); ++u, ++v)
+    {
+        auto e = boost::edge(*u, *v, graph);
+        BOOST_REQUIRE(e.second);
+        length += boost::get(boost::edge_weight, graph, e.first);
+    }
+    BOOST_CHECK_CLOSE(length, cost, 1e-9);
+}
+
+BOOST_AUTO_TEST_CASE(Unreachable)
+{
+    Graph graph(3);
+    ZeroHeuristic h;
+    LPAstarOnGraph<Graph, ZeroHeuristic> lpa(0, 2, graph, h);
+    boost::add_edge(0, 1, 1.0, graph);
+    lpa.insertEdge(0, 1, 1.0);
+
+    // the queue runs empty without reaching the target
+    std::list<std::size_t> path;
+    BOOST_CHECK_EQUAL(lpa.computeShortestPath(path), std::numeric_limits<double>::infinity());
+    BOOST_CHECK(path.empty());
+    // nothing changed, so the queue is empty from the start
+    BOOST_CHECK_EQUAL(lpa.computeShortestPath(path), std::numeric_limits<double>::infinity());
+    BOOST_CHECK(path.empty());
+
+    boost::add_edge(1, 2, 2.0, graph);
+    lpa.insertEdge(1, 2, 2.0);
+    BOOST_CHECK_EQUAL(lpa.computeShortestPath(path), 3.0);
+    BOOST_CHECK_EQUAL(path.size(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(MatchesDijkstra)
+{
+    const std::size_t n = 40, source = 0, target = n - 1;
+    RNG rng(1);
+    Graph graph(n);
+    ZeroHeuristic h;
+    LPAstarOnGraph<Graph, ZeroHeuristic> lpa(source, target, graph, h);
+    auto weights = boost::get(boost::edge_weight, graph);
+
+    for (int step = 0; step < 600; ++step)
+    {
+        auto u = (std::size_t)rng.uniformInt(0, n - 1);
+        auto v = (std::size_t)rng.uniformInt(0, n - 1);
+        // the search only needs to be told about edges into vertices other than the source; a direct edge to
+        // the target would quickly make every other path irrelevant
+        if (u == v || v == source || (u == source && v == target))
+            continue;
+        auto e = boost::edge(u, v, graph);
+        // edges of zero cost are allowed
+        double w = rng.uniform01() < 0.1 ? 0.0 : rng.uniformReal(0.1, 1.0);
+        if (!e.second)
+        {
+            boost::add_edge(u, v, w, graph);
+            lpa.insertEdge(u, v, w);
+        }
+        else if (rng.uniform01() < 0.3)
+        {
+            boost::remove_edge(e.first, graph);
+            lpa.removeEdge(u, v);
+        }
+        else
+        {
+            // a weight change is an insertion if the weight decreases, a removal otherwise
+            double prev = weights[e.first];
+            weights[e.first] = w;
+            if (w < prev)
+                lpa.insertEdge(u, v, w);
+            else
+                lpa.removeEdge(u, v);
+        }
+
+        if (step % 10 == 0)
+        {
+            std::list<std::size_t> path;
+            double cost = lpa.computeShortestPath(path);
+            double expected = dijkstra(graph, source, target);
+            if (expected == std::numeric_limits<double>::infinity())
+                BOOST_CHECK_EQUAL(cost, expected);
+            else
+                BOOST_CHECK_CLOSE(cost, expected, 1e-9);
+            checkPath(graph, path, source, target, cost);
+
+            // without changes, the search is still valid and gives the same result
+            std::list<std::size_t> again;
+            BOOST_CHECK_EQUAL(lpa.computeShortestPath(again), cost);
+            BOOST_CHECK(again == path);
+        }
+    }
+}
@@ -0,0 +1,131 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "MotionPool"
+#include <boost/test/unit_test.hpp>
+#include "ompl/datastructures/MotionPool.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+
+#include <set>
+#include <vector>
+
+using namespace ompl;
+
+struct Motion
+{
+    base::State *state{nullptr};
+    Motion *parent{nullptr};
+};
+
+struct TreeMotion
+{
+    base::State *state{nullptr};
+    std::vector<TreeMotion *> children;
+};
+
+static base::SpaceInformationPtr makeSpaceInformation()
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(-1, 1);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    si->setup();
+    return si;
+}
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+    base::SpaceInformationPtr si = makeSpaceInformation();
+    MotionPool<Motion> pool(si, 16);
+
+    std::vector<Motion *> motions;
+    std::set<base::State *> states;
+    for (int i = 0; i < 40; ++i)
+    {
+        Motion *motion = pool.allocate();
+        BOOST_REQUIRE(motion->state != nullptr);
+        BOOST_CHECK(motion->parent == nullptr);
+        motion->parent = motions.empty() ? nullptr : motions.back();
+        motions.push_back(motion);
+        states.insert(motion->state);
+    }
+    BOOST_CHECK_EQUAL(pool.size(), 40u);
+    BOOST_CHECK_EQUAL(pool.capacity(), 48u);
+    BOOST_CHECK_EQUAL(states.size(), 40u);
+
+    // after clear(), the same memory and states are handed out again
+    pool.clear();
+    BOOST_CHECK_EQUAL(pool.size(), 0u);
+    for (int i = 0; i < 40; ++i)
+    {
+        Motion *motion = pool.allocate();
+        BOOST_CHECK_EQUAL(motion, motions[i]);
+        BOOST_CHECK(motion->parent == nullptr);
+        BOOST_CHECK(states.count(motion->state) == 1);
+    }
+    BOOST_CHECK_EQUAL(pool.capacity(), 48u);
+
+    // a freed motion's slot is reused first
+    Motion *freed = motions[7];
+    base::State *state = freed->state;
+    pool.free(freed);
+    BOOST_CHECK_EQUAL(pool.size(), 39u);
+    Motion *motion = pool.allocate();
+    BOOST_CHECK_EQUAL(motion, freed);
+    BOOST_CHECK_EQUAL(motion->state, state);
+
+    // a state allocated elsewhere is adopted by the pool
+    base::State *adopted = si->allocState();
+    motion = pool.allocate(adopted);
+    BOOST_CHECK_EQUAL(motion->state, adopted);
+    BOOST_CHECK_EQUAL(pool.size(), 41u);
+}
+
+BOOST_AUTO_TEST_CASE(NonTrivialMotions)
+{
+    MotionPool<TreeMotion> pool(makeSpaceInformation(), 4);
+
+    TreeMotion *root = pool.allocate();
+    for (int i = 0; i < 10; ++i)
+    {
+        TreeMotion *child = pool.allocate();
+        root->children.push_back(child);
+    }
+    pool.free(root->children.back());
+    root->children.pop_back();
+    BOOST_CHECK_EQUAL(pool.size(), 10u);
+
+    pool.clear();
+    root = pool.allocate();
+    BOOST_CHECK(root->children.empty());
+}
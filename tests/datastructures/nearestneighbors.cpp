@@ -38,6 +38,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <sstream>
 #include <unordered_set>
 
 #include "ompl/config.h"
@@ -316,3 +317,49 @@ NN_TEST_CASES(GNATNoThreadSafetys, false)
 NN_TEST_CASES(FLANNLinear, false)
 NN_TEST_CASES(FLANNHierarchicalClustering, true)
 #endif
+
+BOOST_AUTO_TEST_CASE(GNATSaveLoadStructure)
+{
+    base::SE3StateSpace &space = nnConfig.space1;
+    std::vector<base::State *> states(n);
+    base::StateSamplerPtr sampler = space.allocStateSampler();
+    for (auto &state : states)
+    {
+        state = space.allocState();
+        sampler->sampleUniform(state);
+    }
+    auto distFun = [&space](base::State *a, base::State *b) { return space.distance(a, b); };
+
+    NearestNeighborsGNATs<base::State *> original, restored;
+    original.setDistanceFunction(distFun);
+    restored.setDistanceFunction(distFun);
+    original.add(states);
+
+    std::vector<base::State *> elements;
+    original.list(elements);
+    std::stringstream buffer;
+    BOOST_CHECK(original.saveStructure(buffer, [&elements](base::State *s)
+                                       { return std::find(elements.begin(), elements.end(), s) - elements.begin(); }));
+    BOOST_CHECK(restored.loadStructure(buffer, elements));
+    BOOST_CHECK_EQUAL(restored.size(), elements.size());
+
+    // the restored tree answers queries exactly like the original one
+    base::State *query = space.allocState();
+    std::vector<base::State *> nbh0, nbh1;
+    for (int i = 0; i < 20; ++i)
+    {
+        sampler->sampleUniform(query);
+        original.nearestK(query, k, nbh0);
+        restored.nearestK(query, k, nbh1);
+        BOOST_CHECK(nbh0 == nbh1);
+    }
+
+    // a truncated structure is rejected
+    std::stringstream truncated(buffer.str().substr(0, buffer.str().size() / 2));
+    BOOST_CHECK(!restored.loadStructure(truncated, elements));
+    BOOST_CHECK_EQUAL(restored.size(), 0u);
+
+    space.freeState(query);
+    for (auto &state : states)
+        space.freeState(state);
+}
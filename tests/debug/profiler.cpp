@@ -0,0 +1,128 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "Profiler"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/tools/debug/Profiler.h"
+#include <atomic>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if !ENABLE_PROFILING
+#error "This test needs to be built with ENABLE_PROFILING set to 1"
+#endif
+
+using namespace ompl;
+
+/* Count the entries of a Chrome trace, written one per line, with the name \e name and the phase \e phase */
+static unsigned int countTraceEntries(const std::string &trace, const std::string &name, const std::string &phase)
+{
+    BOOST_CHECK_EQUAL(trace.find("{\"traceEvents\":["), 0u);
+    BOOST_CHECK(trace.find("\n],\"displayTimeUnit\":\"ns\"}") != std::string::npos);
+    std::stringstream lines(trace);
+    std::string line;
+    unsigned int count = 0;
+    while (std::getline(lines, line))
+        if (line.find("{\"name\":\"" + name + "\"") == 0 && line.find("\"ph\":\"" + phase + "\"") != std::string::npos)
+            ++count;
+    return count;
+}
+
+BOOST_AUTO_TEST_CASE(CountsAndTrace)
+{
+    tools::Profiler prof;
+    std::atomic<unsigned int> done{0};
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < 4; ++i)
+        threads.emplace_back([&prof, &done]
+                             {
+                                 for (unsigned int j = 0; j < 10; ++j)
+                                 {
+                                     tools::Profiler::ScopedBlock block("test block", prof);
+                                     prof.event("test event", 2);
+                                     prof.average("test average", j);
+                                 }
+                                 // keep the threads alive together, so none reuses the memory of another
+                                 ++done;
+                                 while (done < 4)
+                                     std::this_thread::yield();
+                             });
+    for (auto &thread : threads)
+        thread.join();
+
+    std::stringstream status;
+    prof.status(status);
+    BOOST_CHECK(status.str().find("test event: 80\n") != std::string::npos);
+    BOOST_CHECK(status.str().find("test average: 4.5 ") != std::string::npos);
+    BOOST_CHECK(status.str().find(" 40 parts") != std::string::npos);
+
+    std::stringstream json;
+    prof.exportTrace(json);
+    std::string trace = json.str();
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "test block", "X"), 40u);
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "test event", "i"), 40u);
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "thread_name", "M"), 4u);
+
+    // cleared data is neither printed nor exported
+    prof.clear();
+    prof.event("test event");
+    json.str("");
+    prof.exportTrace(json);
+    trace = json.str();
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "test block", "X"), 0u);
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "test event", "i"), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ReuseMemoryOfExitedThreads)
+{
+    tools::Profiler prof;
+    for (unsigned int i = 0; i < 20; ++i)
+    {
+        std::thread thread([&prof] { prof.event("test event"); });
+        thread.join();
+    }
+
+    // the threads ran one after the other, so they all recorded to the same memory
+    std::stringstream json;
+    prof.exportTrace(json);
+    std::string trace = json.str();
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "thread_name", "M"), 1u);
+    BOOST_CHECK_EQUAL(countTraceEntries(trace, "test event", "i"), 20u);
+
+    std::stringstream status;
+    prof.status(status);
+    BOOST_CHECK(status.str().find("test event: 20\n") != std::string::npos);
+}
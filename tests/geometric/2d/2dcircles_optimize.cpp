@@ -51,7 +51,9 @@ OMPL_POP_CLANG
 #include "ompl/geometric/planners/informedtrees/BITstar.h"
 #include "ompl/geometric/planners/cforest/CForest.h"
 #include "ompl/geometric/planners/prm/PRMstar.h"
+#include "ompl/geometric/planners/rrt/LazyLBTRRT.h"
 #include "ompl/geometric/planners/rrt/RRTstar.h"
+#include "ompl/geometric/planners/rrt/TypedRRTstar.h"
 #include "ompl/util/RandomNumbers.h"
 
 #include "../../base/PlannerTest.h"
@@ -301,6 +303,17 @@ protected:
     }
 };
 
+class TypedRRTstarTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) const override
+    {
+        using Checker = geometric::StateValidityChecker2DCircles;
+        return std::make_shared<geometric::TypedRRTstar<base::RealVectorStateSpace, Checker>>(si);
+    }
+};
+
 class PRMstarTest : public TestPlanner
 {
 protected:
@@ -422,5 +435,46 @@ OMPL_PLANNER_TEST(CForest)
 OMPL_PLANNER_TEST(PRM)
 OMPL_PLANNER_TEST(PRMstar)
 OMPL_PLANNER_TEST(RRTstar)
+OMPL_PLANNER_TEST(TypedRRTstar)
+
+// LazyLBTRRT plans until it is told to stop and ignores cost thresholds, so it gets its own test. Calling solve()
+// again extracts the path from a search that is already up to date.
+BOOST_AUTO_TEST_CASE(geometric_LazyLBTRRT)
+{
+    base::SpaceInformationPtr si = geometric::spaceInformation2DCircles(circles_);
+    auto pdef(std::make_shared<base::ProblemDefinition>(si));
+    auto planner(std::make_shared<geometric::LazyLBTRRT>(si));
+    planner->setProblemDefinition(pdef);
+    planner->setup();
+
+    base::ScopedState<> start(si);
+    base::ScopedState<> goal(si);
+    std::size_t nt = std::min<std::size_t>(3, circles_.getQueryCount());
+    for (std::size_t i = 0 ; i < nt ; ++i)
+    {
+        const Circles2D::Query &q = circles_.getQuery(i);
+        start[0] = q.startX_;
+        start[1] = q.startY_;
+        goal[0] = q.goalX_;
+        goal[1] = q.goalY_;
+        pdef->setStartAndGoalStates(start, goal, 1e-3);
+        planner->clear();
+
+        for (int j = 0 ; j < 3 ; ++j)
+        {
+            pdef->clearSolutionPaths();
+            BOOST_REQUIRE(planner->solve(base::timedPlannerTerminationCondition(0.3)) ==
+                          base::PlannerStatus::EXACT_SOLUTION);
+
+            auto *path = static_cast<geometric::PathGeometric*>(pdef->getSolutionPath().get());
+            BOOST_REQUIRE(path->getStateCount() >= 2);
+            BOOST_CHECK(path->check());
+            BOOST_CHECK_LT(si->distance(path->getState(0), start.get()), 1e-9);
+            BOOST_CHECK(pdef->getGoal()->isSatisfied(path->getState(path->getStateCount() - 1)));
+        }
+    }
+    planner->clear();
+    planner->clear();
+}
 
 BOOST_AUTO_TEST_SUITE_END()
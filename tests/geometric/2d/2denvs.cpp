@@ -50,6 +50,7 @@ OMPL_POP_CLANG
 #include "ompl/geometric/planners/kpiece/LBKPIECE1.h"
 #include "ompl/geometric/planners/kpiece/BKPIECE1.h"
 #include "ompl/geometric/planners/kpiece/KPIECE1.h"
+#include "ompl/geometric/planners/kpiece/pKPIECE1.h"
 #include "ompl/geometric/planners/sbl/SBL.h"
 #include "ompl/geometric/planners/sbl/pSBL.h"
 #include "ompl/geometric/planners/rrt/RRT.h"
@@ -57,6 +58,8 @@ OMPL_POP_CLANG
 #include "ompl/geometric/planners/rrt/pRRT.h"
 #include "ompl/geometric/planners/rrt/TRRT.h"
 #include "ompl/geometric/planners/rrt/LazyRRT.h"
+#include "ompl/geometric/planners/rrt/TypedRRT.h"
+#include "ompl/geometric/planners/rrt/TypedRRTConnect.h"
 #include "ompl/geometric/planners/pdst/PDST.h"
 #include "ompl/geometric/planners/est/EST.h"
 #include "ompl/geometric/planners/est/BiEST.h"
@@ -68,6 +71,7 @@ OMPL_POP_CLANG
 #include "ompl/geometric/planners/prm/LazyPRMstar.h"
 #include "ompl/geometric/planners/prm/SPARS.h"
 #include "ompl/geometric/planners/prm/SPARStwo.h"
+#include "ompl/geometric/planners/prm/TypedPRM.h"
 #include "ompl/base/objectives/PathLengthOptimizationObjective.h"
 
 #include "../../base/PlannerTest.h"
@@ -371,6 +375,27 @@ protected:
     }
 };
 
+class pKPIECE1Test : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        auto kpiece(std::make_shared<geometric::pKPIECE1>(si));
+        kpiece->setRange(10.0);
+        kpiece->setThreadCount(std::min(4u, std::thread::hardware_concurrency()));
+
+        std::vector<unsigned int> projection = {0, 1};
+        std::vector<double> cdim = {1, 1};
+
+        kpiece->setProjectionEvaluator(
+            std::make_shared<base::RealVectorOrthogonalProjectionEvaluator>(
+                si->getStateSpace(), cdim, projection));
+
+        return kpiece;
+    }
+};
+
 class LBKPIECE1Test : public TestPlanner
 {
 protected:
@@ -560,6 +585,49 @@ protected:
     }
 };
 
+/* instantiate a typed planner for the space and validity checker of the environment being tested */
+template <template <typename, typename> class PlannerType>
+std::shared_ptr<base::Planner> newTypedPlanner(const base::SpaceInformationPtr &si)
+{
+    if (dynamic_cast<const geometric::StateValidityChecker2DCircles *>(si->getStateValidityChecker().get()) != nullptr)
+        return std::make_shared<PlannerType<base::RealVectorStateSpace, geometric::StateValidityChecker2DCircles>>(si);
+    return std::make_shared<PlannerType<geometric::StateSpace2DMap, geometric::StateValidityChecker2DMap>>(si);
+}
+
+class TypedRRTTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        base::PlannerPtr rrt = newTypedPlanner<geometric::TypedRRT>(si);
+        static_cast<geometric::RRT *>(rrt.get())->setRange(10.0);
+        return rrt;
+    }
+};
+
+class TypedRRTConnectTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        base::PlannerPtr rrt = newTypedPlanner<geometric::TypedRRTConnect>(si);
+        static_cast<geometric::RRTConnect *>(rrt.get())->setRange(10.0);
+        return rrt;
+    }
+};
+
+class TypedPRMTest : public TestPlanner
+{
+protected:
+
+    base::PlannerPtr newPlanner(const base::SpaceInformationPtr &si) override
+    {
+        return newTypedPlanner<geometric::TypedPRM>(si);
+    }
+};
+
 class PlanTest
 {
 public:
@@ -738,6 +806,8 @@ BOOST_FIXTURE_TEST_SUITE(MyPlanTestFixture, PlanTest)
 
 OMPL_PLANNER_TEST(RRT, 95.0, 0.01)
 OMPL_PLANNER_TEST(RRTConnect, 95.0, 0.01)
+OMPL_PLANNER_TEST(TypedRRT, 95.0, 0.01)
+OMPL_PLANNER_TEST(TypedRRTConnect, 95.0, 0.01)
 OMPL_PLANNER_TEST(pRRT, 95.0, 0.02)
 
 // LazyRRT is a not so great, so we use more relaxed bounds
@@ -751,6 +821,7 @@ OMPL_PLANNER_TEST(PDST, 95.0, 0.03)
 OMPL_PLANNER_TEST(SBL, 95.0, 0.02)
 
 OMPL_PLANNER_TEST(KPIECE1, 95.0, 0.01)
+OMPL_PLANNER_TEST(pKPIECE1, 95.0, 0.02)
 OMPL_PLANNER_TEST(LBKPIECE1, 95.0, 0.02)
 OMPL_PLANNER_TEST(BKPIECE1, 95.0, 0.01)
 
@@ -759,9 +830,19 @@ OMPL_PLANNER_TEST(STRIDE, 95.0, 0.02)
 
 OMPL_PLANNER_TEST(PRM, 95.0, 0.04)
 OMPL_PLANNER_TEST(PRMstar, 95.0, 0.04)
+OMPL_PLANNER_TEST(TypedPRM, 95.0, 0.04)
 //OMPL_PLANNER_TEST(LazyPRM, 98.0, 0.04)
 OMPL_PLANNER_TEST(LazyPRMstar, 95.0, 0.04)
 OMPL_PLANNER_TEST(SPARS, 95.0, 0.04)
 OMPL_PLANNER_TEST(SPARStwo, 95.0, 0.04)
 
+BOOST_AUTO_TEST_CASE(geometric_TypedPlannerDerivedSpace)
+{
+    // StateSpace2DMap derives from RealVectorStateSpace, but the typed planners only accept the exact type
+    geometric::SimpleSetup2DMap s(env_);
+    s.setPlanner(std::make_shared<geometric::TypedRRT<base::RealVectorStateSpace, geometric::StateValidityChecker2DMap>>(
+        s.getSpaceInformation()));
+    BOOST_CHECK_THROW(s.setup(), Exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -37,9 +37,13 @@
 #define BOOST_TEST_MODULE "ConstrainedPlanning"
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <fstream>
+#include <sstream>
+#include <thread>
 
 #include <ompl/base/Constraint.h>
+#include <ompl/base/AutoDiffConstraint.h>
 #include <ompl/base/ConstrainedSpaceInformation.h>
 #include <ompl/base/spaces/constraint/ConstrainedStateSpace.h>
 #include <ompl/base/spaces/constraint/AtlasStateSpace.h>
@@ -406,6 +410,228 @@ protected:
     }
 };
 
+class FixedSizeSphere : public ob::FixedSizeConstraint<3, 1>
+{
+public:
+    void function(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> out) const override
+    {
+        out[0] = x.norm() - 1;
+    }
+
+    void jacobian(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::MatrixXd> out) const override
+    {
+        out = x.transpose().normalized();
+    }
+};
+
+template <int AmbientDim, int CoDim>
+class AutoDiffSphere : public ob::AutoDiffConstraint<AutoDiffSphere<AmbientDim, CoDim>, AmbientDim, CoDim>
+{
+public:
+    AutoDiffSphere() : ob::AutoDiffConstraint<AutoDiffSphere<AmbientDim, CoDim>, AmbientDim, CoDim>(3, 1)
+    {
+    }
+
+    template <typename Scalar>
+    void evaluate(const Eigen::Ref<const Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> &x,
+                  Eigen::Ref<Eigen::Matrix<Scalar, Eigen::Dynamic, 1>> out) const
+    {
+        out[0] = x.norm() - 1;
+    }
+};
+
+BOOST_AUTO_TEST_CASE(AutoDiffJacobian)
+{
+    Sphere sphere;
+    AutoDiffSphere<3, 1> fixedSphere;
+    AutoDiffSphere<Eigen::Dynamic, Eigen::Dynamic> dynamicSphere;
+    Eigen::VectorXd x(3), f(1), g(1);
+    Eigen::MatrixXd expected(1, 3), j(1, 3);
+    for (int i = 0; i < 100; ++i)
+    {
+        x.setRandom();
+        sphere.function(x, f);
+        sphere.jacobian(x, expected);
+        for (ob::Constraint *constraint : std::initializer_list<ob::Constraint *>{&fixedSphere, &dynamicSphere})
+        {
+            constraint->function(x, g);
+            BOOST_CHECK_SMALL(f[0] - g[0], 1e-12);
+            constraint->jacobian(x, j);
+            BOOST_CHECK_SMALL((expected - j).norm(), 1e-12);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ProjectionSolvers)
+{
+    Sphere sphere;
+    FixedSizeSphere fixedSphere;
+    for (ob::Constraint *constraint : std::initializer_list<ob::Constraint *>{&sphere, &fixedSphere})
+        for (auto solver : {ob::Constraint::PROJECTION_SVD, ob::Constraint::PROJECTION_QR,
+                            ob::Constraint::PROJECTION_LDLT, ob::Constraint::PROJECTION_DAMPED_LEAST_SQUARES})
+            for (unsigned int interval : {1u, 3u})
+            {
+                constraint->setProjectionSolver(solver);
+                constraint->setJacobianUpdateInterval(interval);
+                Eigen::VectorXd x(3);
+                for (int i = 0; i < 100; ++i)
+                {
+                    x.setRandom();
+                    x *= 2.0;
+                    BOOST_REQUIRE(constraint->project(x));
+                    BOOST_CHECK(constraint->isSatisfied(x));
+                    BOOST_CHECK_SMALL(x.norm() - 1.0, constraint->getTolerance());
+                }
+            }
+}
+
+/* The sphere constraint stated twice, so the Jacobian never has full row rank */
+class DoubledSphere : public ob::Constraint
+{
+public:
+    DoubledSphere() : ob::Constraint(3, 2)
+    {
+    }
+
+    void function(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::VectorXd> out) const override
+    {
+        out[0] = x.norm() - 1;
+        out[1] = 2 * out[0];
+    }
+
+    void jacobian(const Eigen::Ref<const Eigen::VectorXd> &x, Eigen::Ref<Eigen::MatrixXd> out) const override
+    {
+        out.row(0) = x.transpose().normalized();
+        out.row(1) = 2 * out.row(0);
+    }
+};
+
+BOOST_AUTO_TEST_CASE(SingularJacobian)
+{
+    // the LDLT solver falls back to the SVD, for which the rank does not matter
+    DoubledSphere sphere;
+    for (auto solver : {ob::Constraint::PROJECTION_SVD, ob::Constraint::PROJECTION_LDLT})
+    {
+        sphere.setProjectionSolver(solver);
+        Eigen::VectorXd x(3);
+        for (int i = 0; i < 100; ++i)
+        {
+            x.setRandom();
+            x *= 2.0;
+            BOOST_REQUIRE(sphere.project(x));
+            BOOST_CHECK_SMALL(x.norm() - 1.0, sphere.getTolerance());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AtlasWarmStart)
+{
+    auto space(std::make_shared<ob::RealVectorStateSpace>(3));
+    ob::RealVectorBounds bounds(3);
+    bounds.setLow(-2);
+    bounds.setHigh(2);
+    space->setBounds(bounds);
+
+    auto atlas(std::make_shared<ob::AtlasStateSpace>(space, std::make_shared<Sphere>()));
+    auto csi(std::make_shared<ob::ConstrainedSpaceInformation>(atlas));
+    atlas->setup();
+
+    ob::ScopedState<> start(atlas);
+    Eigen::VectorXd pole(3);
+    pole << 0, 0, -1;
+    start->as<ob::ConstrainedStateSpace::StateType>()->copy(pole);
+    atlas->anchorChart(start.get());
+
+    // Grow the atlas from several threads at once.
+    std::atomic<unsigned int> offManifold{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&atlas, &offManifold] {
+            ob::StateSamplerPtr sampler = atlas->allocStateSampler();
+            ob::State *state = atlas->allocState();
+            ob::State *goal = atlas->allocState();
+            for (int i = 0; i < 100; ++i)
+            {
+                sampler->sampleUniform(state);
+                if (!atlas->getConstraint()->isSatisfied(state))
+                    ++offManifold;
+
+                // Traversing toward random points creates new charts.
+                auto &&x = *goal->as<ob::ConstrainedStateSpace::StateType>();
+                x.setRandom();
+                x.normalize();
+                atlas->discreteGeodesic(state, goal, true);
+            }
+            atlas->freeState(state);
+            atlas->freeState(goal);
+        });
+    for (auto &thread : threads)
+        thread.join();
+    BOOST_CHECK_EQUAL(offManifold, 0u);
+    const std::size_t saved = atlas->getChartCount();
+    BOOST_REQUIRE_GT(saved, 1u);
+
+    std::stringstream charts;
+    atlas->saveCharts(charts);
+
+    auto warm(std::make_shared<ob::AtlasStateSpace>(space, std::make_shared<Sphere>()));
+    auto warmSi(std::make_shared<ob::ConstrainedSpaceInformation>(warm));
+    warm->setup();
+    const std::size_t loaded = warm->loadCharts(charts);
+    BOOST_CHECK_GT(2 * loaded, saved);
+    BOOST_CHECK_EQUAL(warm->getChartCount(), loaded);
+
+    // Loaded charts are anchored, so they survive clear().
+    warm->clear();
+    BOOST_CHECK_EQUAL(warm->getChartCount(), loaded);
+}
+
+BOOST_AUTO_TEST_CASE(GeodesicCache)
+{
+    auto space(std::make_shared<ob::RealVectorStateSpace>(3));
+    ob::RealVectorBounds bounds(3);
+    bounds.setLow(-2);
+    bounds.setHigh(2);
+    space->setBounds(bounds);
+
+    auto css(std::make_shared<ob::ProjectedStateSpace>(space, std::make_shared<Sphere>()));
+    auto csi(std::make_shared<ob::ConstrainedSpaceInformation>(css));
+    csi->setStateValidityChecker(isValid);
+    csi->setup();
+
+    ob::StateSamplerPtr sampler = css->allocStateSampler();
+    ob::State *from = css->allocState();
+    ob::State *to = css->allocState();
+    ob::State *mid = css->allocState();
+    for (int i = 0; i < 50; ++i)
+    {
+        do
+            sampler->sampleUniform(from);
+        while (!csi->isValid(from));
+        sampler->sampleUniformNear(to, from, 0.5);
+
+        // Interpolation, motion checking and motion states share one traversal.
+        css->interpolate(from, to, 0.5, mid);
+        auto geodesic = css->getGeodesic(from, to, true);
+        BOOST_CHECK(css->getGeodesic(from, to, true) == geodesic);
+
+        std::vector<ob::State *> uncached;
+        const bool reached = css->discreteGeodesic(from, to, false, &uncached);
+        const bool valid = csi->checkMotion(from, to);
+        BOOST_CHECK_EQUAL(valid, reached && css->getConstraint()->isSatisfied(to));
+        BOOST_CHECK_EQUAL(css->getGeodesic(from, to, false)->states.size(), uncached.size());
+        for (auto s : uncached)
+            css->freeState(s);
+    }
+
+    css->setGeodesicCacheSize(0);
+    BOOST_CHECK(css->getGeodesic(from, to, true) != css->getGeodesic(from, to, true));
+
+    css->freeState(from);
+    css->freeState(to);
+    css->freeState(mid);
+}
+
 BOOST_FIXTURE_TEST_SUITE(MyPlanTestFixture, PlanTest)
 
 #ifndef MACHINE_SPEED_FACTOR
@@ -0,0 +1,210 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "Lightning"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/tools/lightning/DynamicTimeWarp.h"
+#include "ompl/tools/lightning/LightningDB.h"
+#include "ompl/geometric/planners/experience/LightningRetrieveRepair.h"
+#include "ompl/geometric/planners/rrt/RRTConnect.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/base/ScopedState.h"
+#include "ompl/util/RandomNumbers.h"
+#include <atomic>
+#include <limits>
+#include <vector>
+
+using namespace ompl;
+
+namespace
+{
+    struct DTWFixture
+    {
+        DTWFixture()
+          : space(std::make_shared<base::RealVectorStateSpace>(2)), si(std::make_shared<base::SpaceInformation>(space))
+        {
+            space->as<base::RealVectorStateSpace>()->setBounds(0.0, 1.0);
+            si->setup();
+        }
+
+        geometric::PathGeometric randomPath(std::size_t count)
+        {
+            geometric::PathGeometric path(si);
+            base::ScopedState<> s(space);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                s.random();
+                path.append(s.get());
+            }
+            return path;
+        }
+
+        /* The DTW distance computed with the full cost table */
+        double fullDTWDistance(const geometric::PathGeometric &path1, const geometric::PathGeometric &path2) const
+        {
+            std::size_t n = path1.getStateCount();
+            std::size_t m = path2.getStateCount();
+            std::vector<std::vector<double>> table(n + 1,
+                                                   std::vector<double>(m + 1, std::numeric_limits<double>::infinity()));
+            table[0][0] = 0.;
+            for (std::size_t i = 1; i <= n; ++i)
+                for (std::size_t j = 1; j <= m; ++j)
+                    table[i][j] = si->distance(path1.getState(i - 1), path2.getState(j - 1)) +
+                                  std::min(table[i - 1][j], std::min(table[i][j - 1], table[i - 1][j - 1]));
+            return table[n][m];
+        }
+
+        base::StateSpacePtr space;
+        base::SpaceInformationPtr si;
+        RNG rng{1};
+    };
+}
+
+BOOST_FIXTURE_TEST_CASE(DTWBand, DTWFixture)
+{
+    tools::DynamicTimeWarp dtw(si);
+    for (int k = 0; k < 20; ++k)
+    {
+        geometric::PathGeometric path1 = randomPath(rng.uniformInt(1, 30));
+        geometric::PathGeometric path2 = randomPath(rng.uniformInt(1, 30));
+        double full = fullDTWDistance(path1, path2);
+
+        // without a band the result is the one of the full table
+        dtw.setBandWidth(1.0);
+        BOOST_CHECK_CLOSE(dtw.calcDTWDistance(path1, path2), full, 1e-9);
+
+        // a band restricts the warping paths, but some path is always left
+        for (double fraction : {0.0, 0.1, 0.3})
+        {
+            dtw.setBandWidth(fraction);
+            double banded = dtw.calcDTWDistance(path1, path2);
+            BOOST_CHECK(banded < std::numeric_limits<double>::infinity());
+            BOOST_CHECK_GE(banded, full - 1e-9);
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(DTWEarlyAbandonAndLowerBound, DTWFixture)
+{
+    tools::DynamicTimeWarp dtw(si);
+    for (int k = 0; k < 20; ++k)
+    {
+        geometric::PathGeometric path1 = randomPath(rng.uniformInt(1, 30));
+        geometric::PathGeometric path2 = randomPath(rng.uniformInt(1, 30));
+        double full = fullDTWDistance(path1, path2);
+
+        BOOST_CHECK_LE(dtw.lowerBound(path1, path2), full + 1e-9);
+
+        // a bound above the distance does not change it; below it, the result is at least the bound
+        BOOST_CHECK_CLOSE(dtw.calcDTWDistance(path1, path2, full * 1.01 + 1e-9), full, 1e-9);
+        double bound = full * 0.5;
+        BOOST_CHECK_GE(dtw.calcDTWDistance(path1, path2, bound), bound);
+    }
+
+    // paths that differ in their first states are rejected by the lower bound
+    geometric::PathGeometric path1 = randomPath(10);
+    geometric::PathGeometric path2 = path1;
+    base::ScopedState<> s(space);
+    s[0] = path1.getState(0)->as<base::RealVectorStateSpace::StateType>()->values[0] < 0.5 ? 1.0 : 0.0;
+    s[1] = path1.getState(0)->as<base::RealVectorStateSpace::StateType>()->values[1];
+    si->copyState(path2.getState(0), s.get());
+    BOOST_CHECK_EQUAL(dtw.getPathsScore(path1, path1, 1e-4), 0.0);
+    BOOST_CHECK_EQUAL(dtw.getPathsScore(path1, path2, 1e-4), std::numeric_limits<double>::infinity());
+}
+
+BOOST_AUTO_TEST_CASE(ParallelRepair)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    // a wall across the middle of the space, with a gap at the top
+    bool wall = false;
+    si->setStateValidityChecker([&wall](const base::State *state)
+                                {
+                                    const auto *s = state->as<base::RealVectorStateSpace::StateType>();
+                                    return !wall || std::abs(s->values[0] - 0.5) > 0.05 || s->values[1] > 0.8;
+                                });
+    si->setup();
+
+    // paths straight across the space, which the wall blocks
+    auto db(std::make_shared<tools::LightningDB>(space));
+    base::ScopedState<> s(space);
+    for (int i = 0; i < 5; ++i)
+    {
+        geometric::PathGeometric path(si);
+        for (double x : {0.1, 0.5, 0.9})
+        {
+            s[0] = x;
+            s[1] = 0.1 + 0.02 * i;
+            path.append(s.get());
+        }
+        double insertionTime;
+        db->addPath(path, insertionTime);
+    }
+    wall = true;
+
+    auto pdef(std::make_shared<base::ProblemDefinition>(si));
+    base::ScopedState<> start(space), goal(space);
+    start[0] = 0.1;
+    goal[0] = 0.9;
+    start[1] = goal[1] = 0.15;
+    pdef->setStartAndGoalStates(start, goal);
+
+    auto planner(std::make_shared<geometric::LightningRetrieveRepair>(si, db));
+    std::atomic<unsigned int> allocated{0};
+    planner->setRepairPlannerAllocator([&allocated](const base::SpaceInformationPtr &si)
+                                       {
+                                           ++allocated;
+                                           return std::make_shared<geometric::RRTConnect>(si);
+                                       });
+    planner->setNumParallelRepairs(3);
+    planner->setProblemDefinition(pdef);
+    planner->setup();
+    // one repair uses the repair planner, the others use planners of their own
+    BOOST_CHECK_EQUAL(allocated.load(), 2u);
+
+    BOOST_REQUIRE(planner->solve(base::timedPlannerTerminationCondition(10.0)) == base::PlannerStatus::EXACT_SOLUTION);
+    BOOST_CHECK_LT(planner->getLastRecalledNearestPathChosen(), 5u);
+    auto path = std::static_pointer_cast<geometric::PathGeometric>(pdef->getSolutionPath());
+    BOOST_CHECK(path->check());
+    BOOST_CHECK_LT(si->distance(path->getState(0), start.get()), 1e-9);
+    BOOST_CHECK_LT(si->distance(path->getState(path->getStateCount() - 1), goal.get()), 1e-9);
+
+    // the planners are reused by the next query
+    pdef->clearSolutionPaths();
+    planner->clear();
+    BOOST_CHECK(planner->solve(base::timedPlannerTerminationCondition(10.0)) == base::PlannerStatus::EXACT_SOLUTION);
+    BOOST_CHECK_EQUAL(allocated.load(), 2u);
+}
@@ -0,0 +1,174 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "ThunderDB"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/tools/thunder/ThunderDB.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/base/ScopedState.h"
+#include <atomic>
+#include <thread>
+
+using namespace ompl;
+
+namespace
+{
+    /* A state validity checker that can be called from several threads, with an obstacle in the middle of
+       [0,1]^2 that can be put in place */
+    class BlockableValidityChecker : public base::StateValidityChecker
+    {
+    public:
+        BlockableValidityChecker(const base::SpaceInformationPtr &si) : base::StateValidityChecker(si)
+        {
+        }
+
+        bool isValid(const base::State *state) const override
+        {
+            const auto *s = state->as<base::RealVectorStateSpace::StateType>();
+            return !blocked || std::abs(s->values[0] - 0.5) > 0.1 || std::abs(s->values[1] - 0.5) > 0.1;
+        }
+
+        std::atomic<bool> blocked{false};
+    };
+
+    struct ThunderDBFixture
+    {
+        ThunderDBFixture()
+          : space(std::make_shared<base::RealVectorStateSpace>(2))
+          , si(std::make_shared<base::SpaceInformation>(space))
+          , checker(std::make_shared<BlockableValidityChecker>(si))
+          , pdef(std::make_shared<base::ProblemDefinition>(si))
+          , start(space)
+          , goal(space)
+        {
+            space->as<base::RealVectorStateSpace>()->setBounds(0.0, 1.0);
+            si->setStateValidityChecker(checker);
+            si->setup();
+            start[0] = start[1] = 0.1;
+            goal[0] = goal[1] = 0.9;
+            pdef->setStartAndGoalStates(start, goal);
+
+            spars = std::make_shared<geometric::SPARSdb>(si);
+            spars->setProblemDefinition(pdef);
+            spars->setup();
+            db = std::make_shared<tools::ThunderDB>(space);
+            db->setSPARSdb(spars);
+            db->setSavingEnabled(true);
+        }
+
+        ~ThunderDBFixture()
+        {
+            // the database warns about unsaved paths otherwise
+            db->setSavingEnabled(false);
+        }
+
+        geometric::PathGeometric path(double offset) const
+        {
+            geometric::PathGeometric p(si);
+            base::ScopedState<> s(space);
+            for (double t : {0.1, 0.9})
+            {
+                s[0] = t + offset;
+                s[1] = t - offset;
+                p.append(s.get());
+            }
+            return p;
+        }
+
+        bool query(tools::SPARSdbPtr roadmap = tools::SPARSdbPtr())
+        {
+            geometric::SPARSdb::CandidateSolution solution;
+            base::PlannerTerminationCondition ptc = base::timedPlannerTerminationCondition(10.0);
+            if (roadmap)
+                return roadmap->getSimilarPaths(1, start.get(), goal.get(), solution, ptc);
+            return db->findNearestStartGoal(1, start.get(), goal.get(), solution, ptc);
+        }
+
+        base::StateSpacePtr space;
+        base::SpaceInformationPtr si;
+        std::shared_ptr<BlockableValidityChecker> checker;
+        base::ProblemDefinitionPtr pdef;
+        base::ScopedState<> start, goal;
+        tools::SPARSdbPtr spars;
+        tools::ThunderDBPtr db;
+    };
+}
+
+BOOST_FIXTURE_TEST_CASE(QueryWhileInserting, ThunderDBFixture)
+{
+    geometric::PathGeometric first = path(0.0);
+    double insertionTime;
+    BOOST_REQUIRE(db->addPath(first, insertionTime));
+    BOOST_REQUIRE(query());
+
+    // queries keep succeeding on copies of the roadmap while paths are inserted
+    for (int i = 1; i <= 5; ++i)
+        BOOST_CHECK(db->addPathAsync(path(0.01 * i)));
+    std::atomic<unsigned int> failed{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i)
+        threads.emplace_back([this, &failed] {
+            for (int j = 0; j < 5; ++j)
+                if (!query())
+                    ++failed;
+        });
+    for (auto &thread : threads)
+        thread.join();
+    db->waitForInsertions();
+    BOOST_CHECK_EQUAL(failed, 0u);
+    BOOST_CHECK(query());
+}
+
+BOOST_FIXTURE_TEST_CASE(CollisionStatesReachTheRoadmap, ThunderDBFixture)
+{
+    geometric::PathGeometric first = path(0.0);
+    double insertionTime;
+    BOOST_REQUIRE(db->addPath(first, insertionTime));
+    BOOST_REQUIRE(db->addPathAsync(path(0.0)));
+    db->waitForInsertions();
+
+    // a query on a copy finds the edges through the obstacle in collision
+    checker->blocked = true;
+    BOOST_CHECK(!query());
+    checker->blocked = false;
+
+    // once the copies are updated, the roadmap itself knows about these edges, so it does not find a path
+    // through them even though the obstacle is gone
+    BOOST_REQUIRE(db->addPathAsync(path(0.0)));
+    db->waitForInsertions();
+    BOOST_CHECK(!query(spars));
+    spars->clearEdgeCollisionStates();
+    BOOST_CHECK(query(spars));
+}
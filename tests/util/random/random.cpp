@@ -214,6 +214,127 @@ BOOST_AUTO_TEST_CASE(NormalReals)
     BOOST_OMPL_EXPECT_NEAR(avgNormalReals(10.0, 1.0), 10.0, errNormal(1.0));
 }
 
+BOOST_AUTO_TEST_CASE(Streams)
+{
+    // the same (seed, stream) pair always generates the same numbers, and stream 0 is the plain seed
+    RNG a(42, 3), b(42, 3), c(42, 4), d(42, 0), e(42);
+    int differ = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        double va = a.uniform01();
+        BOOST_CHECK_EQUAL(va, b.uniform01());
+        BOOST_CHECK_EQUAL(d.uniform01(), e.uniform01());
+        if (va != c.uniform01())
+            ++differ;
+    }
+    BOOST_CHECK(differ > 95);
+    BOOST_CHECK_EQUAL(a.getLocalStream(), 3u);
+
+    // resetting the seed keeps the stream
+    a.setLocalSeed(42);
+    RNG f(42, 3);
+    BOOST_CHECK_EQUAL(a.uniform01(), f.uniform01());
+
+    // discard skips raw values of the engine
+    RNG::Engine g(7), h(7);
+    for (int i = 0; i < 1001; ++i)
+        g();
+    h.discard(1001);
+    BOOST_CHECK(g() == h());
+}
+
+BOOST_AUTO_TEST_CASE(ReseedInstances)
+{
+    RNG a, b, c(42);
+    RNG::reseedInstances(7);
+    std::uint_fast32_t seedA = a.getLocalSeed(), seedB = b.getLocalSeed();
+    double valueA = a.uniform01();
+    BOOST_CHECK(seedA != seedB);
+    // explicitly seeded instances keep their seed
+    BOOST_CHECK_EQUAL(c.getLocalSeed(), 42u);
+
+    // the same seed gives every instance the same seed again
+    RNG::reseedInstances(7);
+    BOOST_CHECK_EQUAL(a.getLocalSeed(), seedA);
+    BOOST_CHECK_EQUAL(b.getLocalSeed(), seedB);
+    BOOST_CHECK_EQUAL(a.uniform01(), valueA);
+
+    RNG::reseedInstances(8);
+    BOOST_CHECK(a.getLocalSeed() != seedA);
+
+    // an instance seeded with setLocalSeed() is no longer reseeded
+    b.setLocalSeed(5);
+    RNG::reseedInstances(9);
+    BOOST_CHECK_EQUAL(b.getLocalSeed(), 5u);
+}
+
+BOOST_AUTO_TEST_CASE(ReseedCopies)
+{
+    RNG a, c(42);
+    RNG b(a), d(c), e(42), f;
+    e = a;
+    f = c;
+    BOOST_CHECK_EQUAL(b.getLocalSeed(), a.getLocalSeed());
+    BOOST_CHECK_EQUAL(b.uniform01(), a.uniform01());
+
+    // copies of instances seeded by RNG() are reseeded like them, copies of explicitly seeded ones are not
+    RNG::reseedInstances(7);
+    BOOST_CHECK(b.getLocalSeed() != a.getLocalSeed());
+    BOOST_CHECK(e.getLocalSeed() != a.getLocalSeed());
+    BOOST_CHECK(e.getLocalSeed() != b.getLocalSeed());
+    BOOST_CHECK_EQUAL(d.getLocalSeed(), 42u);
+    BOOST_CHECK_EQUAL(f.getLocalSeed(), 42u);
+}
+
+BOOST_AUTO_TEST_CASE(PhiloxKnownAnswer)
+{
+    // test vector from the Random123 distribution
+    auto x = Philox4x32::block(0, {{0u, 0u}});
+    BOOST_CHECK_EQUAL(x[0], 0x6627e8d5u);
+    BOOST_CHECK_EQUAL(x[1], 0xe169c58du);
+    BOOST_CHECK_EQUAL(x[2], 0xbc57ac4cu);
+    BOOST_CHECK_EQUAL(x[3], 0x9b00dbd8u);
+
+    Philox4x32 p, q;
+    BOOST_CHECK_EQUAL(p(), 0x6627e8d5u);
+    for (unsigned int skip = 0; skip < 9; ++skip)
+    {
+        q = p;
+        for (unsigned int i = 0; i < skip; ++i)
+            p();
+        q.discard(skip);
+        BOOST_CHECK(p == q);
+        BOOST_CHECK_EQUAL(p(), q());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(BatchReals)
+{
+    RNG r;
+    std::vector<double> v(static_cast<std::size_t>(NUM_REAL_SAMPLES));
+    r.uniform01(v.data(), v.size());
+    double sum = 0.0;
+    for (double x : v)
+    {
+        BOOST_CHECK(x >= 0.0 && x < 1.0);
+        sum += x;
+    }
+    BOOST_OMPL_EXPECT_NEAR(sum / v.size(), 0.5, errUniformReal(0, 1));
+
+    // use an odd count to exercise the unpaired value
+    v.resize(v.size() - 1);
+    r.gaussian01(v.data(), v.size());
+    sum = 0.0;
+    double sumSq = 0.0;
+    for (double x : v)
+    {
+        sum += x;
+        sumSq += x * x;
+    }
+    BOOST_OMPL_EXPECT_NEAR(sum / v.size(), 0.0, errNormal(1.0));
+    BOOST_OMPL_EXPECT_NEAR(sumSq / v.size(), 1.0, 0.05);
+}
+
 BOOST_AUTO_TEST_CASE(SampleUnitSphere)
 {
     // Variables
@@ -0,0 +1,130 @@
+/*********************************************************************
+* Software License Agreement (BSD License)
+*
+*  Copyright (c) 2026, Rice University
+*  All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without
+*  modification, are permitted provided that the following conditions
+*  are met:
+*
+*   * Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above
+*     copyright notice, this list of conditions and the following
+*     disclaimer in the documentation and/or other materials provided
+*     with the distribution.
+*   * Neither the name of the Rice University nor the names of its
+*     contributors may be used to endorse or promote products derived
+*     from this software without specific prior written permission.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+*  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+*  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+*  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+*  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+*  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+*  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+*  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+*  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+*  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+*  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+*  POSSIBILITY OF SUCH DAMAGE.
+*********************************************************************/
+
+#define BOOST_TEST_MODULE "ThreadPool"
+#include <boost/test/unit_test.hpp>
+
+#include "ompl/util/ThreadPool.h"
+#include "ompl/util/Time.h"
+#include "ompl/base/spaces/RealVectorStateSpace.h"
+#include "ompl/geometric/planners/prm/PRM.h"
+#include <atomic>
+#include <future>
+#include <stdexcept>
+
+using namespace ompl;
+
+BOOST_AUTO_TEST_CASE(RunAllTasks)
+{
+    ThreadPool pool(3);
+    std::atomic<unsigned int> count{0};
+    for (unsigned int i = 0; i < 50; ++i)
+    {
+        // tasks that run more tasks on the same pool must not deadlock
+        std::vector<std::function<void()>> tasks(10, [&pool, &count]
+                                                 {
+                                                     std::vector<std::function<void()>> inner(
+                                                         5, [&count] { ++count; });
+                                                     pool.run(inner);
+                                                     ++count;
+                                                 });
+        pool.run(tasks);
+    }
+    BOOST_CHECK_EQUAL(count.load(), 50u * 60u);
+}
+
+BOOST_AUTO_TEST_CASE(Submit)
+{
+    ThreadPool pool(2);
+    BOOST_CHECK_EQUAL(pool.size(), 2u);
+
+    std::vector<std::future<int>> results;
+    for (int i = 0; i < 100; ++i)
+        results.push_back(pool.submit([i] { return i * i; }));
+    for (int i = 0; i < 100; ++i)
+        BOOST_CHECK_EQUAL(results[i].get(), i * i);
+
+    auto failed = pool.submit([]() -> int { throw std::runtime_error("submit"); });
+    BOOST_CHECK_THROW(failed.get(), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(RunException)
+{
+    ThreadPool pool(2, true);
+    std::atomic<unsigned int> count{0};
+    std::vector<std::function<void()>> tasks(8, [&count] { ++count; });
+    tasks[3] = [] { throw std::runtime_error("run"); };
+    BOOST_CHECK_THROW(pool.run(tasks), std::runtime_error);
+    // the other tasks still ran
+    BOOST_CHECK_EQUAL(count.load(), 7u);
+}
+
+BOOST_AUTO_TEST_CASE(PRMOnSaturatedPool)
+{
+    auto space(std::make_shared<base::RealVectorStateSpace>(2));
+    space->setBounds(0.0, 1.0);
+    auto si(std::make_shared<base::SpaceInformation>(space));
+    si->setStateValidityChecker([](const base::State *) { return true; });
+    si->setup();
+
+    // keep every worker of the global pool busy while PRM plans
+    std::promise<void> release;
+    std::shared_future<void> released(release.get_future());
+    std::vector<std::future<void>> busy;
+    for (unsigned int i = 0; i < ThreadPool::global().size(); ++i)
+        busy.push_back(ThreadPool::global().submit([released] { released.wait(); }));
+
+    auto pdef(std::make_shared<base::ProblemDefinition>(si));
+    base::ScopedState<> start(space), goal(space);
+    start[0] = start[1] = 0.1;
+    goal[0] = goal[1] = 0.9;
+    pdef->setStartAndGoalStates(start, goal);
+
+    geometric::PRM prm(si);
+    prm.setProblemDefinition(pdef);
+    prm.setup();
+
+    // the solution must be found long before the time limit, even with no free worker
+    time::point startTime = time::now();
+    base::PlannerStatus status = prm.solve(base::plannerOrTerminationCondition(
+        base::exactSolnPlannerTerminationCondition(pdef), base::timedPlannerTerminationCondition(30.0)));
+    double elapsed = time::seconds(time::now() - startTime);
+
+    release.set_value();
+    for (auto &b : busy)
+        b.get();
+
+    BOOST_CHECK(status == base::PlannerStatus::EXACT_SOLUTION);
+    BOOST_CHECK_LT(elapsed, 10.0);
+}